@@ -0,0 +1,124 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace malidrive {
+namespace builder {
+
+/// Phases of a RoadNetwork build, in order.
+enum class BuildPhase {
+  kParsing = 0,   ///< The XODR file is parsed.
+  kRoadGeometry,  ///< The RoadGeometry is built. Progress is reported per XODR Road.
+  kRules,         ///< The RuleRegistry and the RoadRulebook are built.
+  kBooks,         ///< The PhaseRingBook, the IntersectionBook and the state providers are built.
+  kDone,          ///< The RoadNetwork is built.
+};
+
+/// Progress of a RoadNetwork build.
+struct BuildProgress {
+  /// The current phase.
+  BuildPhase phase{BuildPhase::kParsing};
+  /// Number of completed steps of `phase`. It is in [0, `total`].
+  int completed{};
+  /// Number of steps of `phase`.
+  int total{};
+};
+
+/// Thrown by a build that is cancelled through a CancellationToken.
+class BuildCancelledError : public std::runtime_error {
+ public:
+  explicit BuildCancelledError(const std::string& what) : std::runtime_error(what) {}
+};
+
+/// Flag shared between the caller and a build to request its cancellation.
+///
+/// The build checks the flag at certain points, e.g. between XODR Roads, and
+/// throws BuildCancelledError once it is set. It is thread-safe.
+class CancellationToken {
+ public:
+  /// Constructs a token that is only cancelled through Cancel().
+  CancellationToken() = default;
+
+  /// Constructs a token that is also cancelled when `parent` is. It lets a
+  /// component stop a build on its own while honouring the caller's token.
+  ///
+  /// @param parent The token to follow. It may be nullptr.
+  explicit CancellationToken(std::shared_ptr<const CancellationToken> parent) : parent_(std::move(parent)) {}
+
+  /// Requests the cancellation.
+  void Cancel() { cancelled_.store(true); }
+
+  /// @returns True when the cancellation has been requested, either on this
+  ///          token or on its parent.
+  bool IsCancelled() const { return cancelled_.load() || (parent_ != nullptr && parent_->IsCancelled()); }
+
+ private:
+  std::atomic<bool> cancelled_{false};
+  const std::shared_ptr<const CancellationToken> parent_{};
+};
+
+/// Hooks a caller attaches to a build to observe and control it. A default
+/// constructed BuildControl neither reports progress nor can be cancelled.
+struct BuildControl {
+  /// Called with the progress of the build. It may be called from any of the
+  /// threads the build uses, but never concurrently. It may be empty.
+  std::function<void(const BuildProgress&)> progress_callback{};
+  /// The token to check for cancellation. It may be nullptr.
+  std::shared_ptr<const CancellationToken> cancellation_token{};
+
+  /// Reports the progress of the build to `progress_callback` when it is set.
+  ///
+  /// @param phase The current phase.
+  /// @param completed Number of completed steps of `phase`.
+  /// @param total Number of steps of `phase`.
+  void ReportProgress(BuildPhase phase, int completed, int total) const {
+    if (progress_callback) {
+      progress_callback(BuildProgress{phase, completed, total});
+    }
+  }
+
+  /// @throws BuildCancelledError When `cancellation_token` is set and
+  ///         cancelled.
+  void ThrowIfCancelled() const {
+    if (cancellation_token != nullptr && cancellation_token->IsCancelled()) {
+      throw BuildCancelledError("The build has been cancelled.");
+    }
+  }
+};
+
+}  // namespace builder
+}  // namespace malidrive
@@ -140,6 +140,40 @@ static constexpr char const* kBuildPolicy{"build_policy"};
 ///    - Default: std::thread::hardware_concurrency() minus one (running thread).
 static constexpr char const* kNumThreads{"num_threads"};
 
+/// True for deferring the arc length integration of the Lanes of each Segment
+/// until any of them is first queried for its geometry, e.g. its length or an
+/// InertialPosition. Lanes' IDs, adjacency and BranchPoints are built at load
+/// time regardless. The RoadNetworkBuilder's rule builders use estimates of the
+/// Lanes' lengths, so loading a RoadNetwork does not integrate them either.
+/// Integration errors surface on the first query instead of at load time, and
+/// the linear tolerance search of @e "max_linear_tolerance" does not retry with
+/// a larger tolerance for them. Use it with tolerances that are known to work
+/// for the map. False for integrating them at load time.
+///   - Options:
+///     - 1. <em> "true", "True", "TRUE", "on", "On", "ON" </em>
+///     - 2. <em> "false", "False",  "FALSE", "off", "Off", "OFF" </em>
+///   - Default: @e "false"
+static constexpr char const* kLazyLaneConstruction{"lazy_lane_construction"};
+
+/// Restricts the RoadGeometry to the XODR Roads with any plan view geometry
+/// starting within an axis aligned box of the Inertial Frame. The format is
+/// {min_x, min_y, max_x, max_y}, same as maliput::math::Vector4 is serialized.
+/// See malidrive::builder::BuildRegion.
+///   - Default: No restriction.
+static constexpr char const* kBuildRegionBoundingBox{"build_region_bounding_box"};
+
+/// Restricts the RoadGeometry to a comma separated list of XODR Road IDs,
+/// e.g. "1, 4, 12". It can be combined with `build_region_bounding_box`.
+/// See malidrive::builder::BuildRegion.
+///   - Default: No restriction.
+static constexpr char const* kBuildRegionRoadIds{"build_region_road_ids"};
+
+/// Number of times the XODR Roads selected by `build_region_bounding_box` and
+/// `build_region_road_ids` are expanded by their linked XODR Roads. It must be
+/// non-negative.
+///   - Default: @e "0"
+static constexpr char const* kBuildRegionTopologicalRadius{"build_region_topological_radius"};
+
 /// Determines geometries simplification for the XODR's roads.
 ///   - Options:
 ///     - 1. @e "none"
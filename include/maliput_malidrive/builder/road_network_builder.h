@@ -35,6 +35,7 @@
 
 #include <maliput/api/road_network.h>
 
+#include "maliput_malidrive/builder/build_control.h"
 #include "maliput_malidrive/common/macros.h"
 
 namespace malidrive {
@@ -48,14 +49,32 @@ class RoadNetworkBuilder {
   ///
   /// @param road_network_configuration Holds the information of all the
   ///        RoadNetwork entities.
-  explicit RoadNetworkBuilder(const std::map<std::string, std::string>& road_network_configuration)
-      : road_network_configuration_(road_network_configuration) {}
+  /// @param build_control Reports the progress of each BuildPhase and is
+  ///        checked for cancellation between phases and while the
+  ///        RoadGeometry is built.
+  /// @param previous_road_network A RoadNetwork built before out of a
+  ///        previous version of the same XODR description with the same
+  ///        configuration, e.g. before the XODR file was edited. The geometry
+  ///        of the XODR Roads that did not change is reused instead of being
+  ///        integrated again, while the rest of the RoadGeometry and the rules
+  ///        are built anew. It may be nullptr. When it is not, it must outlive
+  ///        operator()() but not the resulting RoadNetwork. RoadNetworks that
+  ///        are not maliput_malidrive's are ignored.
+  explicit RoadNetworkBuilder(const std::map<std::string, std::string>& road_network_configuration,
+                              const BuildControl& build_control = {},
+                              const maliput::api::RoadNetwork* previous_road_network = nullptr)
+      : road_network_configuration_(road_network_configuration),
+        build_control_(build_control),
+        previous_road_network_(previous_road_network) {}
 
   /// @return A maliput_malidrive RoadNetwork.
+  /// @throws BuildCancelledError When the build is cancelled.
   std::unique_ptr<maliput::api::RoadNetwork> operator()() const;
 
  private:
   const std::map<std::string, std::string> road_network_configuration_;
+  const BuildControl build_control_;
+  const maliput::api::RoadNetwork* previous_road_network_{};
 };
 
 }  // namespace builder
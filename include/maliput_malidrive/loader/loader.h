@@ -29,12 +29,14 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
 
 #include <maliput/api/road_network.h>
 
+#include "maliput_malidrive/builder/build_control.h"
 #include "maliput_malidrive/common/macros.h"
 
 namespace malidrive {
@@ -58,5 +60,47 @@ std::unique_ptr<maliput::api::RoadNetwork> Load(const std::map<std::string, std:
   return RoadNetworkBuilderT(road_network_configuration)();
 }
 
+/// Builds a malidrive RoadNetwork in a background thread.
+///
+/// Forwards a call to RoadNetworkBuilderT with @p build_control, so the caller
+/// can observe the progress of the build and cancel it while waiting.
+///
+/// @param road_network_configuration A string-string map containing information about the RoadNetwork configuration
+/// used during the loading process. It is copied, so it may go out of scope before the build finishes.
+/// @param build_control Holds the progress callback, invoked from the loading thread, and the
+/// CancellationToken of the build.
+///
+/// @return A future to the RoadNetwork. When the build is cancelled, getting the future throws
+/// builder::BuildCancelledError.
+/// @tparam RoadNetworkBuilderT builder::RoadNetworkBuilder.
+template <class RoadNetworkBuilderT>
+std::future<std::unique_ptr<maliput::api::RoadNetwork>> LoadAsync(
+    const std::map<std::string, std::string>& road_network_configuration,
+    const builder::BuildControl& build_control = {}) {
+  return std::async(std::launch::async, [road_network_configuration, build_control]() {
+    return RoadNetworkBuilderT(road_network_configuration, build_control)();
+  });
+}
+
+/// Rebuilds a malidrive RoadNetwork after its XODR description was edited.
+///
+/// Forwards a call to RoadNetworkBuilderT with @p previous_road_network, so
+/// the geometry of the XODR Roads that did not change is reused instead of
+/// being integrated again.
+///
+/// @param road_network_configuration A string-string map containing information about the RoadNetwork configuration
+/// used during the loading process. It must be the configuration @p previous_road_network was loaded with, although
+/// the XODR file it points to may have changed.
+/// @param previous_road_network The RoadNetwork loaded before the XODR description was edited. It may be destroyed
+/// once this function returns.
+///
+/// @return An unique_ptr to a RoadNetwork.
+/// @tparam RoadNetworkBuilderT builder::RoadNetworkBuilder.
+template <class RoadNetworkBuilderT>
+std::unique_ptr<maliput::api::RoadNetwork> Reload(const std::map<std::string, std::string>& road_network_configuration,
+                                                  const maliput::api::RoadNetwork& previous_road_network) {
+  return RoadNetworkBuilderT(road_network_configuration, builder::BuildControl{}, &previous_road_network)();
+}
+
 }  // namespace loader
 }  // namespace malidrive
@@ -0,0 +1,116 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// Partitions a XODR map into regions of balanced lane length, e.g. to spread a simulation across processes.
+/// @code{sh}
+/// xodr_partition <xodr_file> --num_regions=<num_regions>
+/// @endcode
+///
+/// For each region it prints the XODR Road IDs of the region and of its halo. They are formatted as the
+/// `build_region_road_ids` RoadGeometry configuration parameter expects them, so each region can be loaded on its own.
+///
+/// Use `--help` argument to see available arguments.
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include <gflags/gflags.h>
+#include <maliput/common/logger.h>
+
+#include "applications/log_level_flag.h"
+#include "maliput_malidrive/builder/map_partition.h"
+#include "maliput_malidrive/xodr/db_manager.h"
+
+namespace malidrive {
+namespace applications {
+namespace xodr {
+namespace {
+
+// @{ CLI Arguments
+DEFINE_int32(num_regions, 2, "Number of regions to partition the map into.");
+DEFINE_double(tolerance, 1e-3, "Tolerance to validate continuity in piecewise defined geometries.");
+DEFINE_bool(allow_schema_errors, false, "If true, the XODR parser will attempt to work around XODR schema violations.");
+DEFINE_bool(allow_semantic_errors, false,
+            "If true, the XODR parser will attempt to work around XODR semantic violations.");
+MALIPUT_MALIDRIVE_APPLICATION_DEFINE_LOG_LEVEL_FLAG();
+// @}
+
+// @return A string with the usage message.
+std::string GetUsageMessage() {
+  std::stringstream ss;
+  ss << "CLI for partitioning a XODR map into regions of balanced lane length" << std::endl << std::endl;
+  ss << "  xodr_partition <xodr_file> --num_regions=<num_regions>" << std::endl;
+  return ss.str();
+}
+
+// @returns `road_ids` as a comma separated list.
+std::string ToString(const std::set<malidrive::xodr::RoadHeader::Id>& road_ids) {
+  std::stringstream ss;
+  for (auto it = road_ids.begin(); it != road_ids.end(); ++it) {
+    ss << (it == road_ids.begin() ? "" : ",") << it->string();
+  }
+  return ss.str();
+}
+
+int Main(int argc, char** argv) {
+  // Handles CLI arguments.
+  gflags::SetUsageMessage(GetUsageMessage());
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  if (argc != 2) {
+    std::cout << "\nWrong number of arguments. See application documentation: \n" << std::endl;
+    gflags::ShowUsageWithFlags(argv[0]);
+    return 1;
+  }
+  maliput::common::set_log_level(FLAGS_log_level);
+  maliput::log()->info("xodr_partition application\n\t|__ xodr_file_path: ", argv[1],
+                       "\n\t|__ num_regions: ", FLAGS_num_regions);
+
+  const auto db_manager = malidrive::xodr::LoadDataBaseFromFile(
+      argv[1], {FLAGS_tolerance, FLAGS_allow_schema_errors, FLAGS_allow_semantic_errors});
+  const malidrive::builder::MapPartition partition = malidrive::builder::PartitionMap(*db_manager, FLAGS_num_regions);
+
+  std::cout << "num_cut_edges: " << partition.num_cut_edges << std::endl;
+  for (int i = 0; i < static_cast<int>(partition.regions.size()); ++i) {
+    const malidrive::builder::MapRegion& region = partition.regions[i];
+    std::cout << "region: " << i << std::endl;
+    std::cout << "  lane_length: " << region.lane_length << std::endl;
+    std::cout << "  road_ids: " << ToString(region.road_ids) << std::endl;
+    std::cout << "  halo_road_ids: " << ToString(region.halo_road_ids) << std::endl;
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace xodr
+}  // namespace applications
+}  // namespace malidrive
+
+int main(int argc, char** argv) { return malidrive::applications::xodr::Main(argc, argv); }
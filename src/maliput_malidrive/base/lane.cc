@@ -31,6 +31,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
 
 #include <maliput/common/logger.h>
 #include <maliput/common/range_validator.h>
@@ -39,6 +44,9 @@
 #include "maliput_malidrive/base/road_geometry.h"
 
 namespace malidrive {
+
+using maliput::math::Vector3;
+
 namespace {
 
 // Values used for the InertialToLaneSegmentPositionBackend method.
@@ -47,14 +55,53 @@ static constexpr bool kUseLaneBoundaries = true;
 static constexpr bool kUseSegmentBoundaries = !kUseLaneBoundaries;
 // @}
 
-}  // namespace
+// @returns The Inertial to Backend Frame translation of the RoadGeometry that
+//          holds `lane`. When `lane` is not yet part of a RoadGeometry, a zero
+//          translation is returned.
+Vector3 GetInertialToBackendFrameTranslation(const maliput::api::Lane* lane) {
+  const maliput::api::Segment* segment = lane->segment();
+  if (segment == nullptr || segment->junction() == nullptr || segment->junction()->road_geometry() == nullptr) {
+    return {0., 0., 0.};
+  }
+  return segment->junction()->road_geometry()->inertial_to_backend_frame_translation();
+}
 
-using maliput::math::Vector3;
+// The proportion of the linear tolerance that the quadrature error of
+// Lane::IntegrateArcLength() may reach over the whole lane.
+constexpr double kArcLengthEstimationToleranceMultiplier{1e-2};
+
+// Maximum number of times an interval of Lane::IntegrateArcLength() is halved.
+constexpr int kMaxArcLengthEstimationDepth{20};
+
+}  // namespace
 
 Lane::Lane(const maliput::api::LaneId& id, int xodr_track, int xodr_lane_id,
            const maliput::api::HBounds& elevation_bounds, const road_curve::RoadCurve* road_curve,
            std::unique_ptr<road_curve::Function> lane_width, std::unique_ptr<road_curve::Function> lane_offset,
            double p0, double p1)
+    : Lane(id, xodr_track, xodr_lane_id, elevation_bounds, road_curve, std::move(lane_width), std::move(lane_offset),
+           p0, p1, {} /* s_from_p */, {} /* p_from_s */) {}
+
+Lane::Lane(const maliput::api::LaneId& id, int xodr_track, int xodr_lane_id,
+           const maliput::api::HBounds& elevation_bounds, const road_curve::RoadCurve* road_curve,
+           std::unique_ptr<road_curve::Function> lane_width, std::unique_ptr<road_curve::Function> lane_offset,
+           double p0, double p1, std::function<double(double)> s_from_p, std::function<double(double)> p_from_s)
+    : Lane(id, xodr_track, xodr_lane_id, elevation_bounds, road_curve, std::move(lane_width), std::move(lane_offset),
+           p0, p1, ArcLengthFunctions{std::move(s_from_p), std::move(p_from_s), {} /* p_from_s_batch */}) {}
+
+Lane::Lane(const maliput::api::LaneId& id, int xodr_track, int xodr_lane_id,
+           const maliput::api::HBounds& elevation_bounds, const road_curve::RoadCurve* road_curve,
+           std::unique_ptr<road_curve::Function> lane_width, std::unique_ptr<road_curve::Function> lane_offset,
+           double p0, double p1, ArcLengthFunctions arc_length_functions)
+    : Lane(id, xodr_track, xodr_lane_id, elevation_bounds, road_curve, std::move(lane_width), std::move(lane_offset),
+           p0, p1, [arc_length_functions = std::move(arc_length_functions)]() { return arc_length_functions; }) {
+  BuildArcLengthMaps();
+}
+
+Lane::Lane(const maliput::api::LaneId& id, int xodr_track, int xodr_lane_id,
+           const maliput::api::HBounds& elevation_bounds, const road_curve::RoadCurve* road_curve,
+           std::unique_ptr<road_curve::Function> lane_width, std::unique_ptr<road_curve::Function> lane_offset,
+           double p0, double p1, std::function<ArcLengthFunctions()> arc_length_functions_builder)
     : maliput::geometry_base::Lane(id),
       xodr_track_(xodr_track),
       xodr_lane_id_(xodr_lane_id),
@@ -62,61 +109,205 @@ Lane::Lane(const maliput::api::LaneId& id, int xodr_track, int xodr_lane_id,
       road_curve_(road_curve),
       p0_(p0),
       p1_(p1),
-      road_curve_offset_(road_curve_, lane_offset.get(), p0, p1),
       lane_width_(std::move(lane_width)),
-      lane_offset_(std::move(lane_offset)) {
+      lane_offset_(std::move(lane_offset)),
+      arc_length_functions_builder_(std::move(arc_length_functions_builder)) {
   MALIDRIVE_THROW_UNLESS(xodr_track >= 0);
 
   MALIDRIVE_THROW_UNLESS(road_curve_ != nullptr);
   MALIDRIVE_THROW_UNLESS(lane_width_ != nullptr);
   MALIDRIVE_THROW_UNLESS(lane_offset_ != nullptr);
+  MALIDRIVE_THROW_UNLESS(arc_length_functions_builder_ != nullptr);
 
   MALIDRIVE_IS_IN_RANGE(std::abs(lane_width_->p0() - p0), 0., road_curve_->linear_tolerance());
   MALIDRIVE_IS_IN_RANGE(std::abs(lane_width_->p1() - p1), 0., road_curve_->linear_tolerance());
   MALIDRIVE_IS_IN_RANGE(std::abs(lane_offset_->p0() - p0), 0., road_curve_->linear_tolerance());
   MALIDRIVE_IS_IN_RANGE(std::abs(lane_offset_->p1() - p1), 0., road_curve_->linear_tolerance());
+}
 
-  // @{ The following if clause introduces an implementation knowledge abuse.
-  //    road_curve::RoadCurve::LMax() is the result of the summatory of
-  //    all the arc lengths of a potential piecewise ground curve. The range
-  //    road_curve::RoadCurve::p0() to road_curve::RoadCurve::p1()
-  //    maps it. `lane_ground_curve_lmax` holds the fraction that belongs to
-  //    this lane.
-  const double lane_ground_curve_lmax = road_curve_->LMax() * (p1_ - p0_) / (road_curve_->p1() - road_curve_->p0());
-  if (lane_ground_curve_lmax > road_curve_->linear_tolerance()) {
-    p_from_s_ = road_curve_offset_.PFromS();
-    s_from_p_ = road_curve_offset_.SFromP();
-    length_ = s_from_p_(p1);
-    // Numerical integration might lead to errors in length up to linear_tolerance.
-    // However, p <--> s functors above do not tolerate working with values that
-    // go beyond the strict range of [p0, p1] and [0, length_]. Consequently, we
-    // use maliput::common::RangeValidator() to a) validate that s arguments in
-    // functions of this class are in range with linear_tolerance and b) values
-    // are adjusted to be in the open range (0, length_) with a quarter of
-    // linear_tolerance as the distance between closed and open range extrema.
-    s_range_validation_ = maliput::common::RangeValidator::GetAbsoluteEpsilonValidator(
-        0., length_, road_curve_->linear_tolerance(), road_curve_->linear_tolerance() / 4.);
-  } else {
-    maliput::log()->trace("Lane ", id.string(),
-                          " is shorter than linear tolerance. Will not construct the RoadCurveOffset for it.");
-    p_from_s_ = [p0 = p0_, p1 = p1_, lane_ground_curve_lmax](double s) -> double {
-      return p0 + s / lane_ground_curve_lmax * (p1 - p0);
-    };
-    s_from_p_ = [p0 = p0_, p1 = p1_, lane_ground_curve_lmax](double p) -> double {
-      return (p - p0) / (p1 - p0) * lane_ground_curve_lmax;
-    };
-    length_ = s_from_p_(p1);
-    // There are no numerical integrations involved in p_from_s_ and s_from_p_
-    // but to mimic the behavior, we will tolerate up to linear tolerance excess
-    // in s range. Then, the s value will be saturated.
-    s_range_validation_ = maliput::common::RangeValidator::GetAbsoluteEpsilonValidator(
-        0., length_, road_curve_->linear_tolerance(), /*epsilon*/ 0.);
-  }
-  // @}
+void Lane::BuildArcLengthMaps() const {
+  std::call_once(arc_length_maps_flag_, [this]() {
+    ArcLengthMaps maps;
+    // @{ The following if clause introduces an implementation knowledge abuse.
+    //    road_curve::RoadCurve::LMax() is the result of the summatory of
+    //    all the arc lengths of a potential piecewise ground curve. The range
+    //    road_curve::RoadCurve::p0() to road_curve::RoadCurve::p1()
+    //    maps it. `lane_ground_curve_lmax` holds the fraction that belongs to
+    //    this lane.
+    const double lane_ground_curve_lmax = LaneGroundCurveLMax();
+    if (lane_ground_curve_lmax > road_curve_->linear_tolerance()) {
+      ArcLengthFunctions arc_length_functions = arc_length_functions_builder_();
+      if (arc_length_functions.s_from_p && arc_length_functions.p_from_s) {
+        maps.p_from_s = std::move(arc_length_functions.p_from_s);
+        maps.s_from_p = std::move(arc_length_functions.s_from_p);
+        maps.p_from_s_batch =
+            arc_length_functions.p_from_s_batch
+                ? std::move(arc_length_functions.p_from_s_batch)
+                : [p_from_s = maps.p_from_s](const std::vector<double>& s, std::vector<double>* p) {
+                    p->resize(s.size());
+                    for (std::size_t i = 0; i < s.size(); ++i) {
+                      (*p)[i] = p_from_s(s[i]);
+                    }
+                  };
+        arc_length_functions_provided_ = true;
+      } else {
+        road_curve_offset_ = std::make_unique<road_curve::RoadCurveOffset>(road_curve_, lane_offset_.get(), p0_, p1_);
+        // The integrators' dense outputs behind these functors are not documented as safe for concurrent evaluation,
+        // so both conversions are serialized to keep const queries thread-safe.
+        auto dense_output_mutex = std::make_shared<std::mutex>();
+        maps.p_from_s = [dense_output_mutex, p_from_s = road_curve_offset_->PFromS()](double s) -> double {
+          std::lock_guard<std::mutex> lock(*dense_output_mutex);
+          return p_from_s(s);
+        };
+        maps.s_from_p = [dense_output_mutex, s_from_p = road_curve_offset_->SFromP()](double p) -> double {
+          std::lock_guard<std::mutex> lock(*dense_output_mutex);
+          return s_from_p(p);
+        };
+        // The lock is taken once for the whole batch.
+        maps.p_from_s_batch = [dense_output_mutex, p_from_s = road_curve_offset_->PFromS()](
+                                  const std::vector<double>& s, std::vector<double>* p) {
+          p->resize(s.size());
+          std::lock_guard<std::mutex> lock(*dense_output_mutex);
+          for (std::size_t i = 0; i < s.size(); ++i) {
+            (*p)[i] = p_from_s(s[i]);
+          }
+        };
+      }
+      maps.length = maps.s_from_p(p1_);
+      // Numerical integration might lead to errors in length up to linear_tolerance.
+      // However, p <--> s functors above do not tolerate working with values that
+      // go beyond the strict range of [p0, p1] and [0, length]. Consequently, we
+      // use maliput::common::RangeValidator() to a) validate that s arguments in
+      // functions of this class are in range with linear_tolerance and b) values
+      // are adjusted to be in the open range (0, length) with a quarter of
+      // linear_tolerance as the distance between closed and open range extrema.
+      maps.s_range_validation = maliput::common::RangeValidator::GetAbsoluteEpsilonValidator(
+          0., maps.length, road_curve_->linear_tolerance(), road_curve_->linear_tolerance() / 4.);
+    } else {
+      maliput::log()->trace("Lane ", id().string(),
+                            " is shorter than linear tolerance. Will not construct the RoadCurveOffset for it.");
+      maps.p_from_s = [p0 = p0_, p1 = p1_, lane_ground_curve_lmax](double s) -> double {
+        return p0 + s / lane_ground_curve_lmax * (p1 - p0);
+      };
+      maps.s_from_p = [p0 = p0_, p1 = p1_, lane_ground_curve_lmax](double p) -> double {
+        return (p - p0) / (p1 - p0) * lane_ground_curve_lmax;
+      };
+      maps.p_from_s_batch = [p0 = p0_, p1 = p1_, lane_ground_curve_lmax](const std::vector<double>& s,
+                                                                          std::vector<double>* p) {
+        p->resize(s.size());
+        for (std::size_t i = 0; i < s.size(); ++i) {
+          (*p)[i] = p0 + s[i] / lane_ground_curve_lmax * (p1 - p0);
+        }
+      };
+      maps.length = maps.s_from_p(p1_);
+      // There are no numerical integrations involved in p_from_s and s_from_p
+      // but to mimic the behavior, we will tolerate up to linear tolerance excess
+      // in s range. Then, the s value will be saturated.
+      maps.s_range_validation = maliput::common::RangeValidator::GetAbsoluteEpsilonValidator(
+          0., maps.length, road_curve_->linear_tolerance(), /*epsilon*/ 0.);
+    }
+    // @}
+    arc_length_maps_ = std::move(maps);
+    arc_length_functions_builder_ = nullptr;
+    arc_length_maps_built_.store(true, std::memory_order_release);
+  });
+}
+
+std::optional<Lane::ArcLengthFunctions> Lane::GetArcLengthFunctions() const {
+  if (!arc_length_maps_built_.load(std::memory_order_acquire) || !arc_length_functions_provided_) {
+    return std::nullopt;
+  }
+  return ArcLengthFunctions{arc_length_maps_.s_from_p, arc_length_maps_.p_from_s, arc_length_maps_.p_from_s_batch};
+}
+
+double Lane::IntegrateArcLength(double p) const {
+  const double lmax = LaneGroundCurveLMax();
+  if (lmax <= road_curve_->linear_tolerance()) {
+    // Mimics the linear mappings BuildArcLengthMaps() uses for short lanes.
+    return (p - p0_) / (p1_ - p0_) * lmax;
+  }
+  const auto s_dot = [this](double p) {
+    return road_curve_->WDot({p, lane_offset_->f(p), 0.}, lane_offset_.get()).norm();
+  };
+  // Like road_curve::JointRoadCurveOffset, intervals start at the ground curve
+  // breakpoints and span at most a scale length.
+  std::vector<double> bounds{p0_};
+  for (const double breakpoint : road_curve_->ground_curve()->Breakpoints()) {
+    if (breakpoint > bounds.back() && breakpoint < p) {
+      bounds.push_back(breakpoint);
+    }
+  }
+  bounds.push_back(p);
+  const double max_step = road_curve_->scale_length() * (road_curve_->p1() - road_curve_->p0()) / road_curve_->LMax();
+  const double tolerance_rate = road_curve_->linear_tolerance() * kArcLengthEstimationToleranceMultiplier / (p1_ - p0_);
+
+  // Holds an interval whose quadrature has not been accepted yet.
+  struct Interval {
+    double a{};
+    double b{};
+    double f_a{};
+    double f_m{};
+    double f_b{};
+    int depth{};
+  };
+  double s{0.};
+  for (std::size_t k = 0; k + 1 < bounds.size(); ++k) {
+    const double length = bounds[k + 1] - bounds[k];
+    const int num_steps = max_step > 0. ? std::max(1, static_cast<int>(std::ceil(length / max_step))) : 1;
+    const double step = length / static_cast<double>(num_steps);
+    for (int i = 0; i < num_steps; ++i) {
+      const double a = bounds[k] + static_cast<double>(i) * step;
+      const double b = i == num_steps - 1 ? bounds[k + 1] : a + step;
+      std::vector<Interval> pending{{a, b, s_dot(a), s_dot((a + b) / 2.), s_dot(b), 0}};
+      while (!pending.empty()) {
+        const Interval interval = pending.back();
+        pending.pop_back();
+        const double m = (interval.a + interval.b) / 2.;
+        const double h = interval.b - interval.a;
+        const double f_left_middle = s_dot((interval.a + m) / 2.);
+        const double f_right_middle = s_dot((m + interval.b) / 2.);
+        const double coarse = h / 6. * (interval.f_a + 4. * interval.f_m + interval.f_b);
+        const double left = h / 12. * (interval.f_a + 4. * f_left_middle + interval.f_m);
+        const double right = h / 12. * (interval.f_m + 4. * f_right_middle + interval.f_b);
+        if (std::abs(left + right - coarse) / 15. > tolerance_rate * h &&
+            interval.depth < kMaxArcLengthEstimationDepth) {
+          pending.push_back({m, interval.b, interval.f_m, f_right_middle, interval.f_b, interval.depth + 1});
+          pending.push_back({interval.a, m, interval.f_a, f_left_middle, interval.f_m, interval.depth + 1});
+          continue;
+        }
+        s += left + right;
+      }
+    }
+  }
+  return s;
+}
+
+double Lane::EstimateLaneSFromTrackS(double track_s) const {
+  if (arc_length_maps_built_.load(std::memory_order_acquire)) {
+    return LaneSFromTrackS(track_s);
+  }
+  const double p = maliput::math::saturate(track_s, p0_, p1_);
+  return p == p1_ ? EstimateLength() : IntegrateArcLength(p);
+}
+
+double Lane::EstimateLength() const {
+  if (arc_length_maps_built_.load(std::memory_order_acquire)) {
+    return arc_length_maps_.length;
+  }
+  std::call_once(estimated_length_flag_, [this]() { estimated_length_ = IntegrateArcLength(p1_); });
+  return estimated_length_;
+}
+
+void Lane::SetXodrLane(const xodr::RoadHeader* xodr_road_header, const xodr::Lane* xodr_lane) {
+  MALIDRIVE_THROW_UNLESS(xodr_road_header != nullptr);
+  MALIDRIVE_THROW_UNLESS(xodr_lane != nullptr);
+  xodr_road_header_ = xodr_road_header;
+  xodr_lane_ = xodr_lane;
 }
 
 maliput::api::RBounds Lane::do_lane_bounds(double s) const {
-  const double p = p_from_s_(s_range_validation_(s));
+  const ArcLengthMaps& maps = arc_length_maps();
+  const double p = maps.p_from_s(maps.s_range_validation(s));
   // Lane width function is a cubic polynomial and as such negative values are possible,
   // however negative widths are clamped to zero given that it isn't consistent with real lane situations.
   const double width = std::max(0., lane_width_->f(p));
@@ -124,7 +315,7 @@ maliput::api::RBounds Lane::do_lane_bounds(double s) const {
 }
 
 maliput::api::RBounds Lane::do_segment_bounds(double s) const {
-  s = s_range_validation_(s);
+  s = arc_length_maps().s_range_validation(s);
   const double p = TrackSFromLaneS(s);
   const maliput::api::RBounds lane_bounds = do_lane_bounds(s);
   double bound_left = lane_bounds.max();
@@ -151,69 +342,257 @@ maliput::api::RBounds Lane::do_segment_bounds(double s) const {
 }
 
 maliput::math::Vector3 Lane::DoToBackendPosition(const maliput::api::LanePosition& lane_pos) const {
-  const double p = p_from_s_(s_range_validation_(lane_pos.s()));
+  const ArcLengthMaps& maps = arc_length_maps();
+  const double p = maps.p_from_s(maps.s_range_validation(lane_pos.s()));
   return road_curve_->W({p, to_reference_r(p, lane_pos.r()), lane_pos.h()});
 }
 
-Vector3 Lane::BackendFrameToLaneFrame(const Vector3& xyz) const {
-  // Gets initial estimate of `p` from the RoadCurve.
-  double p{road_curve_->WInverse(xyz).x()};
-  // Delta p, to be reduced iteratively.
-  double dp{2.0 * road_curve_->linear_tolerance()};
-
-  constexpr int kMaxIterations{16};
-  // Correction in p computed iteratively.
-  // Start of iterations.
-  for (int i = 0; i < kMaxIterations && std::abs(dp) > road_curve_->linear_tolerance(); ++i) {
-    // Gets the position in the INERTIAL Frame at the centerlane.
-    // Saturates p to Lane's range.
-    p = maliput::math::saturate(p, p0_, p1_);
-    const maliput::math::Vector3 prh_at_centerlane{p, lane_offset_->f(p), 0};
-    const maliput::math::Vector3 w_p{road_curve_->W(prh_at_centerlane)};
-    // Gets the vector difference between w_p and `xyz`.
-    const maliput::math::Vector3 w_delta{xyz - w_p};
-    // Computes the centerlane derivative with respect to p.
-    const maliput::math::Vector3 w_dot{road_curve_->WDot(prh_at_centerlane, lane_offset_.get())};
-    // Iterative updates of `p` with Newton's method:
-    // Compute correction in p from component of w_delta / w_dot.norm() parallel to centerlane:
-    //   dp = (w_delta / w_dot.norm()).dot(s_hat);
-    // which is equivalent to the following:
-    dp = w_delta.dot(w_dot) / w_dot.dot(w_dot);
-  }
-  p = maliput::math::saturate(p, p0_, p1_);
-
-  // Recompute with final value of p:
-  // Gets the position in the INERTIAL Frame at the centerlane.
-  const maliput::math::Vector3 prh_at_centerlane{p, 0., 0.};
-  const maliput::math::Vector3 w_p{road_curve_->W(prh_at_centerlane)};
-  // Gets the vector difference between w_p and `xyz`.
-  const maliput::math::Vector3 w_delta{xyz - w_p};
-  // Computes the orthonormal basis at p, and projects the difference onto r_hat
-  // and h_hat to get each component.
-  const maliput::math::Vector3 s_hat{road_curve_->SHat(prh_at_centerlane)};
-  const maliput::math::Vector3 h_hat{road_curve_->HHat(p, s_hat)};
-  const maliput::math::Vector3 r_hat{h_hat.cross(s_hat)};
-  return {p, r_hat.dot(w_delta) - lane_offset_->f(p), h_hat.dot(w_delta)};
+void Lane::ToInertialPositions(const road_curve::Vector3Batch& lane_positions,
+                               road_curve::Vector3Batch* inertial_positions) const {
+  MALIDRIVE_THROW_UNLESS(lane_positions.is_consistent());
+  MALIDRIVE_THROW_UNLESS(inertial_positions != nullptr);
+  const std::size_t size = lane_positions.size();
+  road_curve::Vector3Batch prh(size);
+  const ArcLengthMaps& maps = arc_length_maps();
+  std::vector<double> s(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    s[i] = maps.s_range_validation(lane_positions.x[i]);
+  }
+  maps.p_from_s_batch(s, &prh.x);
+  // Same as to_reference_r() on each position.
+  lane_offset_->f(prh.x, &prh.y);
+  for (std::size_t i = 0; i < size; ++i) {
+    prh.y[i] += lane_positions.y[i];
+  }
+  prh.z = lane_positions.z;
+  road_curve_->W(prh, inertial_positions);
+
+  const Vector3 inertial_to_backend_frame_translation = GetInertialToBackendFrameTranslation(this);
+  for (std::size_t i = 0; i < size; ++i) {
+    inertial_positions->x[i] += inertial_to_backend_frame_translation.x();
+    inertial_positions->y[i] += inertial_to_backend_frame_translation.y();
+    inertial_positions->z[i] += inertial_to_backend_frame_translation.z();
+  }
+}
+
+void Lane::ToLanePositions(const road_curve::Vector3Batch& inertial_positions,
+                           road_curve::Vector3Batch* lane_positions, std::vector<double>* distances,
+                           std::vector<ProjectionStatus>* statuses) const {
+  MALIDRIVE_THROW_UNLESS(inertial_positions.is_consistent());
+  MALIDRIVE_THROW_UNLESS(lane_positions != nullptr);
+  MALIDRIVE_THROW_UNLESS(distances != nullptr);
+  const std::size_t size = inertial_positions.size();
+  const Vector3 inertial_to_backend_frame_translation = GetInertialToBackendFrameTranslation(this);
+  road_curve::Vector3Batch backend_positions(size);
+  std::vector<ProjectionSearch> searches(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    backend_positions.x[i] = inertial_positions.x[i] - inertial_to_backend_frame_translation.x();
+    backend_positions.y[i] = inertial_positions.y[i] - inertial_to_backend_frame_translation.y();
+    backend_positions.z[i] = inertial_positions.z[i] - inertial_to_backend_frame_translation.z();
+    searches[i] =
+        StartProjectionSearch(road_curve_->ground_curve()->GInverse({backend_positions.x[i], backend_positions.y[i]}));
+  }
+
+  // Same search as BackendFrameToLaneFrame(), run for all the positions in
+  // lockstep. Each iteration evaluates the residuals of the positions whose
+  // search has not finished yet in a single batch, and finished positions
+  // drop out of it.
+  std::vector<std::size_t> pending(size);
+  std::iota(pending.begin(), pending.end(), 0);
+  road_curve::Vector3Batch pending_positions;
+  std::vector<double> pending_p;
+  std::vector<double> g;
+  std::vector<double> g_dot;
+  for (int iteration = 0; iteration < kMaxProjectionIterations && !pending.empty(); ++iteration) {
+    pending_positions.resize(pending.size());
+    pending_p.resize(pending.size());
+    for (std::size_t k = 0; k < pending.size(); ++k) {
+      pending_positions.x[k] = backend_positions.x[pending[k]];
+      pending_positions.y[k] = backend_positions.y[pending[k]];
+      pending_positions.z[k] = backend_positions.z[pending[k]];
+      pending_p[k] = searches[pending[k]].p;
+    }
+    road_curve_->ProjectOnSAxis(pending_positions, pending_p, &g, &g_dot);
+    std::size_t num_pending{0};
+    for (std::size_t k = 0; k < pending.size(); ++k) {
+      if (!StepProjectionSearch(g[k], g_dot[k], &searches[pending[k]])) {
+        pending[num_pending++] = pending[k];
+      }
+    }
+    pending.resize(num_pending);
+  }
+  if (!pending.empty()) {
+    maliput::log()->debug("Lane ", id().string(), ": inverse projection of ", pending.size(),
+                          " positions reached the maximum number of iterations.");
+  }
+
+  std::vector<double> p(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    p[i] = searches[i].p;
+  }
+  road_curve::Vector3Batch unconstrained_prh;
+  road_curve_->ProjectOnRHPlane(backend_positions, p, &unconstrained_prh);
+  std::vector<double> lane_offsets;
+  lane_offset_->f(p, &lane_offsets);
+  // Same saturation as InertialToLaneSegmentPositionBackend() with the Lane
+  // boundaries.
+  lane_positions->resize(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const double s = arc_length_maps().s_from_p(p[i]);
+    const maliput::api::RBounds r_bounds = lane_bounds(s);
+    const double r = maliput::math::saturate(unconstrained_prh.y[i] - lane_offsets[i], r_bounds.min(), r_bounds.max());
+    const maliput::api::HBounds elevation_boundaries = elevation_bounds(s, r);
+    lane_positions->x[i] = s;
+    lane_positions->y[i] = r;
+    lane_positions->z[i] =
+        maliput::math::saturate(unconstrained_prh.z[i], elevation_boundaries.min(), elevation_boundaries.max());
+  }
+
+  road_curve::Vector3Batch nearest_positions;
+  ToInertialPositions(*lane_positions, &nearest_positions);
+  distances->resize(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const double delta_x = inertial_positions.x[i] - nearest_positions.x[i];
+    const double delta_y = inertial_positions.y[i] - nearest_positions.y[i];
+    const double delta_z = inertial_positions.z[i] - nearest_positions.z[i];
+    (*distances)[i] = std::sqrt(delta_x * delta_x + delta_y * delta_y + delta_z * delta_z);
+  }
+  if (statuses != nullptr) {
+    statuses->resize(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      (*statuses)[i] = searches[i].status;
+    }
+  }
+}
+
+Vector3 Lane::BackendFrameToLaneFrame(const Vector3& xyz, const std::optional<double>& p_hint,
+                                      ProjectionStatus* status) const {
+  // A hint is closer than any seed. Otherwise, the GroundCurve inverse seeds
+  // the search: it is exact for lines and it projects angularly on arcs.
+  ProjectionSearch search = StartProjectionSearch(
+      p_hint.has_value() ? p_hint.value() : road_curve_->ground_curve()->GInverse({xyz.x(), xyz.y()}));
+  road_curve::RoadCurve::Frame frame{};
+  bool finished{false};
+  for (int i = 0; i < kMaxProjectionIterations && !finished; ++i) {
+    frame = road_curve_->EvalFrame(search.p);
+    const Vector3 w_delta{xyz - frame.origin};
+    const double g = w_delta.dot(frame.rotation.col(0));
+    const road_curve::RoadCurve::FrameDot frame_dot = road_curve_->EvalFrameDot(search.p);
+    const double g_dot =
+        -frame_dot.origin_dot.dot(frame.rotation.col(0)) + w_delta.dot(frame_dot.rotation_dot.col(0));
+    finished = StepProjectionSearch(g, g_dot, &search);
+  }
+  if (!finished) {
+    // The last iteration moved p after evaluating the frame.
+    frame = road_curve_->EvalFrame(search.p);
+    maliput::log()->debug("Lane ", id().string(), ": inverse projection of [", xyz.x(), ", ", xyz.y(), ", ", xyz.z(),
+                          "] reached the maximum number of iterations.");
+  }
+  if (status != nullptr) {
+    *status = search.status;
+  }
+
+  // The frame at the final p is reused to project the difference onto the
+  // r-axis and the h-axis.
+  const Vector3 w_delta{xyz - frame.origin};
+  return {search.p, frame.rotation.col(1).dot(w_delta) - lane_offset_->f(search.p),
+          frame.rotation.col(2).dot(w_delta)};
+}
+
+Lane::ProjectionSearch Lane::StartProjectionSearch(double p_seed) const {
+  ProjectionSearch search;
+  search.p = maliput::math::saturate(p_seed, p0_, p1_);
+  search.p_min = p0_;
+  search.p_max = p1_;
+  return search;
+}
+
+bool Lane::StepProjectionSearch(double g, double g_dot, ProjectionSearch* search) const {
+  // The inverse of DoToBackendPosition() is the p at which `xyz` - W(p, 0, 0)
+  // is orthogonal to the s-axis of the RoadCurve frame, i.e. the root of
+  //   g(p) = (xyz - origin(p)).dot(s_hat(p))
+  // which is decreasing in the neighborhood of the solution. It is solved with
+  // Newton's method safeguarded by a bracket that shrinks with the sign of g.
+  const double tolerance = road_curve_->linear_tolerance();
+  const double p = search->p;
+  if (g > 0.) {
+    search->p_min = p;
+    search->p_min_evaluated = true;
+  } else {
+    search->p_max = p;
+    search->p_max_evaluated = true;
+  }
+  // The solution lies out of the Lane when g does not change its sign at the
+  // bound towards which it points.
+  if (p == p1_ && g > 0.) {
+    search->status = ProjectionStatus::kSaturatedAtEnd;
+    return true;
+  }
+  if (p == p0_ && g < 0.) {
+    search->status = ProjectionStatus::kSaturatedAtStart;
+    return true;
+  }
+  double p_next = g_dot < 0. ? p - g / g_dot : p;
+  if (std::abs(p_next - p) <= tolerance && g_dot < 0.) {
+    search->status = ProjectionStatus::kConverged;
+    return true;
+  }
+  if (g_dot >= 0. || p_next <= search->p_min || p_next >= search->p_max) {
+    // Newton's step is not reliable, so it jumps to the unexplored bound the
+    // solution points to, or it bisects the bracket.
+    if (g > 0. && !search->p_max_evaluated) {
+      p_next = p1_;
+    } else if (g <= 0. && !search->p_min_evaluated) {
+      p_next = p0_;
+    } else {
+      p_next = (search->p_min + search->p_max) / 2.;
+    }
+  }
+  if (search->p_max - search->p_min <= tolerance) {
+    search->status = ProjectionStatus::kConverged;
+    return true;
+  }
+  search->p = p_next;
+  return false;
 }
 
 void Lane::DoToLanePositionBackend(const maliput::math::Vector3& backend_pos, maliput::api::LanePosition* lane_position,
                                    maliput::math::Vector3* nearest_backend_pos, double* distance) const {
-  InertialToLaneSegmentPositionBackend(kUseLaneBoundaries, backend_pos, lane_position, nearest_backend_pos, distance);
+  InertialToLaneSegmentPositionBackend(kUseLaneBoundaries, backend_pos, std::nullopt /* p_hint */,
+                                       nullptr /* status */, lane_position, nearest_backend_pos, distance);
 }
 
 void Lane::DoToSegmentPositionBackend(const maliput::math::Vector3& backend_pos,
                                       maliput::api::LanePosition* lane_position,
                                       maliput::math::Vector3* nearest_backend_pos, double* distance) const {
-  InertialToLaneSegmentPositionBackend(kUseSegmentBoundaries, backend_pos, lane_position, nearest_backend_pos,
-                                       distance);
+  InertialToLaneSegmentPositionBackend(kUseSegmentBoundaries, backend_pos, std::nullopt /* p_hint */,
+                                       nullptr /* status */, lane_position, nearest_backend_pos, distance);
+}
+
+maliput::api::LanePositionResult Lane::ToLanePosition(const maliput::api::InertialPosition& inertial_pos,
+                                                      const maliput::api::LanePosition& hint,
+                                                      ProjectionStatus* status) const {
+  const Vector3 inertial_to_backend_frame_translation = GetInertialToBackendFrameTranslation(this);
+  const Vector3 backend_pos = inertial_pos.xyz() - inertial_to_backend_frame_translation;
+  const ArcLengthMaps& maps = arc_length_maps();
+  const double p_hint = maps.p_from_s(maliput::math::saturate(hint.s(), 0., maps.length));
+  maliput::api::LanePosition lane_position;
+  Vector3 nearest_backend_pos;
+  double distance{};
+  InertialToLaneSegmentPositionBackend(kUseLaneBoundaries, backend_pos, p_hint, status, &lane_position,
+                                       &nearest_backend_pos, &distance);
+  const maliput::api::InertialPosition nearest_position =
+      maliput::api::InertialPosition::FromXyz(nearest_backend_pos + inertial_to_backend_frame_translation);
+  return {lane_position, nearest_position, distance};
 }
 
 void Lane::InertialToLaneSegmentPositionBackend(bool use_lane_boundaries, const maliput::math::Vector3& backend_pos,
+                                                const std::optional<double>& p_hint, ProjectionStatus* status,
                                                 maliput::api::LanePosition* lane_position,
                                                 maliput::math::Vector3* nearest_backend_pos, double* distance) const {
-  const maliput::math::Vector3 unconstrained_prh{BackendFrameToLaneFrame(backend_pos)};
+  const maliput::math::Vector3 unconstrained_prh{BackendFrameToLaneFrame(backend_pos, p_hint, status)};
   MALIDRIVE_IS_IN_RANGE(unconstrained_prh[0], p0_, p1_);
-  const double s = s_from_p_(unconstrained_prh[0]);
+  const double s = arc_length_maps().s_from_p(unconstrained_prh[0]);
   const maliput::api::RBounds r_bounds = use_lane_boundaries ? lane_bounds(s) : segment_bounds(s);
   const double r = maliput::math::saturate(unconstrained_prh[1], r_bounds.min(), r_bounds.max());
   const maliput::api::HBounds elevation_boundaries = elevation_bounds(s, r);
@@ -226,7 +605,8 @@ void Lane::InertialToLaneSegmentPositionBackend(bool use_lane_boundaries, const
 }
 
 maliput::api::Rotation Lane::DoGetOrientation(const maliput::api::LanePosition& lane_pos) const {
-  const double p = p_from_s_(s_range_validation_(lane_pos.s()));
+  const ArcLengthMaps& maps = arc_length_maps();
+  const double p = maps.p_from_s(maps.s_range_validation(lane_pos.s()));
   const maliput::math::RollPitchYaw rpy =
       road_curve_->Orientation({p, to_reference_r(p, lane_pos.r()), lane_pos.h()}, lane_offset_.get());
   return maliput::api::Rotation::FromRpy(rpy.roll_angle(), rpy.pitch_angle(), rpy.yaw_angle());
@@ -234,7 +614,8 @@ maliput::api::Rotation Lane::DoGetOrientation(const maliput::api::LanePosition&
 
 maliput::api::LanePosition Lane::DoEvalMotionDerivatives(const maliput::api::LanePosition& position,
                                                          const maliput::api::IsoLaneVelocity& velocity) const {
-  const double p = p_from_s_(s_range_validation_(position.s()));
+  const ArcLengthMaps& maps = arc_length_maps();
+  const double p = maps.p_from_s(maps.s_range_validation(position.s()));
   const double r = to_reference_r(p, position.r());
   const double h = position.h();
   // The definition of path-length of a path along σ yields dσ = |∂W/∂p| dp
@@ -29,7 +29,12 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
 
 #include <maliput/api/lane_data.h>
 #include <maliput/geometry_base/lane.h>
@@ -39,6 +44,9 @@
 #include "maliput_malidrive/road_curve/function.h"
 #include "maliput_malidrive/road_curve/road_curve.h"
 #include "maliput_malidrive/road_curve/road_curve_offset.h"
+#include "maliput_malidrive/road_curve/vector3_batch.h"
+#include "maliput_malidrive/xodr/lane.h"
+#include "maliput_malidrive/xodr/road_header.h"
 
 namespace malidrive {
 
@@ -47,10 +55,24 @@ namespace malidrive {
 /// road_curve::Function. Lane's width varies with `s`.
 ///
 /// In maps an XODR Lane within a certain XODR LaneSection.
+///
+/// Once constructed, all const queries are thread-safe and may be called
+/// concurrently on the same instance.
 class Lane : public maliput::geometry_base::Lane {
  public:
   MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(Lane);
 
+  /// Describes the outcome of projecting a point into the Lane.
+  enum class ProjectionStatus {
+    kConverged,             ///< The projection lies within the Lane.
+    kSaturatedAtStart,      ///< The projection lies before the start of the
+                            ///< Lane, so the start is used.
+    kSaturatedAtEnd,        ///< The projection lies after the end of the Lane,
+                            ///< so the end is used.
+    kMaxIterationsReached,  ///< The search did not converge. The last
+                            ///< iteration is used.
+  };
+
   /// Constructs a Lane.
   ///
   /// @param id Lane's ID.
@@ -74,7 +96,7 @@ class Lane : public maliput::geometry_base::Lane {
   ///        matches the finish of the Lane.
   /// @note When the ground curve's arc length in range `p1` - `p0` is less than
   ///       `road_curve->linear_tolerance()`, an instance will not host a
-  ///       RoadCurveOffset to populate `p_from_s_` and `s_from_p_`. Instead,
+  ///       RoadCurveOffset to map back and forth `s` and `p` parameters. Instead,
   ///       it will create linear functions to convert back and forth `s` and
   ///       `p` parameters.
   /// @throws maliput::common::assertion_error When @p xodr_track is negative.
@@ -87,6 +109,75 @@ class Lane : public maliput::geometry_base::Lane {
        const road_curve::RoadCurve* road_curve, std::unique_ptr<road_curve::Function> lane_width,
        std::unique_ptr<road_curve::Function> lane_offset, double p0, double p1);
 
+  /// Constructs a Lane whose @f$ s(p) @f$ and @f$ p(s) @f$ mappings were
+  /// already computed, e.g. by a road_curve::JointRoadCurveOffset that
+  /// integrated all the Lanes of a Segment at once.
+  ///
+  /// See the other constructor for the rest of the parameters.
+  ///
+  /// @param s_from_p A functor that maps @f$ p @f$ in [ @p p0, @p p1 ] to the
+  ///        LANE Frame `s` coordinate.
+  /// @param p_from_s The inverse functor of @p s_from_p.
+  /// @note When any of @p s_from_p or @p p_from_s is empty, this constructor
+  ///       behaves like the other one and builds a RoadCurveOffset. When the
+  ///       ground curve's arc length in range `p1` - `p0` is less than
+  ///       `road_curve->linear_tolerance()`, both functors are ignored and
+  ///       linear functions are used instead.
+  /// @throws maliput::common::assertion_error Under the same conditions the
+  ///         other constructor throws.
+  Lane(const maliput::api::LaneId& id, int xodr_track, int xodr_lane_id, const maliput::api::HBounds& elevation_bounds,
+       const road_curve::RoadCurve* road_curve, std::unique_ptr<road_curve::Function> lane_width,
+       std::unique_ptr<road_curve::Function> lane_offset, double p0, double p1,
+       std::function<double(double)> s_from_p, std::function<double(double)> p_from_s);
+
+  /// Functors that map back and forth the @f$ p @f$ parameter of the
+  /// road_curve::RoadCurve and the LANE Frame `s` coordinate.
+  struct ArcLengthFunctions {
+    /// Maps @f$ p @f$ to `s`.
+    std::function<double(double)> s_from_p{};
+    /// Maps `s` to @f$ p @f$.
+    std::function<double(double)> p_from_s{};
+    /// Maps each element of its first argument, a batch of `s` values, to
+    /// @f$ p @f$ into its second argument, which it resizes. It is optional:
+    /// when empty, `p_from_s` is evaluated for each element.
+    std::function<void(const std::vector<double>&, std::vector<double>*)> p_from_s_batch{};
+  };
+
+  /// Constructs a Lane whose @f$ s(p) @f$ and @f$ p(s) @f$ mappings were
+  /// already computed.
+  ///
+  /// Same as the constructor that takes `s_from_p` and `p_from_s` but it also
+  /// takes the optional batched @f$ p(s) @f$ mapping. See ArcLengthFunctions.
+  ///
+  /// @param arc_length_functions The mappings.
+  /// @throws maliput::common::assertion_error Under the same conditions the
+  ///         first constructor throws.
+  Lane(const maliput::api::LaneId& id, int xodr_track, int xodr_lane_id, const maliput::api::HBounds& elevation_bounds,
+       const road_curve::RoadCurve* road_curve, std::unique_ptr<road_curve::Function> lane_width,
+       std::unique_ptr<road_curve::Function> lane_offset, double p0, double p1,
+       ArcLengthFunctions arc_length_functions);
+
+  /// Constructs a Lane whose @f$ s(p) @f$ and @f$ p(s) @f$ mappings are built
+  /// on the first query that needs them, e.g. length(), lane_bounds() or
+  /// ToInertialPosition(). Topological queries, like the ID, the adjacent
+  /// Lanes or the BranchPoints, don't build them.
+  ///
+  /// See the first constructor for the rest of the parameters.
+  ///
+  /// @param arc_length_functions_builder It is called at most once, in a
+  ///        thread-safe manner, to get the mappings. When any of the returned
+  ///        functors is empty, a RoadCurveOffset is built instead. When it
+  ///        throws, the exception is propagated to the query and the next
+  ///        query tries again.
+  /// @throws maliput::common::assertion_error Under the same conditions the
+  ///         first constructor throws.
+  /// @throws maliput::common::assertion_error When
+  ///         @p arc_length_functions_builder is empty.
+  Lane(const maliput::api::LaneId& id, int xodr_track, int xodr_lane_id, const maliput::api::HBounds& elevation_bounds,
+       const road_curve::RoadCurve* road_curve, std::unique_ptr<road_curve::Function> lane_width,
+       std::unique_ptr<road_curve::Function> lane_offset, double p0, double p1,
+       std::function<ArcLengthFunctions()> arc_length_functions_builder);
+
   /// @return The OpenDRIVE Road Id, which is also referred to as Track Id. It
   ///         is a non-negative number.
   int get_track() const { return xodr_track_; }
@@ -102,6 +193,32 @@ class Lane : public maliput::geometry_base::Lane {
   ///         lane is part of.
   double get_track_s_end() const { return p1_; }
 
+  /// @return The XODR Road this lane was built from, or nullptr when it has not
+  ///         been set. See SetXodrLane().
+  const xodr::RoadHeader* get_xodr_road_header() const { return xodr_road_header_; }
+
+  /// @return The XODR Lane this lane was built from, or nullptr when it has not
+  ///         been set. See SetXodrLane().
+  const xodr::Lane* get_xodr_lane() const { return xodr_lane_; }
+
+  /// @return The arc length mappings of this lane when they were provided at
+  ///         construction, e.g. out of a road_curve::JointRoadCurveOffset, and
+  ///         they have already been built. Otherwise, std::nullopt. The
+  ///         returned functors do not refer to this lane, so another Lane with
+  ///         the same geometry may be constructed with them and outlive it.
+  std::optional<ArcLengthFunctions> GetArcLengthFunctions() const;
+
+  /// Sets the XODR Road and Lane this lane was built from, so rule builders can
+  /// reach their attributes without looking them up by ID.
+  ///
+  /// @param xodr_road_header The XODR Road. It must not be nullptr and it must
+  ///        outlive this lane.
+  /// @param xodr_lane The XODR Lane. It must not be nullptr and it must
+  ///        outlive this lane.
+  /// @throws maliput::common::assertion_error When @p xodr_road_header or
+  ///         @p xodr_lane are nullptr.
+  void SetXodrLane(const xodr::RoadHeader* xodr_road_header, const xodr::Lane* xodr_lane);
+
   /// Converts `lane_s` coordinate in the LANE Frame to the TRACK Frame `s`
   /// coordinate the ODRM uses.
   ///
@@ -109,7 +226,7 @@ class Lane : public maliput::geometry_base::Lane {
   ///        [0; maliput::api::Lane::length()].
   /// @return The TRACK Frame `s` coordinate which matches `lane_s`.
   /// @throws maliput::common::assertion_error When @p lane_s is not in range.
-  double TrackSFromLaneS(double lane_s) const { return p_from_s_(lane_s); }
+  double TrackSFromLaneS(double lane_s) const { return arc_length_maps().p_from_s(lane_s); }
 
   /// Converts `track_s` coordinate in the TRACK Frame `s` coordinate the ODRM uses
   /// to the `s` coordinate in the LANE frame.
@@ -118,12 +235,103 @@ class Lane : public maliput::geometry_base::Lane {
   ///        [0; `get_track_s_end()` - get_track_s_start()].
   /// @return The LANE Frame `s` coordinate which matches `track_s`.
   /// @throws maliput::common::assertion_error When @p track_s is not in range.
-  double LaneSFromTrackS(double track_s) const { return s_from_p_(track_s); }
+  double LaneSFromTrackS(double track_s) const { return arc_length_maps().s_from_p(track_s); }
+
+  /// Estimates LaneSFromTrackS() without building the arc length mappings, so
+  /// queries made at load time, e.g. by rule builders, do not integrate lanes
+  /// built with lazy construction. When the mappings are already built, it is
+  /// LaneSFromTrackS().
+  ///
+  /// The estimate is a quadrature of the centerline speed up to a hundredth of
+  /// the linear tolerance, so it is within the linear tolerance of
+  /// LaneSFromTrackS().
+  ///
+  /// @param track_s The TRACK Frame `s` coordinate to convert. It is saturated
+  ///        to the range of this lane.
+  /// @return The LANE Frame `s` coordinate which matches `track_s`.
+  double EstimateLaneSFromTrackS(double track_s) const;
+
+  /// @return EstimateLaneSFromTrackS() at the end of this lane, i.e. an
+  ///         estimate of maliput::api::Lane::length(). It is computed once.
+  double EstimateLength() const;
+
+  using maliput::api::Lane::ToLanePosition;
+
+  /// Determines the LanePosition corresponding to InertialPosition
+  /// @p inertial_pos, using @p hint as the initial guess.
+  ///
+  /// Tracked objects move little between consecutive queries, so their
+  /// previous LanePosition is a good initial guess. The search starts at the
+  /// @f$ p @f$ that matches `hint.s()` instead of the GroundCurve inverse,
+  /// and it usually converges in one or two iterations. Results are the same
+  /// as maliput::api::Lane::ToLanePosition() as long as @p hint is in the
+  /// neighborhood of the solution.
+  ///
+  /// @param inertial_pos The InertialPosition to project into this Lane.
+  /// @param hint A LanePosition near the solution. Its `s` coordinate is
+  ///        saturated to [0, length()].
+  /// @param status When it is not nullptr, it is filled with the outcome of
+  ///        the projection.
+  /// @returns The LanePositionResult. See maliput::api::Lane::ToLanePosition().
+  maliput::api::LanePositionResult ToLanePosition(const maliput::api::InertialPosition& inertial_pos,
+                                                  const maliput::api::LanePosition& hint,
+                                                  ProjectionStatus* status = nullptr) const;
+
+  /// Computes the InertialPosition of each of @p lane_positions.
+  ///
+  /// It is equivalent to calling maliput::api::Lane::ToInertialPosition() once
+  /// per position, but it is meant for large batches on the same Lane, e.g.
+  /// trajectory rollouts. The @f$ p(s) @f$ mapping, the lateral offsets and
+  /// road_curve::RoadCurve::W() are evaluated with batched kernels.
+  ///
+  /// @param lane_positions The `(s, r, h)` LanePositions. It must be
+  ///        consistent.
+  /// @param inertial_positions The `(x, y, z)` InertialPositions. It is
+  ///        resized to `lane_positions.size()`.
+  /// @throws maliput::common::assertion_error When @p lane_positions is not
+  ///         consistent.
+  /// @throws maliput::common::assertion_error When @p inertial_positions is
+  ///         nullptr.
+  /// @throws maliput::common::assertion_error When any s-coordinate is not in
+  ///         [0; length()].
+  void ToInertialPositions(const road_curve::Vector3Batch& lane_positions,
+                           road_curve::Vector3Batch* inertial_positions) const;
+
+  /// Projects each of @p inertial_positions into this Lane.
+  ///
+  /// It is equivalent to calling maliput::api::Lane::ToLanePosition() once
+  /// per position, but it is meant for many positions against the same Lane,
+  /// e.g. labeling a point cloud. The Newton iterations of all the positions
+  /// run in lockstep: each iteration evaluates the residuals of the positions
+  /// that have not converged yet with batched road_curve::RoadCurve kernels.
+  ///
+  /// @param inertial_positions The `(x, y, z)` InertialPositions. It must be
+  ///        consistent.
+  /// @param lane_positions The `(s, r, h)` LanePositions. It is resized to
+  ///        `inertial_positions.size()`.
+  /// @param distances The distances between each position and its
+  ///        projection. It is resized to `inertial_positions.size()`.
+  /// @param statuses When it is not nullptr, it is resized to
+  ///        `inertial_positions.size()` and filled with the outcome of each
+  ///        projection.
+  /// @throws maliput::common::assertion_error When @p inertial_positions is
+  ///         not consistent.
+  /// @throws maliput::common::assertion_error When @p lane_positions or
+  ///         @p distances are nullptr.
+  void ToLanePositions(const road_curve::Vector3Batch& inertial_positions, road_curve::Vector3Batch* lane_positions,
+                       std::vector<double>* distances, std::vector<ProjectionStatus>* statuses = nullptr) const;
+
+  /// @return The road_curve::Function describing the width of the lane.
+  const road_curve::Function* lane_width() const { return lane_width_.get(); }
+
+  /// @return The road_curve::Function describing the offset of the lane's
+  ///         centerline with respect to the road_curve::RoadCurve.
+  const road_curve::Function* lane_offset() const { return lane_offset_.get(); }
 
  private:
   // maliput::api::Lane private virtual method implementations.
   //@{
-  double do_length() const override { return length_; }
+  double do_length() const override { return arc_length_maps().length; }
   maliput::api::RBounds do_lane_bounds(double s) const override;
   maliput::api::RBounds do_segment_bounds(double s) const override;
   maliput::api::HBounds do_elevation_bounds(double, double) const override { return elevation_bounds_; }
@@ -141,7 +349,11 @@ class Lane : public maliput::geometry_base::Lane {
                                                      const maliput::api::IsoLaneVelocity& velocity) const override;
   //@}
 
+  // Projects `backend_pos` into the Lane or Segment volume. When `p_hint` has
+  // a value, it seeds the search instead of the GroundCurve inverse. When
+  // `status` is not nullptr, it is filled with the outcome of the projection.
   void InertialToLaneSegmentPositionBackend(bool use_lane_boundaries, const maliput::math::Vector3& backend_pos,
+                                            const std::optional<double>& p_hint, ProjectionStatus* status,
                                             maliput::api::LanePosition* lane_position,
                                             maliput::math::Vector3* nearest_backend_pos, double* distance) const;
 
@@ -154,7 +366,74 @@ class Lane : public maliput::geometry_base::Lane {
   double to_reference_r(double p, double r) const { return r + lane_offset_->f(p); }
 
   // @returns The prh coordinate in LANE Frame from `xyz` in the Backend Frame.
-  maliput::math::Vector3 BackendFrameToLaneFrame(const maliput::math::Vector3& xyz) const;
+  //          p is within [p0_, p1_]. When `p_hint` has a value, it is used as
+  //          the initial guess of p. When `status` is not nullptr, it is
+  //          filled with the outcome of the projection.
+  maliput::math::Vector3 BackendFrameToLaneFrame(const maliput::math::Vector3& xyz,
+                                                 const std::optional<double>& p_hint, ProjectionStatus* status) const;
+
+  // Arc length of the Lane and the mappings between its `s` coordinate and the
+  // `p` parameter of `road_curve_`.
+  struct ArcLengthMaps {
+    double length{};
+    std::function<double(double)> p_from_s{};
+    std::function<double(double)> s_from_p{};
+    // Same as `p_from_s` for a batch of `s` values. See ArcLengthFunctions.
+    std::function<void(const std::vector<double>&, std::vector<double>*)> p_from_s_batch{};
+    // Validates and adjusts `s` coordinates to [0, length].
+    std::function<double(double)> s_range_validation{};
+  };
+
+  // @returns The ArcLengthMaps. They are built on the first call.
+  const ArcLengthMaps& arc_length_maps() const {
+    if (!arc_length_maps_built_.load(std::memory_order_acquire)) {
+      BuildArcLengthMaps();
+    }
+    return arc_length_maps_;
+  }
+
+  // Builds #arc_length_maps_ out of #arc_length_functions_builder_. It is
+  // thread-safe and only the first call has effect.
+  void BuildArcLengthMaps() const;
+
+  // @returns The fraction of road_curve::RoadCurve::LMax() that belongs to
+  //          this lane.
+  double LaneGroundCurveLMax() const {
+    return road_curve_->LMax() * (p1_ - p0_) / (road_curve_->p1() - road_curve_->p0());
+  }
+
+  // @returns The arc length of the centerline of this lane in [p0_, `p`]
+  //          integrated with an adaptive Simpson quadrature.
+  double IntegrateArcLength(double p) const;
+
+  // State of the search of BackendFrameToLaneFrame() for a single position.
+  struct ProjectionSearch {
+    // Current iterate.
+    double p{};
+    // Bracket of the solution.
+    double p_min{};
+    double p_max{};
+    // Whether g has been evaluated at `p_min` and `p_max`. The bounds of the
+    // Lane are only evaluated when an iteration is about to step out of them.
+    bool p_min_evaluated{false};
+    bool p_max_evaluated{false};
+    ProjectionStatus status{ProjectionStatus::kMaxIterationsReached};
+  };
+
+  // @returns A ProjectionSearch over the whole Lane starting at `p_seed`
+  //          saturated to [p0_, p1_].
+  ProjectionSearch StartProjectionSearch(double p_seed) const;
+
+  // Runs one iteration of `search` with `g` and `g_dot` evaluated at
+  // `search->p`. When the search has not finished, `search->p` is moved to the
+  // next iterate.
+  // @returns True when the search has finished. `search->status` holds the
+  //          outcome.
+  bool StepProjectionSearch(double g, double g_dot, ProjectionSearch* search) const;
+
+  // Maximum number of iterations of BackendFrameToLaneFrame. Bisection steps
+  // halve the bracket, so it covers the Lane length down to the tolerance.
+  static constexpr int kMaxProjectionIterations{64};
 
   const int xodr_track_{};
   const int xodr_lane_id_{};
@@ -162,13 +441,26 @@ class Lane : public maliput::geometry_base::Lane {
   const road_curve::RoadCurve* road_curve_{};
   const double p0_{};
   const double p1_{};
-  const road_curve::RoadCurveOffset road_curve_offset_;
+  const xodr::RoadHeader* xodr_road_header_{};
+  const xodr::Lane* xodr_lane_{};
   std::unique_ptr<road_curve::Function> lane_width_{};
   std::unique_ptr<road_curve::Function> lane_offset_{};
-  double length_{};
-  std::function<double(double)> p_from_s_{};
-  std::function<double(double)> s_from_p_{};
-  std::function<double(double)> s_range_validation_{};
+  // @{ The arc length mappings are built once, by the first query that needs
+  //    them. `arc_length_functions_builder_` is released afterwards.
+  mutable std::function<ArcLengthFunctions()> arc_length_functions_builder_{};
+  mutable std::once_flag arc_length_maps_flag_;
+  mutable std::atomic<bool> arc_length_maps_built_{false};
+  // Whether the arc length mappings came from `arc_length_functions_builder_`.
+  mutable bool arc_length_functions_provided_{false};
+  // Only built when the arc length mappings are not provided by
+  // `arc_length_functions_builder_`.
+  mutable std::unique_ptr<road_curve::RoadCurveOffset> road_curve_offset_;
+  mutable ArcLengthMaps arc_length_maps_{};
+  // @}
+  // @{ EstimateLength() is computed once, by its first call.
+  mutable std::once_flag estimated_length_flag_;
+  mutable double estimated_length_{};
+  // @}
 };
 
 }  // namespace malidrive
@@ -0,0 +1,189 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/base/lane_graph.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <maliput/api/branch_point.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/segment.h>
+
+namespace malidrive {
+
+LaneGraph::Workspace::Workspace(const LaneGraph& lane_graph)
+    : num_nodes_(lane_graph.num_nodes()),
+      costs_(lane_graph.num_nodes(), std::numeric_limits<double>::infinity()),
+      parents_(lane_graph.num_nodes(), -1),
+      stamps_(lane_graph.num_nodes(), 0) {
+  // Every expansion pushes at most one entry per edge, plus the start node.
+  heap_.reserve(lane_graph.num_edges() + 1);
+}
+
+LaneGraph::LaneGraph(const maliput::api::RoadGeometry& road_geometry, double lane_change_penalty) {
+  MALIDRIVE_THROW_UNLESS(lane_change_penalty >= 0.);
+  for (int i = 0; i < road_geometry.num_junctions(); ++i) {
+    const maliput::api::Junction* junction = road_geometry.junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const maliput::api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        const maliput::api::Lane* lane = segment->lane(k);
+        lane_indices_.emplace(lane->id(), static_cast<int>(lanes_.size()));
+        lanes_.push_back(lane);
+        lane_lengths_.push_back(lane->length());
+      }
+    }
+  }
+
+  entry_points_.resize(num_nodes());
+  for (int lane_index = 0; lane_index < num_lanes(); ++lane_index) {
+    const maliput::api::Lane* lane = lanes_[lane_index];
+    entry_points_[NodeIndex(lane_index, maliput::api::LaneEnd::kStart)] =
+        lane->ToInertialPosition(maliput::api::LanePosition(0., 0., 0.)).xyz();
+    entry_points_[NodeIndex(lane_index, maliput::api::LaneEnd::kFinish)] =
+        lane->ToInertialPosition(maliput::api::LanePosition(lane->length(), 0., 0.)).xyz();
+  }
+
+  edge_offsets_.reserve(num_nodes() + 1);
+  edge_offsets_.push_back(0);
+  const auto add_edge = [this](int target, double cost, EdgeType type) {
+    edge_targets_.push_back(target);
+    edge_costs_.push_back(cost);
+    edge_types_.push_back(type);
+  };
+  for (int node = 0; node < num_nodes(); ++node) {
+    const int lane_index = LaneIndexOf(node);
+    const maliput::api::Lane* lane = lanes_[lane_index];
+    const maliput::api::LaneEnd::Which entry_end = EntryEndOf(node);
+    const maliput::api::LaneEnd::Which exit_end =
+        entry_end == maliput::api::LaneEnd::kStart ? maliput::api::LaneEnd::kFinish : maliput::api::LaneEnd::kStart;
+    const maliput::api::LaneEndSet* ongoing_lanes = lane->GetOngoingBranches(exit_end);
+    if (ongoing_lanes != nullptr) {
+      for (int i = 0; i < ongoing_lanes->size(); ++i) {
+        const maliput::api::LaneEnd& lane_end = ongoing_lanes->get(i);
+        add_edge(NodeIndex(LaneIndex(lane_end.lane->id()), lane_end.end), lane_lengths_[lane_index],
+                 EdgeType::kOngoing);
+      }
+    }
+    const auto add_lane_change_edge = [&](const maliput::api::Lane* adjacent_lane, EdgeType type) {
+      if (adjacent_lane == nullptr) {
+        return;
+      }
+      const int target = NodeIndex(LaneIndex(adjacent_lane->id()), entry_end);
+      add_edge(target, lane_change_penalty + (entry_points_[target] - entry_points_[node]).norm(), type);
+    };
+    add_lane_change_edge(lane->to_left(), EdgeType::kLaneChangeLeft);
+    add_lane_change_edge(lane->to_right(), EdgeType::kLaneChangeRight);
+    edge_offsets_.push_back(static_cast<int>(edge_targets_.size()));
+  }
+}
+
+int LaneGraph::LaneIndex(const maliput::api::LaneId& lane_id) const {
+  const auto it = lane_indices_.find(lane_id);
+  MALIDRIVE_THROW_UNLESS(it != lane_indices_.end());
+  return it->second;
+}
+
+const maliput::api::Lane* LaneGraph::lane(int lane_index) const {
+  MALIDRIVE_THROW_UNLESS(lane_index >= 0 && lane_index < num_lanes());
+  return lanes_[lane_index];
+}
+
+double LaneGraph::lane_length(int lane_index) const {
+  MALIDRIVE_THROW_UNLESS(lane_index >= 0 && lane_index < num_lanes());
+  return lane_lengths_[lane_index];
+}
+
+double LaneGraph::Heuristic(int node, int goal_lane_index) const {
+  const maliput::math::Vector3& entry_point = entry_points_[node];
+  return std::min(
+      (entry_points_[NodeIndex(goal_lane_index, maliput::api::LaneEnd::kStart)] - entry_point).norm(),
+      (entry_points_[NodeIndex(goal_lane_index, maliput::api::LaneEnd::kFinish)] - entry_point).norm());
+}
+
+std::optional<double> LaneGraph::FindRoute(int start_node, int goal_lane_index, RouteAlgorithm algorithm,
+                                           Workspace* workspace, std::vector<int>* route) const {
+  MALIDRIVE_THROW_UNLESS(start_node >= 0 && start_node < num_nodes());
+  MALIDRIVE_THROW_UNLESS(goal_lane_index >= 0 && goal_lane_index < num_lanes());
+  MALIDRIVE_THROW_UNLESS(workspace != nullptr);
+  MALIDRIVE_THROW_UNLESS(route != nullptr);
+  MALIDRIVE_THROW_UNLESS(workspace->num_nodes_ == num_nodes());
+
+  using HeapEntry = Workspace::HeapEntry;
+  // Keeps the lowest `f` at the front of the heap.
+  const auto greater_f = [](const HeapEntry& lhs, const HeapEntry& rhs) { return lhs.f > rhs.f; };
+  const auto heuristic = [&](int node) {
+    return algorithm == RouteAlgorithm::kAStar ? Heuristic(node, goal_lane_index) : 0.;
+  };
+  // Stamps are reset only when the counter wraps around.
+  if (++workspace->stamp_ == 0) {
+    std::fill(workspace->stamps_.begin(), workspace->stamps_.end(), 0);
+    workspace->stamp_ = 1;
+  }
+  const unsigned int stamp = workspace->stamp_;
+  std::vector<HeapEntry>& heap = workspace->heap_;
+  heap.clear();
+  route->clear();
+
+  workspace->costs_[start_node] = 0.;
+  workspace->parents_[start_node] = -1;
+  workspace->stamps_[start_node] = stamp;
+  heap.push_back({heuristic(start_node), 0., start_node});
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), greater_f);
+    const HeapEntry entry = heap.back();
+    heap.pop_back();
+    if (entry.g > workspace->costs_[entry.node]) {
+      continue;
+    }
+    if (LaneIndexOf(entry.node) == goal_lane_index) {
+      for (int node = entry.node; node != -1; node = workspace->parents_[node]) {
+        route->push_back(node);
+      }
+      std::reverse(route->begin(), route->end());
+      return entry.g;
+    }
+    for (int edge_index = edges_begin(entry.node); edge_index < edges_end(entry.node); ++edge_index) {
+      const int target = edge_targets_[edge_index];
+      const double cost = entry.g + edge_costs_[edge_index];
+      if (workspace->stamps_[target] == stamp && cost >= workspace->costs_[target]) {
+        continue;
+      }
+      workspace->costs_[target] = cost;
+      workspace->parents_[target] = entry.node;
+      workspace->stamps_[target] = stamp;
+      heap.push_back({cost + heuristic(target), cost, target});
+      std::push_heap(heap.begin(), heap.end(), greater_f);
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace malidrive
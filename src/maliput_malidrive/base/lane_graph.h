@@ -0,0 +1,227 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_malidrive/common/macros.h"
+
+namespace malidrive {
+
+/// Compact adjacency of the Lanes of a RoadGeometry in compressed sparse row
+/// (CSR) format, and a router over it.
+///
+/// Lanes are identified by dense integer indices in [0, num_lanes()). As
+/// Lanes can be driven in both directions, each Lane has two nodes, one per
+/// LaneEnd the Lane is entered through. See NodeIndex().
+///
+/// Edges leaving a node are:
+/// - EdgeType::kOngoing: to the ongoing Lanes at the opposite LaneEnd. Its
+///   cost is the length of the Lane, which is driven entirely.
+/// - EdgeType::kLaneChangeLeft and EdgeType::kLaneChangeRight: to the Lane to
+///   the left or to the right that is entered through the same LaneEnd. Its
+///   cost is the lane change penalty plus the distance between both Lanes'
+///   entry points.
+///
+/// All the Lanes are included regardless of their type.
+class LaneGraph {
+ public:
+  MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(LaneGraph);
+
+  /// Default penalty of a lane change. It is expressed as an equivalent
+  /// driven distance.
+  static constexpr double kDefaultLaneChangePenalty{10.};  // [m]
+
+  /// Types of edges.
+  enum class EdgeType {
+    kOngoing,          ///< Continues into an ongoing Lane.
+    kLaneChangeLeft,   ///< Changes to the Lane to the left.
+    kLaneChangeRight,  ///< Changes to the Lane to the right.
+  };
+
+  /// Algorithms to find a route.
+  enum class RouteAlgorithm {
+    kDijkstra,  ///< Dijkstra's algorithm.
+    kAStar,     ///< A* with the Euclidean distance to the goal as heuristic.
+  };
+
+  /// Holds the memory FindRoute() needs, so it can be reused across queries
+  /// without allocating. A Workspace must only be used by one thread at a
+  /// time.
+  class Workspace {
+   public:
+    MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(Workspace);
+
+    /// Constructs a Workspace sized for @p lane_graph.
+    explicit Workspace(const LaneGraph& lane_graph);
+
+   private:
+    friend class LaneGraph;
+
+    // Entry of the open set.
+    struct HeapEntry {
+      // Cost plus heuristic.
+      double f{};
+      // Cost when the entry was pushed. The entry is stale when it is greater
+      // than the current cost of `node`.
+      double g{};
+      int node{};
+    };
+
+    // Number of nodes of the LaneGraph this Workspace is sized for.
+    int num_nodes_{};
+    // Cost to reach each node.
+    std::vector<double> costs_;
+    // Previous node in the route to each node.
+    std::vector<int> parents_;
+    // A node has been reached in the current query when its stamp equals
+    // `stamp_`. It avoids clearing `costs_` and `parents_` on every query.
+    std::vector<unsigned int> stamps_;
+    unsigned int stamp_{0};
+    // Open set, kept as a binary min-heap on `f`.
+    std::vector<HeapEntry> heap_;
+  };
+
+  /// Constructs a LaneGraph out of @p road_geometry.
+  ///
+  /// Lanes are indexed in the order they are found by visiting Junctions,
+  /// Segments and Lanes by index.
+  ///
+  /// @param road_geometry The RoadGeometry. Its BranchPoints must have been
+  ///        built.
+  /// @param lane_change_penalty The penalty of a lane change. It must be
+  ///        non-negative.
+  /// @throws maliput::common::assertion_error When @p lane_change_penalty is
+  ///         negative.
+  LaneGraph(const maliput::api::RoadGeometry& road_geometry, double lane_change_penalty);
+
+  /// @returns The number of Lanes.
+  int num_lanes() const { return static_cast<int>(lanes_.size()); }
+
+  /// @returns The number of nodes, which doubles the number of Lanes.
+  int num_nodes() const { return 2 * num_lanes(); }
+
+  /// @returns The number of edges.
+  int num_edges() const { return static_cast<int>(edge_targets_.size()); }
+
+  /// @returns The index of the Lane whose ID is @p lane_id.
+  /// @throws maliput::common::assertion_error When there is no such Lane.
+  int LaneIndex(const maliput::api::LaneId& lane_id) const;
+
+  /// @returns The Lane at @p lane_index.
+  /// @throws maliput::common::assertion_error When @p lane_index is out of
+  ///         range.
+  const maliput::api::Lane* lane(int lane_index) const;
+
+  /// @returns The length of the Lane at @p lane_index.
+  /// @throws maliput::common::assertion_error When @p lane_index is out of
+  ///         range.
+  double lane_length(int lane_index) const;
+
+  /// @returns The node of the Lane at @p lane_index entered through
+  ///          @p entry_end.
+  static int NodeIndex(int lane_index, maliput::api::LaneEnd::Which entry_end) {
+    return 2 * lane_index + (entry_end == maliput::api::LaneEnd::kStart ? 0 : 1);
+  }
+
+  /// @returns The index of the Lane of @p node.
+  static int LaneIndexOf(int node) { return node / 2; }
+
+  /// @returns The LaneEnd @p node is entered through.
+  static maliput::api::LaneEnd::Which EntryEndOf(int node) {
+    return node % 2 == 0 ? maliput::api::LaneEnd::kStart : maliput::api::LaneEnd::kFinish;
+  }
+
+  /// @{ Edges leaving @p node are in [edges_begin(node), edges_end(node)).
+  int edges_begin(int node) const { return edge_offsets_[node]; }
+  int edges_end(int node) const { return edge_offsets_[node + 1]; }
+  /// @}
+
+  /// @{ Accessors of the edge at @p edge_index.
+  int edge_target(int edge_index) const { return edge_targets_[edge_index]; }
+  double edge_cost(int edge_index) const { return edge_costs_[edge_index]; }
+  EdgeType edge_type(int edge_index) const { return edge_types_[edge_index]; }
+  /// @}
+
+  /// Finds the cheapest route from @p start_node to any node of the Lane at
+  /// @p goal_lane_index.
+  ///
+  /// Once @p workspace is constructed, this method does not allocate memory
+  /// as long as @p route has enough capacity to hold the route.
+  ///
+  /// @param start_node The node to start from.
+  /// @param goal_lane_index The index of the Lane to reach.
+  /// @param algorithm The RouteAlgorithm to use. Both yield the same cost.
+  /// @param workspace The Workspace. It must not be nullptr and it must be
+  ///        constructed for this LaneGraph.
+  /// @param route The nodes of the route, from @p start_node to the goal
+  ///        node. It must not be nullptr. It is cleared when there is no
+  ///        route.
+  /// @returns The cost of the route, or std::nullopt when the goal is not
+  ///          reachable.
+  /// @throws maliput::common::assertion_error When @p start_node or
+  ///         @p goal_lane_index are out of range.
+  /// @throws maliput::common::assertion_error When @p workspace or @p route
+  ///         are nullptr.
+  /// @throws maliput::common::assertion_error When @p workspace was not
+  ///         constructed for this LaneGraph.
+  std::optional<double> FindRoute(int start_node, int goal_lane_index, RouteAlgorithm algorithm, Workspace* workspace,
+                                  std::vector<int>* route) const;
+
+ private:
+  // @returns The heuristic of `node` towards the Lane at `goal_lane_index`: the
+  //          distance from the entry point of `node` to the closest entry point
+  //          of the goal Lane. It never overestimates the cost because every
+  //          edge costs at least the distance between the entry points it
+  //          joins.
+  double Heuristic(int node, int goal_lane_index) const;
+
+  std::vector<const maliput::api::Lane*> lanes_;
+  std::unordered_map<maliput::api::LaneId, int> lane_indices_;
+  std::vector<double> lane_lengths_;
+  // InertialFrame position of the centerline where each node is entered.
+  std::vector<maliput::math::Vector3> entry_points_;
+  // @{ CSR adjacency. Edges leaving node `i` are in
+  //    [edge_offsets_[i], edge_offsets_[i + 1]).
+  std::vector<int> edge_offsets_;
+  std::vector<int> edge_targets_;
+  std::vector<double> edge_costs_;
+  std::vector<EdgeType> edge_types_;
+  // @}
+};
+
+}  // namespace malidrive
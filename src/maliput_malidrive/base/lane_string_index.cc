@@ -0,0 +1,130 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/base/lane_string_index.h"
+
+#include <algorithm>
+
+#include <maliput/math/saturate.h>
+
+namespace malidrive {
+
+LaneStringIndex::LaneStringIndex(const LaneGraph& lane_graph) : lane_graph_(&lane_graph) {
+  const int num_nodes = lane_graph_->num_nodes();
+  // Single ongoing node of each node, or -1 when it has none or several.
+  std::vector<int> unique_ongoing_nodes(num_nodes, -1);
+  std::vector<int> num_incoming_nodes(num_nodes, 0);
+  for (int node = 0; node < num_nodes; ++node) {
+    int num_ongoing_nodes{0};
+    for (int edge_index = lane_graph_->edges_begin(node); edge_index < lane_graph_->edges_end(node); ++edge_index) {
+      if (lane_graph_->edge_type(edge_index) == LaneGraph::EdgeType::kOngoing) {
+        unique_ongoing_nodes[node] = lane_graph_->edge_target(edge_index);
+        ++num_ongoing_nodes;
+        ++num_incoming_nodes[lane_graph_->edge_target(edge_index)];
+      }
+    }
+    if (num_ongoing_nodes != 1) {
+      unique_ongoing_nodes[node] = -1;
+    }
+  }
+  // @returns The node that continues the lane string of `node`, or -1 when the lane string ends at `node`.
+  const auto next_node = [&](int node) {
+    const int ongoing_node = unique_ongoing_nodes[node];
+    return ongoing_node != -1 && num_incoming_nodes[ongoing_node] == 1 ? ongoing_node : -1;
+  };
+  std::vector<bool> continues_a_lane_string(num_nodes, false);
+  for (int node = 0; node < num_nodes; ++node) {
+    if (next_node(node) != -1) {
+      continues_a_lane_string[next_node(node)] = true;
+    }
+  }
+
+  node_positions_.resize(num_nodes, -1);
+  node_lane_strings_.resize(num_nodes, -1);
+  node_offsets_.push_back(0);
+  const auto add_lane_string = [&](int first_node) {
+    const int lane_string_index = num_lane_strings();
+    double s{0.};
+    for (int node = first_node; node != -1 && node_lane_strings_[node] == -1; node = next_node(node)) {
+      node_positions_[node] = static_cast<int>(nodes_.size());
+      node_lane_strings_[node] = lane_string_index;
+      nodes_.push_back(node);
+      s_offsets_.push_back(s);
+      s += lane_graph_->lane_length(LaneGraph::LaneIndexOf(node));
+    }
+    node_offsets_.push_back(static_cast<int>(nodes_.size()));
+    lane_string_lengths_.push_back(s);
+  };
+  // Lane strings start at nodes that do not continue another one.
+  for (int node = 0; node < num_nodes; ++node) {
+    if (!continues_a_lane_string[node]) {
+      add_lane_string(node);
+    }
+  }
+  // The remaining nodes form closed loops, which are cut at an arbitrary node.
+  for (int node = 0; node < num_nodes; ++node) {
+    if (node_lane_strings_[node] == -1) {
+      add_lane_string(node);
+    }
+  }
+}
+
+double LaneStringIndex::lane_string_length(int lane_string_index) const {
+  MALIDRIVE_THROW_UNLESS(lane_string_index >= 0 && lane_string_index < num_lane_strings());
+  return lane_string_lengths_[lane_string_index];
+}
+
+int LaneStringIndex::LaneStringOf(int node) const {
+  MALIDRIVE_THROW_UNLESS(node >= 0 && node < static_cast<int>(node_lane_strings_.size()));
+  return node_lane_strings_[node];
+}
+
+LaneStringIndex::LaneS LaneStringIndex::ToLaneS(int lane_string_index, double s) const {
+  MALIDRIVE_IS_IN_RANGE(s, 0., lane_string_length(lane_string_index));
+  const auto begin = s_offsets_.begin() + nodes_begin(lane_string_index);
+  const auto end = s_offsets_.begin() + nodes_end(lane_string_index);
+  // The first node is entered at zero, so the result of the search is never `begin`.
+  const int position = static_cast<int>(std::upper_bound(begin + 1, end, s) - s_offsets_.begin()) - 1;
+  const int node = nodes_[position];
+  const double lane_length = lane_graph_->lane_length(LaneGraph::LaneIndexOf(node));
+  const double node_s = maliput::math::saturate(s - s_offsets_[position], 0., lane_length);
+  return {lane_graph_->lane(LaneGraph::LaneIndexOf(node)), node,
+          LaneGraph::EntryEndOf(node) == maliput::api::LaneEnd::kStart ? node_s : lane_length - node_s};
+}
+
+double LaneStringIndex::ToLaneStringS(int node, double lane_s) const {
+  MALIDRIVE_THROW_UNLESS(node >= 0 && node < static_cast<int>(node_positions_.size()));
+  const double lane_length = lane_graph_->lane_length(LaneGraph::LaneIndexOf(node));
+  const double saturated_lane_s = maliput::math::saturate(lane_s, 0., lane_length);
+  return s_offsets_[node_positions_[node]] + (LaneGraph::EntryEndOf(node) == maliput::api::LaneEnd::kStart
+                                                  ? saturated_lane_s
+                                                  : lane_length - saturated_lane_s);
+}
+
+}  // namespace malidrive
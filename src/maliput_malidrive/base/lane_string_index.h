@@ -0,0 +1,138 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <vector>
+
+#include <maliput/api/lane.h>
+
+#include "maliput_malidrive/base/lane_graph.h"
+#include "maliput_malidrive/common/macros.h"
+
+namespace malidrive {
+
+/// Index of the lane strings of a LaneGraph.
+///
+/// A lane string is a maximal chain of LaneGraph nodes where each node has a
+/// single ongoing node and that ongoing node has no other incoming node, i.e.
+/// every BranchPoint crossed along the chain joins exactly one Lane on each
+/// side. Highways split in many LaneSections and Roads are typically covered
+/// by a few long lane strings.
+///
+/// Each node belongs to exactly one lane string. As nodes are directed, a
+/// chain of Lanes usually yields two lane strings, one per direction. A lane
+/// string's `s` coordinate starts at zero at the entry of its first node and
+/// grows along the chain, so nodes entered through LaneEnd::kFinish run
+/// opposite to their Lane's `s` coordinate.
+///
+/// Nodes of lane string `i` are in [nodes_begin(i), nodes_end(i)).
+class LaneStringIndex {
+ public:
+  MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(LaneStringIndex);
+
+  /// Holds a position in a Lane of a lane string.
+  struct LaneS {
+    /// The Lane.
+    const maliput::api::Lane* lane{};
+    /// The LaneGraph node of `lane` in the lane string.
+    int node{};
+    /// The LANE Frame `s` coordinate.
+    double s{};
+  };
+
+  /// Constructs a LaneStringIndex out of @p lane_graph.
+  ///
+  /// @param lane_graph The LaneGraph. It must outlive this object.
+  explicit LaneStringIndex(const LaneGraph& lane_graph);
+
+  /// @returns The number of lane strings.
+  int num_lane_strings() const { return static_cast<int>(lane_string_lengths_.size()); }
+
+  /// @returns The length of the lane string at @p lane_string_index.
+  /// @throws maliput::common::assertion_error When @p lane_string_index is out
+  ///         of range.
+  double lane_string_length(int lane_string_index) const;
+
+  /// @{ Positions in the node list of the lane string at
+  ///    @p lane_string_index. See node() and node_s_offset().
+  int nodes_begin(int lane_string_index) const { return node_offsets_[lane_string_index]; }
+  int nodes_end(int lane_string_index) const { return node_offsets_[lane_string_index + 1]; }
+  /// @}
+
+  /// @returns The LaneGraph node at @p position of the node list.
+  int node(int position) const { return nodes_[position]; }
+
+  /// @returns The lane string `s` coordinate where the node at @p position of
+  ///          the node list is entered.
+  double node_s_offset(int position) const { return s_offsets_[position]; }
+
+  /// @returns The index of the lane string of @p node.
+  /// @throws maliput::common::assertion_error When @p node is out of range.
+  int LaneStringOf(int node) const;
+
+  /// Maps the `s` coordinate of a lane string to a LaneS. It is a binary
+  /// search on the lane string's nodes.
+  ///
+  /// @param lane_string_index The index of the lane string.
+  /// @param s The lane string `s` coordinate. It must be in
+  ///        [0, `lane_string_length(lane_string_index)`]. At the boundary
+  ///        between two nodes, the latter is used.
+  /// @returns The LaneS that matches @p s.
+  /// @throws maliput::common::assertion_error When @p lane_string_index is out
+  ///         of range.
+  /// @throws maliput::common::assertion_error When @p s is out of range.
+  LaneS ToLaneS(int lane_string_index, double s) const;
+
+  /// Maps a LANE Frame `s` coordinate of @p node to the `s` coordinate of its
+  /// lane string.
+  ///
+  /// @param node The LaneGraph node.
+  /// @param lane_s The LANE Frame `s` coordinate. It is saturated to
+  ///        [0, `Lane::length()`].
+  /// @returns The `s` coordinate in the lane string of @p node.
+  /// @throws maliput::common::assertion_error When @p node is out of range.
+  double ToLaneStringS(int node, double lane_s) const;
+
+ private:
+  const LaneGraph* lane_graph_{};
+  // @{ Node list of all the lane strings. Nodes of lane string `i` are in
+  //    [node_offsets_[i], node_offsets_[i + 1]).
+  std::vector<int> node_offsets_;
+  std::vector<int> nodes_;
+  std::vector<double> s_offsets_;
+  // @}
+  std::vector<double> lane_string_lengths_;
+  // Position in the node list of each LaneGraph node.
+  std::vector<int> node_positions_;
+  // Lane string of each LaneGraph node.
+  std::vector<int> node_lane_strings_;
+};
+
+}  // namespace malidrive
@@ -0,0 +1,143 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/base/lane_tracker.h"
+
+#include <maliput/api/branch_point.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/segment.h>
+#include <maliput/math/saturate.h>
+
+namespace malidrive {
+namespace {
+
+// @returns `lane` as a malidrive::Lane.
+// @throws maliput::common::assertion_error When `lane` is not a malidrive::Lane.
+const Lane* ToMalidriveLane(const maliput::api::Lane* lane) {
+  const Lane* malidrive_lane = dynamic_cast<const Lane*>(lane);
+  MALIDRIVE_THROW_UNLESS(malidrive_lane != nullptr);
+  return malidrive_lane;
+}
+
+}  // namespace
+
+LaneTracker::LaneTracker(const Lane* lane, const maliput::api::LanePosition& lane_position) : lane_(lane) {
+  MALIDRIVE_THROW_UNLESS(lane_ != nullptr);
+  MALIDRIVE_THROW_UNLESS(lane_->segment() != nullptr);
+  MALIDRIVE_THROW_UNLESS(lane_->segment()->junction() != nullptr);
+  MALIDRIVE_THROW_UNLESS(lane_->segment()->junction()->road_geometry() != nullptr);
+  linear_tolerance_ = lane_->segment()->junction()->road_geometry()->linear_tolerance();
+  lane_position_ = maliput::api::LanePosition(maliput::math::saturate(lane_position.s(), 0., lane_->length()),
+                                              lane_position.r(), lane_position.h());
+  track_s_ = lane_->TrackSFromLaneS(lane_position_.s());
+}
+
+maliput::api::RoadPositionResult LaneTracker::Update(const maliput::api::InertialPosition& inertial_position) {
+  Candidate current = Project(lane_, inertial_position, lane_position_);
+  for (int i = 0; i < kMaxTransitions && current.result.distance > linear_tolerance_; ++i) {
+    // A position beyond a corner of the Lane may be reached through either transition, so the closest one is taken.
+    std::optional<Candidate> next = ProjectIntoOngoingLanes(current, inertial_position);
+    const std::optional<Candidate> adjacent = ProjectIntoAdjacentLane(current, inertial_position);
+    if (adjacent.has_value() && (!next.has_value() || adjacent->result.distance < next->result.distance)) {
+      next = adjacent;
+    }
+    if (!next.has_value() || next->result.distance >= current.result.distance) {
+      break;
+    }
+    current = next.value();
+  }
+
+  lane_ = current.lane;
+  lane_position_ = current.result.lane_position;
+  track_s_ = lane_->TrackSFromLaneS(lane_position_.s());
+  return {maliput::api::RoadPosition(lane_, lane_position_), current.result.nearest_position, current.result.distance};
+}
+
+LaneTracker::Candidate LaneTracker::Project(const Lane* lane, const maliput::api::InertialPosition& inertial_position,
+                                            const maliput::api::LanePosition& hint) {
+  Candidate candidate{lane, {}, Lane::ProjectionStatus::kConverged};
+  candidate.result = lane->ToLanePosition(inertial_position, hint, &candidate.status);
+  return candidate;
+}
+
+std::optional<LaneTracker::Candidate> LaneTracker::ProjectIntoOngoingLanes(
+    const Candidate& current, const maliput::api::InertialPosition& inertial_position) {
+  maliput::api::LaneEnd::Which end{};
+  switch (current.status) {
+    case Lane::ProjectionStatus::kSaturatedAtStart:
+      end = maliput::api::LaneEnd::kStart;
+      break;
+    case Lane::ProjectionStatus::kSaturatedAtEnd:
+      end = maliput::api::LaneEnd::kFinish;
+      break;
+    default:
+      return std::nullopt;
+  }
+  const maliput::api::LaneEndSet* ongoing_lanes = current.lane->GetOngoingBranches(end);
+  if (ongoing_lanes == nullptr) {
+    return std::nullopt;
+  }
+  std::optional<Candidate> closest;
+  for (int i = 0; i < ongoing_lanes->size(); ++i) {
+    const maliput::api::LaneEnd& lane_end = ongoing_lanes->get(i);
+    const Lane* ongoing_lane = ToMalidriveLane(lane_end.lane);
+    // The agent enters the ongoing Lane through `lane_end`.
+    const double s_hint = lane_end.end == maliput::api::LaneEnd::kStart ? 0. : ongoing_lane->length();
+    const Candidate candidate = Project(ongoing_lane, inertial_position, maliput::api::LanePosition(s_hint, 0., 0.));
+    if (!closest.has_value() || candidate.result.distance < closest->result.distance) {
+      closest = candidate;
+    }
+  }
+  return closest;
+}
+
+std::optional<LaneTracker::Candidate> LaneTracker::ProjectIntoAdjacentLane(
+    const Candidate& current, const maliput::api::InertialPosition& inertial_position) const {
+  const maliput::api::LanePosition& lane_position = current.result.lane_position;
+  const maliput::api::RBounds lane_bounds = current.lane->lane_bounds(lane_position.s());
+  const maliput::api::Lane* adjacent_lane{nullptr};
+  if (lane_position.r() >= lane_bounds.max() - linear_tolerance_) {
+    adjacent_lane = current.lane->to_left();
+  } else if (lane_position.r() <= lane_bounds.min() + linear_tolerance_) {
+    adjacent_lane = current.lane->to_right();
+  }
+  if (adjacent_lane == nullptr) {
+    return std::nullopt;
+  }
+  // Lanes in the same Segment share the TRACK Frame, so the hint is the LANE Frame `s` coordinate of the adjacent
+  // Lane at the same TRACK Frame `s` coordinate.
+  const Lane* malidrive_adjacent_lane = ToMalidriveLane(adjacent_lane);
+  const double track_s =
+      maliput::math::saturate(current.lane->TrackSFromLaneS(lane_position.s()),
+                              malidrive_adjacent_lane->get_track_s_start(), malidrive_adjacent_lane->get_track_s_end());
+  const double s_hint = malidrive_adjacent_lane->LaneSFromTrackS(track_s);
+  return Project(malidrive_adjacent_lane, inertial_position, maliput::api::LanePosition(s_hint, 0., 0.));
+}
+
+}  // namespace malidrive
@@ -0,0 +1,125 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <optional>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+
+#include "maliput_malidrive/base/lane.h"
+#include "maliput_malidrive/common/macros.h"
+
+namespace malidrive {
+
+/// Keeps track of the Lane a moving agent is driving on.
+///
+/// Agents move little between consecutive updates, so the previous
+/// LanePosition is used to warm-start the projection into the current Lane.
+/// See Lane::ToLanePosition(inertial_pos, hint). When the new position
+/// falls beyond the Lane's volume, the tracker moves to:
+/// - the ongoing Lanes of the BranchPoint at the corresponding LaneEnd, when
+///   the projection is saturated at the start or at the end of the Lane.
+/// - the Lane to the left or to the right, when the projection is saturated at
+///   the Lane's bounds.
+///
+/// A transition is only taken when it reduces the distance to the new
+/// position, and at most kMaxTransitions are taken per update. Consequently,
+/// the cost of an update does not depend on the size of the map.
+///
+/// A typical use is to initialize the tracker from
+/// maliput::api::RoadGeometry::ToRoadPosition() once and then call Update()
+/// with the agent's position on every step.
+class LaneTracker {
+ public:
+  MALIDRIVE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(LaneTracker);
+
+  /// Maximum number of Lane transitions per Update().
+  static constexpr int kMaxTransitions{8};
+
+  /// Constructs a LaneTracker.
+  ///
+  /// @param lane The Lane the agent is on. It must not be nullptr and it must
+  ///        belong to a RoadGeometry.
+  /// @param lane_position The agent's LanePosition in @p lane. Its `s`
+  ///        coordinate is saturated to [0, `lane->length()`].
+  /// @throws maliput::common::assertion_error When @p lane is nullptr or it
+  ///         does not belong to a RoadGeometry.
+  LaneTracker(const Lane* lane, const maliput::api::LanePosition& lane_position);
+
+  /// Updates the tracked Lane and LanePosition with the agent's new position.
+  ///
+  /// @param inertial_position The agent's InertialPosition.
+  /// @returns The RoadPositionResult of @p inertial_position in the tracked
+  ///          Lane.
+  /// @throws maliput::common::assertion_error When an ongoing or adjacent Lane
+  ///         is not a malidrive::Lane.
+  maliput::api::RoadPositionResult Update(const maliput::api::InertialPosition& inertial_position);
+
+  /// @returns The tracked Lane.
+  const Lane* lane() const { return lane_; }
+
+  /// @returns The LanePosition in lane() of the last update.
+  const maliput::api::LanePosition& lane_position() const { return lane_position_; }
+
+  /// @returns The TRACK Frame `s` coordinate that matches `lane_position().s()`.
+  double track_s() const { return track_s_; }
+
+ private:
+  // Holds the projection of a position into a Lane.
+  struct Candidate {
+    const Lane* lane{};
+    maliput::api::LanePositionResult result;
+    Lane::ProjectionStatus status{Lane::ProjectionStatus::kConverged};
+  };
+
+  // @returns The projection of `inertial_position` into `lane` using `hint` as the initial guess.
+  static Candidate Project(const Lane* lane, const maliput::api::InertialPosition& inertial_position,
+                           const maliput::api::LanePosition& hint);
+
+  // @returns The closest projection of `inertial_position` into the ongoing Lanes at the end of `current.lane` where
+  //          `current` is saturated, or std::nullopt when `current` is not saturated or there are no ongoing Lanes.
+  static std::optional<Candidate> ProjectIntoOngoingLanes(const Candidate& current,
+                                                          const maliput::api::InertialPosition& inertial_position);
+
+  // @returns The projection of `inertial_position` into the Lane to the left or to the right of `current.lane`,
+  //          depending on which of `current`'s bounds is reached, or std::nullopt when neither is reached within
+  //          `linear_tolerance_` or there is no such Lane.
+  std::optional<Candidate> ProjectIntoAdjacentLane(const Candidate& current,
+                                                   const maliput::api::InertialPosition& inertial_position) const;
+
+  const Lane* lane_{};
+  maliput::api::LanePosition lane_position_;
+  double track_s_{};
+  double linear_tolerance_{};
+};
+
+}  // namespace malidrive
@@ -30,14 +30,42 @@
 #include "maliput_malidrive/base/road_geometry.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <queue>
+#include <utility>
 
+#include <maliput/common/logger.h>
 #include <maliput/geometry_base/brute_force_find_road_positions_strategy.h>
 #include <maliput/geometry_base/filter_positions.h>
+#include <maliput/math/saturate.h>
 
+#include "maliput_malidrive/base/lane.h"
 #include "maliput_malidrive/constants.h"
 
 namespace {
 
+// Maximum distance along a Lane between two samples of its LaneBoundingBox.
+constexpr double kLaneBoundingBoxSamplingStep{5.};
+
+// Number of consecutive positions a thread takes at once in
+// RoadGeometry::ToRoadPositions(). Keeping nearby positions on the same thread
+// keeps the touched Lanes warm in its cache.
+constexpr std::size_t kToRoadPositionsChunkSize{16};
+
+// @returns The distance from `point` to the axis-aligned box [`min`, `max`].
+double DistanceToBox(const maliput::math::Vector3& point, const maliput::math::Vector3& min,
+                     const maliput::math::Vector3& max) {
+  double squared_distance{0.};
+  for (int i = 0; i < 3; ++i) {
+    const double delta = std::max({min[i] - point[i], 0., point[i] - max[i]});
+    squared_distance += delta * delta;
+  }
+  return std::sqrt(squared_distance);
+}
+
 // Evaluates if `new_road_position_result` provides a closer api::RoadPositionResult than `road_position_result`.
 //
 // _Closer_ means:
@@ -101,8 +129,8 @@ bool IsNewRoadPositionResultCloser(const maliput::api::RoadPositionResult& new_r
 namespace malidrive {
 
 void RoadGeometry::AddRoadCharacteristics(const xodr::RoadHeader::Id& road_id,
-                                          std::unique_ptr<road_curve::RoadCurve> road_curve,
-                                          std::unique_ptr<road_curve::Function> reference_line_offset) {
+                                          std::shared_ptr<const road_curve::RoadCurve> road_curve,
+                                          std::shared_ptr<const road_curve::Function> reference_line_offset) {
   MALIDRIVE_THROW_UNLESS(road_curve != nullptr);
   MALIDRIVE_THROW_UNLESS(reference_line_offset != nullptr);
   if (road_characteristics_.find(road_id) != road_characteristics_.end()) {
@@ -111,6 +139,15 @@ void RoadGeometry::AddRoadCharacteristics(const xodr::RoadHeader::Id& road_id,
   road_characteristics_.emplace(road_id, RoadCharacteristics{std::move(road_curve), std::move(reference_line_offset)});
 }
 
+std::optional<RoadGeometry::RoadCharacteristics> RoadGeometry::FindRoadCharacteristics(
+    const xodr::RoadHeader::Id& road_id) const {
+  const auto it = road_characteristics_.find(road_id);
+  if (it == road_characteristics_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
 const road_curve::RoadCurve* RoadGeometry::GetRoadCurve(const xodr::RoadHeader::Id& road_id) const {
   if (road_characteristics_.find(road_id) == road_characteristics_.end()) {
     MALIDRIVE_THROW_MESSAGE(std::string("There is no RoadCurve for RoadID: ") + road_id.string());
@@ -125,6 +162,91 @@ const road_curve::Function* RoadGeometry::GetReferenceLineOffset(const xodr::Roa
   return road_characteristics_.at(road_id).reference_line_offset.get();
 }
 
+void RoadGeometry::SetLaneGraph(std::unique_ptr<LaneGraph> lane_graph) {
+  MALIDRIVE_THROW_UNLESS(lane_graph != nullptr);
+  lane_graph_ = std::move(lane_graph);
+}
+
+void RoadGeometry::DeferLaneGraph(double lane_change_penalty) {
+  MALIDRIVE_THROW_UNLESS(lane_change_penalty >= 0.);
+  deferred_lane_change_penalty_ = lane_change_penalty;
+}
+
+const LaneGraph& RoadGeometry::lane_graph() const {
+  BuildDeferredLaneGraph();
+  MALIDRIVE_THROW_UNLESS(lane_graph_ != nullptr);
+  return *lane_graph_;
+}
+
+void RoadGeometry::SetLaneStringIndex(std::unique_ptr<LaneStringIndex> lane_string_index) {
+  MALIDRIVE_THROW_UNLESS(lane_string_index != nullptr);
+  lane_string_index_ = std::move(lane_string_index);
+}
+
+const LaneStringIndex& RoadGeometry::lane_string_index() const {
+  BuildDeferredLaneGraph();
+  MALIDRIVE_THROW_UNLESS(lane_string_index_ != nullptr);
+  return *lane_string_index_;
+}
+
+void RoadGeometry::SetXodrLaneIndex(std::unique_ptr<XodrLaneIndex> xodr_lane_index) {
+  MALIDRIVE_THROW_UNLESS(xodr_lane_index != nullptr);
+  xodr_lane_index_ = std::move(xodr_lane_index);
+}
+
+const XodrLaneIndex& RoadGeometry::xodr_lane_index() const {
+  MALIDRIVE_THROW_UNLESS(xodr_lane_index_ != nullptr);
+  return *xodr_lane_index_;
+}
+
+void RoadGeometry::BuildDeferredLaneGraph() const {
+  if (!deferred_lane_change_penalty_.has_value()) {
+    return;
+  }
+  std::call_once(lane_graph_flag_, [this]() {
+    maliput::log()->trace("Building deferred LaneGraph...");
+    auto lane_graph = std::make_unique<LaneGraph>(*this, deferred_lane_change_penalty_.value());
+    lane_string_index_ = std::make_unique<LaneStringIndex>(*lane_graph);
+    lane_graph_ = std::move(lane_graph);
+  });
+}
+
+void RoadGeometry::SetConflictZones(const maliput::api::JunctionId& junction_id,
+                                    std::vector<ConflictZone> conflict_zones) {
+  auto entry = std::make_unique<JunctionConflictZones>();
+  entry->conflict_zones = std::move(conflict_zones);
+  // Marks them as computed so a deferred finder does not replace them.
+  std::call_once(entry->flag, []() {});
+  conflict_zones_[junction_id] = std::move(entry);
+}
+
+void RoadGeometry::DeferConflictZones(
+    std::function<std::vector<ConflictZone>(const maliput::api::Junction*)> conflict_zones_finder) {
+  MALIDRIVE_THROW_UNLESS(conflict_zones_finder != nullptr);
+  conflict_zones_finder_ = std::move(conflict_zones_finder);
+  for (int i = 0; i < num_junctions(); ++i) {
+    auto& entry = conflict_zones_[junction(i)->id()];
+    if (entry == nullptr) {
+      entry = std::make_unique<JunctionConflictZones>();
+    }
+  }
+}
+
+const std::vector<ConflictZone>& RoadGeometry::GetConflictZones(const maliput::api::JunctionId& junction_id) const {
+  static const std::vector<ConflictZone> kNoConflictZones;
+  const auto it = conflict_zones_.find(junction_id);
+  if (it == conflict_zones_.end()) {
+    return kNoConflictZones;
+  }
+  JunctionConflictZones* entry = it->second.get();
+  if (conflict_zones_finder_ != nullptr) {
+    std::call_once(entry->flag, [this, &junction_id, entry]() {
+      entry->conflict_zones = conflict_zones_finder_(ById().GetJunction(junction_id));
+    });
+  }
+  return entry->conflict_zones;
+}
+
 maliput::api::RoadPositionResult RoadGeometry::DoToRoadPosition(
     const maliput::api::InertialPosition& inertial_pos, const std::optional<maliput::api::RoadPosition>& hint) const {
   maliput::api::RoadPositionResult result;
@@ -158,6 +280,270 @@ maliput::api::RoadPositionResult RoadGeometry::DoToRoadPosition(
   return result;
 }
 
+void RoadGeometry::ToRoadPositions(const std::vector<maliput::api::InertialPosition>& inertial_positions,
+                                   const std::vector<std::optional<maliput::api::RoadPosition>>& hints,
+                                   std::size_t num_threads,
+                                   std::vector<maliput::api::RoadPositionResult>* results) const {
+  MALIDRIVE_THROW_UNLESS(results != nullptr);
+  MALIDRIVE_THROW_UNLESS(hints.empty() || hints.size() == inertial_positions.size());
+  MALIDRIVE_THROW_UNLESS(results->size() == inertial_positions.size());
+  MALIDRIVE_THROW_UNLESS(num_threads > 0);
+
+  // Builds the boxes before spawning the workers so they don't wait on each other.
+  GetLaneBoundingBoxes();
+
+  const std::size_t num_positions = inertial_positions.size();
+  const std::size_t num_chunks = (num_positions + kToRoadPositionsChunkSize - 1) / kToRoadPositionsChunkSize;
+  const auto solve_chunk = [this, &inertial_positions, &hints, results, num_positions](std::size_t chunk) {
+    const std::size_t end = std::min(num_positions, (chunk + 1) * kToRoadPositionsChunkSize);
+    for (std::size_t i = chunk * kToRoadPositionsChunkSize; i < end; ++i) {
+      (*results)[i] = ToRoadPositionInBatch(inertial_positions[i], hints.empty() ? std::nullopt : hints[i]);
+    }
+  };
+  num_threads = std::min(num_threads, num_chunks);
+  if (num_threads <= 1) {
+    for (std::size_t k = 0; k < num_chunks; ++k) {
+      solve_chunk(k);
+    }
+    return;
+  }
+
+  // Each worker takes the next pending chunk until there are none left. Chunks
+  // write to different elements of `results`, so no further synchronization is
+  // needed.
+  std::atomic<std::size_t> next_chunk{0};
+  const auto worker = [&solve_chunk, &next_chunk, num_chunks]() {
+    for (std::size_t k = next_chunk++; k < num_chunks; k = next_chunk++) {
+      solve_chunk(k);
+    }
+  };
+  std::vector<std::future<void>> workers;
+  for (std::size_t i = 0; i < num_threads; ++i) {
+    workers.push_back(std::async(std::launch::async, worker));
+  }
+  // get() rethrows any exception thrown while solving.
+  for (std::future<void>& future : workers) {
+    future.get();
+  }
+}
+
+void RoadGeometry::FindReachableLanes(const maliput::api::Lane* lane, double s, maliput::api::LaneEnd::Which exit_end,
+                                      double horizon, std::vector<ReachableLane>* reachable_lanes) const {
+  MALIDRIVE_THROW_UNLESS(lane != nullptr);
+  MALIDRIVE_THROW_UNLESS(reachable_lanes != nullptr);
+  MALIDRIVE_THROW_UNLESS(horizon >= 0.);
+  const LaneGraph& graph = lane_graph();
+  const int lane_index = graph.LaneIndex(lane->id());
+  MALIDRIVE_THROW_UNLESS(graph.lane(lane_index) == lane);
+  const int node = LaneGraph::NodeIndex(
+      lane_index,
+      exit_end == maliput::api::LaneEnd::kFinish ? maliput::api::LaneEnd::kStart : maliput::api::LaneEnd::kFinish);
+  const double saturated_s = maliput::math::saturate(s, 0., lane->length());
+  const double distance_to_exit =
+      exit_end == maliput::api::LaneEnd::kFinish ? lane->length() - saturated_s : saturated_s;
+
+  reachable_lanes->clear();
+  if (distance_to_exit > horizon) {
+    return;
+  }
+  const double horizon_from_exit = horizon - distance_to_exit;
+  // Copies the Lanes within `horizon_from_exit` of `cached_reachable_lanes`, which are sorted by distance.
+  const auto fill_reachable_lanes = [&](const std::vector<ReachableLane>& cached_reachable_lanes) {
+    for (const ReachableLane& reachable_lane : cached_reachable_lanes) {
+      if (reachable_lane.distance > horizon_from_exit) {
+        break;
+      }
+      reachable_lanes->push_back(
+          {reachable_lane.lane, reachable_lane.entry_end, reachable_lane.distance + distance_to_exit});
+    }
+  };
+
+  LookaheadCacheShard& shard = lookahead_cache_shards_[static_cast<std::size_t>(node) % kLookaheadCacheNumShards];
+  std::shared_ptr<const LookaheadCacheEntry> cached_entry;
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const auto it = shard.slots.find(node);
+    if (it != shard.slots.end()) {
+      shard.lru_order.splice(shard.lru_order.begin(), shard.lru_order, it->second.lru_position);
+      cached_entry = it->second.entry;
+    }
+  }
+  if (cached_entry != nullptr && cached_entry->horizon >= horizon_from_exit) {
+    fill_reachable_lanes(cached_entry->reachable_lanes);
+    return;
+  }
+  // Grows the cached horizon geometrically so a slowly increasing horizon does not recompute on every query.
+  const double cached_horizon =
+      cached_entry == nullptr ? horizon_from_exit : std::max(horizon_from_exit, 2. * cached_entry->horizon);
+  auto computed_entry = std::make_shared<const LookaheadCacheEntry>(
+      LookaheadCacheEntry{cached_horizon, ComputeReachableLanes(node, cached_horizon)});
+  fill_reachable_lanes(computed_entry->reachable_lanes);
+  StoreLookaheadCacheEntry(node, std::move(computed_entry));
+}
+
+void RoadGeometry::StoreLookaheadCacheEntry(int node, std::shared_ptr<const LookaheadCacheEntry> entry) const {
+  constexpr std::size_t kShardCapacity{kLookaheadCacheCapacity / kLookaheadCacheNumShards};
+  LookaheadCacheShard& shard = lookahead_cache_shards_[static_cast<std::size_t>(node) % kLookaheadCacheNumShards];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto it = shard.slots.find(node);
+  if (it != shard.slots.end()) {
+    // Another thread stored a larger horizon while `entry` was being computed.
+    if (it->second.entry->horizon >= entry->horizon) {
+      return;
+    }
+    shard.size -= it->second.entry->reachable_lanes.size();
+    shard.lru_order.erase(it->second.lru_position);
+    shard.slots.erase(it);
+  }
+  if (entry->reachable_lanes.size() > kShardCapacity) {
+    return;
+  }
+  while (shard.size + entry->reachable_lanes.size() > kShardCapacity) {
+    const auto evicted = shard.slots.find(shard.lru_order.back());
+    shard.size -= evicted->second.entry->reachable_lanes.size();
+    shard.slots.erase(evicted);
+    shard.lru_order.pop_back();
+  }
+  shard.size += entry->reachable_lanes.size();
+  shard.lru_order.push_front(node);
+  shard.slots.emplace(node, LookaheadCacheShard::Slot{std::move(entry), shard.lru_order.begin()});
+}
+
+std::vector<RoadGeometry::ReachableLane> RoadGeometry::ComputeReachableLanes(int node, double horizon) const {
+  const LaneGraph& graph = lane_graph();
+  // Dijkstra over the ongoing edges, bounded by `horizon`. Distances are measured from the exit of `node`, so the
+  // ongoing nodes of `node` are entered at zero.
+  struct OpenNode {
+    double distance{};
+    int node{};
+    bool operator>(const OpenNode& other) const { return distance > other.distance; }
+  };
+  std::priority_queue<OpenNode, std::vector<OpenNode>, std::greater<OpenNode>> open_nodes;
+  std::unordered_map<int, double> distances;
+  const auto push_ongoing_nodes = [&](int from_node, double distance) {
+    for (int edge_index = graph.edges_begin(from_node); edge_index < graph.edges_end(from_node); ++edge_index) {
+      if (graph.edge_type(edge_index) != LaneGraph::EdgeType::kOngoing) {
+        continue;
+      }
+      const int target = graph.edge_target(edge_index);
+      const auto it = distances.find(target);
+      if (distance <= horizon && (it == distances.end() || distance < it->second)) {
+        distances[target] = distance;
+        open_nodes.push({distance, target});
+      }
+    }
+  };
+
+  std::vector<ReachableLane> reachable_lanes;
+  push_ongoing_nodes(node, 0.);
+  while (!open_nodes.empty()) {
+    const OpenNode open_node = open_nodes.top();
+    open_nodes.pop();
+    if (open_node.distance > distances.at(open_node.node)) {
+      continue;
+    }
+    const int lane_index = LaneGraph::LaneIndexOf(open_node.node);
+    reachable_lanes.push_back({graph.lane(lane_index), LaneGraph::EntryEndOf(open_node.node), open_node.distance});
+    push_ongoing_nodes(open_node.node, open_node.distance + graph.lane_length(lane_index));
+  }
+  return reachable_lanes;
+}
+
+const std::vector<RoadGeometry::LaneBoundingBox>& RoadGeometry::GetLaneBoundingBoxes() const {
+  std::call_once(lane_bounding_boxes_flag_, [this]() {
+    for (int i = 0; i < num_junctions(); ++i) {
+      const maliput::api::Junction* junction = this->junction(i);
+      for (int j = 0; j < junction->num_segments(); ++j) {
+        const maliput::api::Segment* segment = junction->segment(j);
+        for (int k = 0; k < segment->num_lanes(); ++k) {
+          lane_bounding_boxes_.push_back(ComputeLaneBoundingBox(segment->lane(k)));
+        }
+      }
+    }
+  });
+  return lane_bounding_boxes_;
+}
+
+RoadGeometry::LaneBoundingBox RoadGeometry::ComputeLaneBoundingBox(const maliput::api::Lane* lane) const {
+  // The volume is sampled at the corners of its cross section. The box of the
+  // samples at `num_intervals` + 1 evenly spaced s-coordinates is inflated by
+  // how far the cross sections in between deviate from a straight line. That
+  // deviation is measured at the middle of each interval, where it peaks for
+  // constant curvature, and doubled to cover curvature changes.
+  const double length = lane->length();
+  const int num_intervals = std::max(1, static_cast<int>(std::ceil(length / kLaneBoundingBoxSamplingStep)));
+  const auto cross_section_corners = [lane](double s) {
+    const maliput::api::RBounds lane_bounds = lane->lane_bounds(s);
+    std::vector<maliput::math::Vector3> corners;
+    for (const double r : {lane_bounds.min(), lane_bounds.max()}) {
+      const maliput::api::HBounds elevation_bounds = lane->elevation_bounds(s, r);
+      for (const double h : {elevation_bounds.min(), elevation_bounds.max()}) {
+        corners.push_back(lane->ToInertialPosition({s, r, h}).xyz());
+      }
+    }
+    return corners;
+  };
+
+  std::vector<maliput::math::Vector3> previous_corners = cross_section_corners(0.);
+  LaneBoundingBox box{lane, previous_corners.front(), previous_corners.front()};
+  double margin{0.};
+  for (int i = 1; i <= num_intervals; ++i) {
+    const std::vector<maliput::math::Vector3> corners = cross_section_corners(length * i / num_intervals);
+    const std::vector<maliput::math::Vector3> middle_corners =
+        cross_section_corners(length * (i - 0.5) / num_intervals);
+    for (std::size_t j = 0; j < corners.size(); ++j) {
+      for (int axis = 0; axis < 3; ++axis) {
+        box.min[axis] = std::min(box.min[axis], std::min(previous_corners[j][axis], corners[j][axis]));
+        box.max[axis] = std::max(box.max[axis], std::max(previous_corners[j][axis], corners[j][axis]));
+      }
+      margin = std::max(margin, (middle_corners[j] - 0.5 * (previous_corners[j] + corners[j])).norm());
+    }
+    previous_corners = corners;
+  }
+  const double inflation = 2. * margin + linear_tolerance();
+  const maliput::math::Vector3 inflation_vector{inflation, inflation, inflation};
+  box.min = box.min - inflation_vector;
+  box.max = box.max + inflation_vector;
+  return box;
+}
+
+maliput::api::RoadPositionResult RoadGeometry::CulledToRoadPosition(
+    const maliput::api::InertialPosition& inertial_pos) const {
+  // DoToRoadPosition() only compares the Lanes within linear_tolerance() when
+  // there is any, so the Lanes whose box is farther away can be skipped. When
+  // none is found, every Lane must be compared.
+  std::optional<maliput::api::RoadPositionResult> result;
+  for (const LaneBoundingBox& box : GetLaneBoundingBoxes()) {
+    if (DistanceToBox(inertial_pos.xyz(), box.min, box.max) > linear_tolerance()) {
+      continue;
+    }
+    const maliput::api::LanePositionResult lane_pos = box.lane->ToLanePosition(inertial_pos);
+    if (lane_pos.distance > linear_tolerance()) {
+      continue;
+    }
+    const maliput::api::RoadPositionResult candidate{
+        {box.lane, lane_pos.lane_position}, lane_pos.nearest_position, lane_pos.distance};
+    if (!result.has_value() || IsNewRoadPositionResultCloser(candidate, *result)) {
+      result = candidate;
+    }
+  }
+  return result.has_value() ? *result : DoToRoadPosition(inertial_pos, std::nullopt);
+}
+
+maliput::api::RoadPositionResult RoadGeometry::ToRoadPositionInBatch(
+    const maliput::api::InertialPosition& inertial_pos, const std::optional<maliput::api::RoadPosition>& hint) const {
+  if (!hint.has_value()) {
+    return CulledToRoadPosition(inertial_pos);
+  }
+  MALIDRIVE_THROW_UNLESS(hint->lane != nullptr);
+  const auto* lane = dynamic_cast<const Lane*>(hint->lane);
+  if (lane == nullptr) {
+    return DoToRoadPosition(inertial_pos, hint);
+  }
+  const maliput::api::LanePositionResult lane_pos = lane->ToLanePosition(inertial_pos, hint->pos);
+  return {{hint->lane, lane_pos.lane_position}, lane_pos.nearest_position, lane_pos.distance};
+}
+
 std::vector<maliput::api::RoadPositionResult> RoadGeometry::DoFindRoadPositions(
     const maliput::api::InertialPosition& inertial_position, double radius) const {
   return maliput::geometry_base::BruteForceFindRoadPositionsStrategy(this, inertial_position, radius);
@@ -29,12 +29,22 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 
 #include <maliput/geometry_base/road_geometry.h>
 
+#include "maliput_malidrive/base/conflict_zone.h"
+#include "maliput_malidrive/base/lane_graph.h"
+#include "maliput_malidrive/base/lane_string_index.h"
+#include "maliput_malidrive/base/xodr_lane_index.h"
 #include "maliput_malidrive/common/macros.h"
 #include "maliput_malidrive/road_curve/road_curve.h"
 #include "maliput_malidrive/xodr/db_manager.h"
@@ -42,10 +52,27 @@
 namespace malidrive {
 
 /// Maliput implementation of the malidrive backend.
+///
+/// Once built, all const queries are thread-safe, so a single instance can be shared by several threads. Caches that
+/// are lazily populated from const queries are initialized exactly once via `std::call_once`.
 class RoadGeometry final : public maliput::geometry_base::RoadGeometry {
  public:
   MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(RoadGeometry);
 
+  /// Maximum number of ReachableLanes held by the cache of
+  /// FindReachableLanes().
+  static constexpr std::size_t kLookaheadCacheCapacity{1 << 16};
+
+  /// Describes a Lane that is reachable ahead of a position.
+  struct ReachableLane {
+    /// The reachable Lane.
+    const maliput::api::Lane* lane{};
+    /// The LaneEnd `lane` is entered through.
+    maliput::api::LaneEnd::Which entry_end{maliput::api::LaneEnd::kStart};
+    /// The shortest driven distance from the position to the entry of `lane`.
+    double distance{};
+  };
+
   /// Constructs a RoadGeometry.
   ///
   /// @param id see @ref
@@ -71,6 +98,25 @@ class RoadGeometry final : public maliput::geometry_base::RoadGeometry {
   /// Returns a xodr::DBManager.
   xodr::DBManager* get_manager() const { return manager_.get(); }
 
+  /// Records whether the XODR geometries of the Roads were simplified within
+  /// linear_tolerance() to build their road_curve::RoadCurves. The
+  /// RoadCharacteristics of RoadGeometries built with and without
+  /// simplification differ, so they cannot be shared between them.
+  /// @param simplified_geometries True when the XODR geometries were simplified.
+  void set_simplified_geometries(bool simplified_geometries) { simplified_geometries_ = simplified_geometries; }
+
+  /// @returns True when the XODR geometries of the Roads were simplified within linear_tolerance().
+  bool simplified_geometries() const { return simplified_geometries_; }
+
+  /// Holds the description of a Road. Its ownership is shared, so another
+  /// RoadGeometry built out of the same XODR Road may reuse it.
+  struct RoadCharacteristics {
+    /// The RoadCurve of the Road.
+    std::shared_ptr<const road_curve::RoadCurve> road_curve;
+    /// The lateral shift of the road reference line.
+    std::shared_ptr<const road_curve::Function> reference_line_offset;
+  };
+
   /// Adds the description of a Road.
   /// @param road_id Is the xodr id of the road that `road_curve` belongs to.
   /// @param road_curve Is the RoadCurve to be added.
@@ -79,8 +125,14 @@ class RoadGeometry final : public maliput::geometry_base::RoadGeometry {
   /// @throw maliput::common::assertion_error When `road_curve` is nullptr.
   /// @throw maliput::common::assertion_error When `reference_line_offset` is nullptr.
   /// @throw maliput::common::assertion_error When `road_id` is duplicated.
-  void AddRoadCharacteristics(const xodr::RoadHeader::Id& road_id, std::unique_ptr<road_curve::RoadCurve> road_curve,
-                              std::unique_ptr<road_curve::Function> reference_line_offset);
+  void AddRoadCharacteristics(const xodr::RoadHeader::Id& road_id,
+                              std::shared_ptr<const road_curve::RoadCurve> road_curve,
+                              std::shared_ptr<const road_curve::Function> reference_line_offset);
+
+  /// Finds the description of a Road.
+  /// @param road_id Is the xodr id of the road.
+  /// @returns The RoadCharacteristics of `road_id`, or std::nullopt when they were not added.
+  std::optional<RoadCharacteristics> FindRoadCharacteristics(const xodr::RoadHeader::Id& road_id) const;
 
   /// Gets the RoadCurve of `road_id`.
   /// @param road_id Is the xodr id of the road that `road_curve` belongs to.
@@ -96,13 +148,206 @@ class RoadGeometry final : public maliput::geometry_base::RoadGeometry {
   /// @throw maliput::common::assertion_error When there is no a function described for `road_id`.
   const road_curve::Function* GetReferenceLineOffset(const xodr::RoadHeader::Id& road_id) const;
 
+  /// Sets the LaneGraph of this RoadGeometry.
+  /// @param lane_graph The LaneGraph. It must not be nullptr and it must be
+  ///        built out of this RoadGeometry.
+  ///
+  /// @throw maliput::common::assertion_error When `lane_graph` is nullptr.
+  void SetLaneGraph(std::unique_ptr<LaneGraph> lane_graph);
+
+  /// Defers the construction of the LaneGraph and the LaneStringIndex of this
+  /// RoadGeometry to the first call to lane_graph() or lane_string_index().
+  /// Building the LaneGraph evaluates the length of every Lane, so it is used
+  /// when Lanes are built lazily.
+  /// @param lane_change_penalty See LaneGraph's constructor.
+  ///
+  /// @throw maliput::common::assertion_error When `lane_change_penalty` is negative.
+  void DeferLaneGraph(double lane_change_penalty);
+
+  /// @returns The LaneGraph of this RoadGeometry.
+  ///
+  /// @throw maliput::common::assertion_error When the LaneGraph has neither been set nor deferred.
+  const LaneGraph& lane_graph() const;
+
+  /// Sets the LaneStringIndex of this RoadGeometry.
+  /// @param lane_string_index The LaneStringIndex. It must not be nullptr and
+  ///        it must be built out of lane_graph().
+  ///
+  /// @throw maliput::common::assertion_error When `lane_string_index` is nullptr.
+  void SetLaneStringIndex(std::unique_ptr<LaneStringIndex> lane_string_index);
+
+  /// @returns The LaneStringIndex of this RoadGeometry.
+  ///
+  /// @throw maliput::common::assertion_error When the LaneStringIndex has neither been set nor deferred.
+  const LaneStringIndex& lane_string_index() const;
+
+  /// Sets the XodrLaneIndex of this RoadGeometry.
+  /// @param xodr_lane_index The XodrLaneIndex. It must not be nullptr and it
+  ///        must be built out of this RoadGeometry.
+  ///
+  /// @throw maliput::common::assertion_error When `xodr_lane_index` is nullptr.
+  void SetXodrLaneIndex(std::unique_ptr<XodrLaneIndex> xodr_lane_index);
+
+  /// @returns The XodrLaneIndex of this RoadGeometry.
+  ///
+  /// @throw maliput::common::assertion_error When the XodrLaneIndex has not been set.
+  const XodrLaneIndex& xodr_lane_index() const;
+
+  /// Sets the ConflictZones of a Junction. Like the rest of the setters, it
+  /// must be called while the RoadGeometry is built, before it is queried.
+  /// @param junction_id The ID of the Junction.
+  /// @param conflict_zones The ConflictZones between Lanes of `junction_id`.
+  ///        They replace any previously set or deferred ConflictZones of
+  ///        `junction_id`.
+  void SetConflictZones(const maliput::api::JunctionId& junction_id, std::vector<ConflictZone> conflict_zones);
+
+  /// Defers the computation of the ConflictZones of each Junction to the
+  /// first call to GetConflictZones() for it. Finding the ConflictZones
+  /// evaluates the geometry of the Lanes of the Junction, so it is used when
+  /// Lanes are built lazily. It must be called once every Junction is added.
+  /// The ConflictZones of different Junctions may be computed concurrently.
+  /// @param conflict_zones_finder Computes the ConflictZones of a Junction. It
+  ///        must not be empty.
+  ///
+  /// @throw maliput::common::assertion_error When `conflict_zones_finder` is empty.
+  void DeferConflictZones(
+      std::function<std::vector<ConflictZone>(const maliput::api::Junction*)> conflict_zones_finder);
+
+  /// @returns The ConflictZones of the Junction identified by `junction_id`.
+  ///          It is empty when none were set.
+  const std::vector<ConflictZone>& GetConflictZones(const maliput::api::JunctionId& junction_id) const;
+
+  /// Determines the RoadPositionResult of each of @p inertial_positions.
+  ///
+  /// Results match calling maliput::api::RoadGeometry::ToRoadPosition() once
+  /// per position, but the cost of a batch is shared:
+  /// - Each Lane's volume is enclosed by an axis-aligned box in the Inertial
+  ///   Frame. Boxes are computed on the first call and reused by every later
+  ///   position. Lanes whose box is farther than linear_tolerance() are not
+  ///   evaluated as long as another Lane is found within linear_tolerance().
+  /// - Positions are split among @p num_threads threads.
+  ///
+  /// @param inertial_positions The InertialPositions to localize.
+  /// @param hints Either empty or one optional RoadPosition per element of
+  ///        @p inertial_positions. When a hint has a value, the position is
+  ///        projected into the hint's Lane only and the hint's LanePosition
+  ///        seeds the search. See Lane::ToLanePosition(inertial_pos, hint).
+  /// @param num_threads Number of threads to use. When it is 1, the calling
+  ///        thread does all the work.
+  /// @param results The output. It must have as many elements as
+  ///        @p inertial_positions. The i-th element is overwritten with the
+  ///        result of the i-th position.
+  ///
+  /// @throw maliput::common::assertion_error When @p results is nullptr.
+  /// @throw maliput::common::assertion_error When @p hints is not empty and its
+  ///        size differs from @p inertial_positions' size.
+  /// @throw maliput::common::assertion_error When @p results' size differs from
+  ///        @p inertial_positions' size.
+  /// @throw maliput::common::assertion_error When @p num_threads is zero.
+  /// @throw maliput::common::assertion_error When a hint's Lane is nullptr.
+  void ToRoadPositions(const std::vector<maliput::api::InertialPosition>& inertial_positions,
+                       const std::vector<std::optional<maliput::api::RoadPosition>>& hints, std::size_t num_threads,
+                       std::vector<maliput::api::RoadPositionResult>* results) const;
+
+  /// Finds the Lanes that are reachable within @p horizon ahead of @p lane at
+  /// @p s by following ongoing branches. Lane changes are not considered.
+  ///
+  /// Lanes reachable from each LaneEnd are computed on the first query that
+  /// exits through it and cached, so later queries within the cached horizon
+  /// are a lookup. A query beyond the cached horizon recomputes the LaneEnd
+  /// with a larger horizon. The cache holds up to kLookaheadCacheCapacity
+  /// ReachableLanes; the least recently queried LaneEnds are evicted when it is
+  /// full. The search itself runs without holding any lock, so queries from
+  /// several threads only wait on each other to look up and store entries.
+  ///
+  /// @param lane The Lane to start from. It must not be nullptr and it must
+  ///        belong to this RoadGeometry.
+  /// @param s The LANE Frame `s` coordinate to start from. It is saturated to
+  ///        [0, `lane->length()`].
+  /// @param exit_end The LaneEnd @p lane is driven towards.
+  /// @param horizon The maximum driven distance. It must be non-negative.
+  /// @param reachable_lanes The reachable Lanes, sorted by increasing
+  ///        distance. Each Lane and entry LaneEnd appears once. It must not be
+  ///        nullptr. It is cleared before being filled.
+  ///
+  /// @throw maliput::common::assertion_error When @p lane or
+  ///        @p reachable_lanes are nullptr.
+  /// @throw maliput::common::assertion_error When @p lane does not belong to
+  ///        this RoadGeometry.
+  /// @throw maliput::common::assertion_error When @p horizon is negative.
+  void FindReachableLanes(const maliput::api::Lane* lane, double s, maliput::api::LaneEnd::Which exit_end,
+                          double horizon, std::vector<ReachableLane>* reachable_lanes) const;
+
  private:
-  // Holds the description of the Road.
-  struct RoadCharacteristics {
-    std::unique_ptr<road_curve::RoadCurve> road_curve;
-    std::unique_ptr<road_curve::Function> reference_line_offset;
+  // Axis-aligned box in the Inertial Frame that encloses the volume of `lane`.
+  struct LaneBoundingBox {
+    const maliput::api::Lane* lane{};
+    maliput::math::Vector3 min;
+    maliput::math::Vector3 max;
   };
 
+  // ConflictZones of a Junction. When they are deferred, `flag` guards their computation.
+  struct JunctionConflictZones {
+    std::once_flag flag;
+    std::vector<ConflictZone> conflict_zones;
+  };
+
+  // Lanes reachable from the exit of a LaneGraph node.
+  struct LookaheadCacheEntry {
+    // Horizon `reachable_lanes` was computed for.
+    double horizon{};
+    // Reachable Lanes whose distance is measured from the exit of the node.
+    std::vector<ReachableLane> reachable_lanes;
+  };
+
+  // Part of the cache of FindReachableLanes(). Each LaneGraph node belongs to a single shard, so queries of different
+  // nodes rarely wait on the same mutex.
+  struct LookaheadCacheShard {
+    // A cached entry and its position in `lru_order`.
+    struct Slot {
+      std::shared_ptr<const LookaheadCacheEntry> entry;
+      std::list<int>::iterator lru_position;
+    };
+    // Guards the members below. It is only held to look up, store and evict entries.
+    std::mutex mutex;
+    // Keys of `slots` from the most to the least recently queried.
+    std::list<int> lru_order;
+    std::unordered_map<int, Slot> slots;
+    // Total number of ReachableLanes held by `slots`.
+    std::size_t size{0};
+  };
+
+  // Number of shards of the cache of FindReachableLanes(). Each one holds up to
+  // kLookaheadCacheCapacity / kLookaheadCacheNumShards ReachableLanes.
+  static constexpr std::size_t kLookaheadCacheNumShards{16};
+
+  // Stores `entry` as the most recently queried one for `node` unless an entry with a larger horizon was stored
+  // meanwhile. The least recently queried entries of the shard are evicted to make room for it.
+  void StoreLookaheadCacheEntry(int node, std::shared_ptr<const LookaheadCacheEntry> entry) const;
+
+  // @returns The Lanes reachable within `horizon` from the exit of the LaneGraph `node`, sorted by distance.
+  std::vector<ReachableLane> ComputeReachableLanes(int node, double horizon) const;
+
+  // @returns The LaneBoundingBox of every Lane, in the same order that
+  //          maliput::geometry_base::BruteForceFindRoadPositionsStrategy visits
+  //          them. They are computed on the first call.
+  const std::vector<LaneBoundingBox>& GetLaneBoundingBoxes() const;
+
+  // @returns The LaneBoundingBox of `lane`.
+  LaneBoundingBox ComputeLaneBoundingBox(const maliput::api::Lane* lane) const;
+
+  // Builds the LaneGraph and the LaneStringIndex once when they were deferred. See DeferLaneGraph().
+  void BuildDeferredLaneGraph() const;
+
+  // Same as DoToRoadPosition() without a hint, but Lanes whose LaneBoundingBox
+  // is farther than linear_tolerance() are skipped when possible.
+  maliput::api::RoadPositionResult CulledToRoadPosition(const maliput::api::InertialPosition& inertial_pos) const;
+
+  // Same as DoToRoadPosition() but a malidrive::Lane hint seeds the search.
+  maliput::api::RoadPositionResult ToRoadPositionInBatch(
+      const maliput::api::InertialPosition& inertial_pos,
+      const std::optional<maliput::api::RoadPosition>& hint) const;
+
   maliput::api::RoadPositionResult DoToRoadPosition(
       const maliput::api::InertialPosition& inertial_pos,
       const std::optional<maliput::api::RoadPosition>& hint) const override;
@@ -111,7 +356,26 @@ class RoadGeometry final : public maliput::geometry_base::RoadGeometry {
       const maliput::api::InertialPosition& inertial_position, double radius) const override;
 
   std::unique_ptr<xodr::DBManager> manager_;
+  bool simplified_geometries_{false};
   std::unordered_map<xodr::RoadHeader::Id, RoadCharacteristics> road_characteristics_;
+  // @{ The LaneGraph and the LaneStringIndex are built by the first call to lane_graph() or lane_string_index() when
+  //    `deferred_lane_change_penalty_` has a value.
+  std::optional<double> deferred_lane_change_penalty_;
+  mutable std::once_flag lane_graph_flag_;
+  mutable std::unique_ptr<LaneGraph> lane_graph_;
+  mutable std::unique_ptr<LaneStringIndex> lane_string_index_;
+  // @}
+  std::unique_ptr<XodrLaneIndex> xodr_lane_index_;
+  // @{ When `conflict_zones_finder_` is set, the ConflictZones of each Junction are computed by the first call to
+  //    GetConflictZones() for it, under the `flag` of its entry, so Junctions do not wait on each other. The map
+  //    itself is not modified after the build.
+  std::function<std::vector<ConflictZone>(const maliput::api::Junction*)> conflict_zones_finder_;
+  std::unordered_map<maliput::api::JunctionId, std::unique_ptr<JunctionConflictZones>> conflict_zones_;
+  // @}
+  // Cache of FindReachableLanes() keyed by LaneGraph node and sharded by `node % kLookaheadCacheNumShards`.
+  mutable std::array<LookaheadCacheShard, kLookaheadCacheNumShards> lookahead_cache_shards_;
+  mutable std::once_flag lane_bounding_boxes_flag_;
+  mutable std::vector<LaneBoundingBox> lane_bounding_boxes_;
 };
 
 }  // namespace malidrive
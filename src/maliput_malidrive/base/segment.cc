@@ -0,0 +1,75 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/base/segment.h"
+
+#include <algorithm>
+
+#include <maliput/api/junction.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/math/saturate.h>
+
+namespace malidrive {
+namespace {
+
+// @returns The Inertial to Backend Frame translation of the RoadGeometry that
+//          holds @p segment. When @p segment is not yet part of a RoadGeometry,
+//          a zero translation is returned.
+maliput::math::Vector3 GetInertialToBackendFrameTranslation(const maliput::api::Segment* segment) {
+  const maliput::api::Junction* junction = segment->junction();
+  if (junction == nullptr || junction->road_geometry() == nullptr) {
+    return {0., 0., 0.};
+  }
+  return junction->road_geometry()->inertial_to_backend_frame_translation();
+}
+
+}  // namespace
+
+Segment::CrossSection Segment::EvalCrossSection(double track_p) const {
+  MALIDRIVE_IS_IN_RANGE(track_p, p0_ - road_curve_->linear_tolerance(), p1_ + road_curve_->linear_tolerance());
+  const double p = maliput::math::saturate(track_p, p0_, p1_);
+
+  const road_curve::RoadCurve::Frame frame = road_curve_->EvalFrame(p);
+  const maliput::math::Vector3 r_hat = frame.rotation.col(1);
+  // Backend Frame positions are mapped to the Inertial Frame by adding the translation.
+  const maliput::math::Vector3 origin = frame.origin + GetInertialToBackendFrameTranslation(this);
+
+  CrossSection cross_section{p, {}};
+  cross_section.lanes.reserve(num_lanes());
+  for (int i = 0; i < num_lanes(); ++i) {
+    const Lane* lane = static_cast<const Lane*>(this->lane(i));
+    const double r_offset = lane->lane_offset()->f(p);
+    cross_section.lanes.push_back({lane, lane->LaneSFromTrackS(p), r_offset,
+                                   std::max(0., lane->lane_width()->f(p)),
+                                   maliput::api::InertialPosition::FromXyz(origin + r_offset * r_hat)});
+  }
+  return cross_section;
+}
+
+}  // namespace malidrive
@@ -33,6 +33,7 @@
 #include <utility>
 #include <vector>
 
+#include <maliput/api/lane_data.h>
 #include <maliput/geometry_base/segment.h>
 
 #include "maliput_malidrive/base/lane.h"
@@ -50,6 +51,32 @@ class Segment : public maliput::geometry_base::Segment {
  public:
   MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(Segment)
 
+  /// Holds the evaluation of a Lane at a certain @f$ p @f$ value of the
+  /// road_curve::RoadCurve.
+  struct LaneCrossSection {
+    /// The evaluated Lane.
+    const Lane* lane{};
+    /// The LANE Frame `s` coordinate.
+    double s{};
+    /// The lateral offset of the Lane's centerline with respect to the
+    /// road_curve::RoadCurve.
+    double r_offset{};
+    /// The width of the Lane. Negative widths are clamped to zero.
+    double width{};
+    /// The INERTIAL Frame position of the Lane's centerline.
+    maliput::api::InertialPosition inertial_position{};
+  };
+
+  /// Holds the evaluation of all the Lanes in a Segment at a certain
+  /// @f$ p @f$ value of the road_curve::RoadCurve.
+  struct CrossSection {
+    /// The @f$ p @f$ value of the road_curve::RoadCurve.
+    double p{};
+    /// One entry per Lane, ordered from right to left as in
+    /// maliput::api::Segment::lane().
+    std::vector<LaneCrossSection> lanes;
+  };
+
   /// Constructs a Segment.
   /// The incidence region of the Segment on the @p road_curve will be
   /// delimited by the range composed by @p p0 and @p p1.
@@ -91,6 +118,18 @@ class Segment : public maliput::geometry_base::Segment {
   /// @return The reference line offset function.
   const road_curve::Function* reference_line_offset() const { return reference_line_offset_; }
 
+  /// Evaluates all the Lanes of this Segment at @p track_p.
+  ///
+  /// The road_curve::RoadCurve Frame is evaluated once and shared by all the
+  /// Lanes, which is cheaper than querying each Lane separately.
+  /// Hidden lanes are not evaluated.
+  ///
+  /// @param track_p The @f$ p @f$ parameter of the road_curve::RoadCurve. It
+  ///        must be in [p0(), p1()] within the RoadCurve's linear tolerance.
+  /// @returns The CrossSection at @p track_p.
+  /// @throws maliput::common::assertion_error When @p track_p is out of range.
+  CrossSection EvalCrossSection(double track_p) const;
+
   /// Adds @p lane to the segment.
   /// @details If `hide_lane` is false, the call is forwarded to maliput::geometry_base::Segment::AddLane.
   /// If `hide_lane` is true, the segment becomes the lane's owner but the lane is hidden.
@@ -112,7 +151,8 @@ class Segment : public maliput::geometry_base::Segment {
   const double p0_{};
   const double p1_{};
   // When RoadCurveConfiguration::omit_nondriveable_lanes is true the non-drivable lanes should be omitted
-  // but their creation is neccesary to be consistent with other lanes.
+  // but their creation is neccesary to be consistent with other lanes. Only their width and offset functions are
+  // needed for that, so the builder defers their arc length integration.
   std::vector<std::unique_ptr<Lane>> hidden_lanes_;
 };
 
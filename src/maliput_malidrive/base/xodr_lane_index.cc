@@ -0,0 +1,142 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/base/xodr_lane_index.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+
+#include <maliput/api/junction.h>
+#include <maliput/api/segment.h>
+#include <maliput/math/saturate.h>
+
+namespace malidrive {
+
+XodrLaneIndex::XodrLaneIndex(const maliput::api::RoadGeometry& rg) : linear_tolerance_(rg.linear_tolerance()) {
+  // Lanes are grouped by XODR Road and LaneSection. A LaneSection is identified by its track `s` start.
+  std::map<int, std::map<double, std::vector<const Lane*>>> lanes_by_track;
+  for (int i = 0; i < rg.num_junctions(); ++i) {
+    const maliput::api::Junction* junction = rg.junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const maliput::api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        const Lane* lane = dynamic_cast<const Lane*>(segment->lane(k));
+        MALIDRIVE_THROW_UNLESS(lane != nullptr);
+        lanes_by_track[lane->get_track()][lane->get_track_s_start()].push_back(lane);
+      }
+    }
+  }
+
+  for (const auto& [track_id, lane_sections] : lanes_by_track) {
+    tracks_[track_id] = {static_cast<int>(lane_sections_.size()),
+                         static_cast<int>(lane_sections_.size() + lane_sections.size())};
+    for (const auto& [track_s_start, lanes] : lane_sections) {
+      const int lanes_begin = static_cast<int>(lanes_.size());
+      for (const Lane* lane : lanes) {
+        lanes_.emplace_back(lane->get_lane_id(), lane);
+      }
+      std::sort(lanes_.begin() + lanes_begin, lanes_.end());
+      lane_sections_.push_back({track_s_start, lanes.front()->get_track_s_end(), lanes_begin,
+                                static_cast<int>(lanes_.size())});
+    }
+  }
+}
+
+const Lane* XodrLaneIndex::FindLane(int track_id, double track_s, int lane_id) const {
+  const auto track_it = tracks_.find(track_id);
+  if (track_it == tracks_.end()) {
+    return nullptr;
+  }
+  const auto lane_sections_begin = lane_sections_.begin() + track_it->second.lane_sections_begin;
+  const auto lane_sections_end = lane_sections_.begin() + track_it->second.lane_sections_end;
+  if (track_s < lane_sections_begin->track_s_start - linear_tolerance_ ||
+      track_s > std::prev(lane_sections_end)->track_s_end + linear_tolerance_) {
+    return nullptr;
+  }
+  // The last LaneSection that starts at or before `track_s`, or the first one when `track_s` is before the Road.
+  auto lane_section_it =
+      std::upper_bound(lane_sections_begin, lane_sections_end, track_s,
+                       [](double s, const LaneSection& lane_section) { return s < lane_section.track_s_start; });
+  if (lane_section_it != lane_sections_begin) {
+    --lane_section_it;
+  }
+  // LaneSections without Lanes, e.g. those whose Lanes are all omitted, have no entry, so `track_s` may fall in the
+  // gap after the LaneSection found.
+  if (track_s > lane_section_it->track_s_end + linear_tolerance_) {
+    return nullptr;
+  }
+  const auto lanes_begin = lanes_.begin() + lane_section_it->lanes_begin;
+  const auto lanes_end = lanes_.begin() + lane_section_it->lanes_end;
+  const auto lane_it = std::lower_bound(
+      lanes_begin, lanes_end, lane_id,
+      [](const std::pair<int, const Lane*>& id_and_lane, int id) { return id_and_lane.first < id; });
+  return lane_it != lanes_end && lane_it->first == lane_id ? lane_it->second : nullptr;
+}
+
+std::optional<maliput::api::RoadPosition> XodrLaneIndex::ToRoadPosition(
+    const XodrLanePosition& xodr_lane_position) const {
+  const Lane* lane = FindLane(xodr_lane_position.track_id, xodr_lane_position.track_s, xodr_lane_position.lane_id);
+  if (lane == nullptr) {
+    return std::nullopt;
+  }
+  const double track_s =
+      maliput::math::saturate(xodr_lane_position.track_s, lane->get_track_s_start(), lane->get_track_s_end());
+  const double s = maliput::math::saturate(lane->LaneSFromTrackS(track_s), 0., lane->length());
+  return maliput::api::RoadPosition{lane, maliput::api::LanePosition(s, xodr_lane_position.offset, 0.)};
+}
+
+XodrLaneIndex::XodrLanePosition XodrLaneIndex::ToXodrLanePosition(const Lane* lane,
+                                                                  const maliput::api::LanePosition& lane_position) {
+  MALIDRIVE_THROW_UNLESS(lane != nullptr);
+  const double s = maliput::math::saturate(lane_position.s(), 0., lane->length());
+  return {lane->get_track(), lane->TrackSFromLaneS(s), lane->get_lane_id(), lane_position.r()};
+}
+
+void XodrLaneIndex::ToRoadPositions(const std::vector<XodrLanePosition>& xodr_lane_positions,
+                                    std::vector<std::optional<maliput::api::RoadPosition>>* road_positions) const {
+  MALIDRIVE_THROW_UNLESS(road_positions != nullptr);
+  road_positions->resize(xodr_lane_positions.size());
+  std::transform(xodr_lane_positions.begin(), xodr_lane_positions.end(), road_positions->begin(),
+                 [this](const XodrLanePosition& xodr_lane_position) { return ToRoadPosition(xodr_lane_position); });
+}
+
+void XodrLaneIndex::ToXodrLanePositions(const std::vector<maliput::api::RoadPosition>& road_positions,
+                                        std::vector<XodrLanePosition>* xodr_lane_positions) {
+  MALIDRIVE_THROW_UNLESS(xodr_lane_positions != nullptr);
+  xodr_lane_positions->resize(road_positions.size());
+  std::transform(road_positions.begin(), road_positions.end(), xodr_lane_positions->begin(),
+                 [](const maliput::api::RoadPosition& road_position) {
+                   const Lane* lane = dynamic_cast<const Lane*>(road_position.lane);
+                   MALIDRIVE_THROW_UNLESS(lane != nullptr);
+                   return ToXodrLanePosition(lane, road_position.pos);
+                 });
+}
+
+}  // namespace malidrive
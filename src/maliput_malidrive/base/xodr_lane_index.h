@@ -0,0 +1,149 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+
+#include "maliput_malidrive/base/lane.h"
+#include "maliput_malidrive/common/macros.h"
+
+namespace malidrive {
+
+/// Index of the Lanes of a RoadGeometry by their XODR coordinates.
+///
+/// Scenario descriptions, e.g. OpenSCENARIO, address positions by XODR Road
+/// ID, track `s` coordinate, XODR Lane ID and lateral offset. This index maps
+/// them to Lanes without building LaneIds: Roads are hashed, and the
+/// LaneSections of a Road and the Lanes of a LaneSection are sorted so each
+/// lookup is a binary search.
+class XodrLaneIndex {
+ public:
+  MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(XodrLaneIndex);
+
+  /// Holds a position in XODR coordinates.
+  struct XodrLanePosition {
+    /// The XODR Road ID.
+    int track_id{};
+    /// The track `s` coordinate.
+    double track_s{};
+    /// The XODR Lane ID.
+    int lane_id{};
+    /// The lateral offset from the Lane's centerline.
+    double offset{};
+  };
+
+  /// Constructs a XodrLaneIndex out of @p rg.
+  ///
+  /// @param rg The RoadGeometry. All its Lanes must be malidrive::Lanes and it
+  ///        must outlive this object.
+  /// @throws maliput::common::assertion_error When a Lane of @p rg is not a
+  ///         malidrive::Lane.
+  explicit XodrLaneIndex(const maliput::api::RoadGeometry& rg);
+
+  /// Finds the Lane at @p track_s of the XODR Road @p track_id whose XODR
+  /// Lane ID is @p lane_id.
+  ///
+  /// @param track_id The XODR Road ID.
+  /// @param track_s The track `s` coordinate. It may exceed the Road's extents
+  ///        by up to the RoadGeometry's linear tolerance. At the boundary
+  ///        between two LaneSections, the latter is used.
+  /// @param lane_id The XODR Lane ID.
+  /// @returns The Lane, or nullptr when there is none.
+  const Lane* FindLane(int track_id, double track_s, int lane_id) const;
+
+  /// Maps @p xodr_lane_position to a RoadPosition.
+  ///
+  /// @param xodr_lane_position The position in XODR coordinates.
+  /// @returns The RoadPosition whose `s` coordinate matches the saturated track
+  ///          `s` coordinate, and whose `r` coordinate is the offset. It is
+  ///          std::nullopt when FindLane() finds no Lane.
+  std::optional<maliput::api::RoadPosition> ToRoadPosition(const XodrLanePosition& xodr_lane_position) const;
+
+  /// Maps @p lane_position in @p lane to XODR coordinates.
+  ///
+  /// @param lane The Lane. It must not be nullptr.
+  /// @param lane_position The LanePosition in @p lane.
+  /// @returns The XodrLanePosition.
+  /// @throws maliput::common::assertion_error When @p lane is nullptr.
+  static XodrLanePosition ToXodrLanePosition(const Lane* lane, const maliput::api::LanePosition& lane_position);
+
+  /// Batched version of ToRoadPosition().
+  ///
+  /// @param xodr_lane_positions The positions in XODR coordinates.
+  /// @param road_positions The output. It must not be nullptr. It is resized to
+  ///        match @p xodr_lane_positions.
+  /// @throws maliput::common::assertion_error When @p road_positions is
+  ///         nullptr.
+  void ToRoadPositions(const std::vector<XodrLanePosition>& xodr_lane_positions,
+                       std::vector<std::optional<maliput::api::RoadPosition>>* road_positions) const;
+
+  /// Batched version of ToXodrLanePosition().
+  ///
+  /// @param road_positions The RoadPositions. Their Lanes must be
+  ///        malidrive::Lanes.
+  /// @param xodr_lane_positions The output. It must not be nullptr. It is
+  ///        resized to match @p road_positions.
+  /// @throws maliput::common::assertion_error When @p xodr_lane_positions is
+  ///         nullptr.
+  /// @throws maliput::common::assertion_error When a Lane of
+  ///         @p road_positions is not a malidrive::Lane.
+  static void ToXodrLanePositions(const std::vector<maliput::api::RoadPosition>& road_positions,
+                                  std::vector<XodrLanePosition>* xodr_lane_positions);
+
+ private:
+  // LaneSection of a XODR Road. Its Lanes are in [lanes_begin, lanes_end) of `lanes_`.
+  struct LaneSection {
+    double track_s_start{};
+    double track_s_end{};
+    int lanes_begin{};
+    int lanes_end{};
+  };
+
+  // LaneSections of a XODR Road, sorted by `track_s_start`, are in [lane_sections_begin, lane_sections_end) of
+  // `lane_sections_`.
+  struct Track {
+    int lane_sections_begin{};
+    int lane_sections_end{};
+  };
+
+  double linear_tolerance_{};
+  std::unordered_map<int, Track> tracks_;
+  std::vector<LaneSection> lane_sections_;
+  // Lanes of each LaneSection, sorted by XODR Lane ID.
+  std::vector<std::pair<int, const Lane*>> lanes_;
+};
+
+}  // namespace malidrive
@@ -88,11 +88,18 @@ const std::map<xodr::Lane::Type, XodrLaneProperties> kXodrLaneTypesToMaliputProp
     {xodr::Lane::Type::kConnectingRamp, {true, "NonPedestrians", {}}},
 };
 
+// @returns True when `road_id` is in `built_road_ids`, or when all the XODR Roads are being built.
+bool IsRoadBuilt(const xodr::RoadHeader::Id& road_id,
+                 const std::optional<std::set<xodr::RoadHeader::Id>>& built_road_ids) {
+  return !built_road_ids.has_value() || built_road_ids->find(road_id) != built_road_ids->end();
+}
+
 }  // namespace
 
 std::vector<maliput::api::LaneEnd> SolveLaneEndsForConnectingRoad(
     const maliput::api::RoadGeometry* rg, const MalidriveXodrLaneProperties& xodr_lane_properties,
-    const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers, XodrConnectionType connection_type) {
+    const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers, XodrConnectionType connection_type,
+    const std::optional<std::set<xodr::RoadHeader::Id>>& built_road_ids) {
   MALIDRIVE_THROW_UNLESS(rg != nullptr);
 
   std::vector<maliput::api::LaneEnd> connecting_lane_ends;
@@ -117,6 +124,11 @@ std::vector<maliput::api::LaneEnd> SolveLaneEndsForConnectingRoad(
   MALIDRIVE_VALIDATE(
       road_headers.find(road_header_id) != road_headers.end(), maliput::common::assertion_error,
       "SolveLaneEndsForConnectingRoad(). RoadLink pointing to missing Xodr Road(" + road_header_id.string() + ").");
+  if (!IsRoadBuilt(road_header_id, built_road_ids)) {
+    maliput::log()->trace("Xodr Road(", road_header_id.string(), ") linked from Xodr Road(",
+                          xodr_lane_properties.road_header->id.string(), ") is not being built.");
+    return connecting_lane_ends;
+  }
 
   const xodr::RoadHeader& road_header = road_headers.at(road_header_id);
 
@@ -146,7 +158,8 @@ std::vector<maliput::api::LaneEnd> SolveLaneEndsForConnectingRoad(
 std::vector<maliput::api::LaneEnd> SolveLaneEndsForJunction(
     const maliput::api::RoadGeometry* rg, const MalidriveXodrLaneProperties& xodr_lane_properties,
     const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers,
-    const std::unordered_map<xodr::Junction::Id, xodr::Junction>& junctions, XodrConnectionType connection_type) {
+    const std::unordered_map<xodr::Junction::Id, xodr::Junction>& junctions, XodrConnectionType connection_type,
+    const std::optional<std::set<xodr::RoadHeader::Id>>& built_road_ids) {
   MALIDRIVE_THROW_UNLESS(rg != nullptr);
 
   std::vector<maliput::api::LaneEnd> connecting_lane_ends;
@@ -186,6 +199,11 @@ std::vector<maliput::api::LaneEnd> SolveLaneEndsForJunction(
                          "SolveLaneEndsForJunction(). Xodr Junction(" + road_link->element_id.string() +
                              ") has Xodr Connection(" + connection.first.string() + ") with a connecting Xodr Road(" +
                              connection.second.connecting_road + ") that cannot be found.");
+      if (!IsRoadBuilt(road_header->first, built_road_ids)) {
+        maliput::log()->trace("Xodr Road(", road_header->first.string(), ") connected through Xodr Junction(",
+                              road_link->element_id.string(), ") is not being built.");
+        continue;
+      }
       // If the `contact_point` is a start point then we take the first LaneSection, otherwise we take the last
       // LaneSection.
       const int xodr_connecting_lane_section_index =
@@ -211,7 +229,8 @@ std::vector<maliput::api::LaneEnd> SolveLaneEndsForJunction(
 
 std::vector<maliput::api::LaneEnd> SolveLaneEndsWithinJunction(
     const maliput::api::RoadGeometry* rg, const MalidriveXodrLaneProperties& xodr_lane_properties,
-    const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers, XodrConnectionType connection_type) {
+    const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers, XodrConnectionType connection_type,
+    const std::optional<std::set<xodr::RoadHeader::Id>>& built_road_ids) {
   MALIDRIVE_THROW_UNLESS(rg != nullptr);
   // Successor / Predecessor is a road.
   const std::optional<xodr::RoadLink::LinkAttributes> road_link =
@@ -228,7 +247,7 @@ std::vector<maliput::api::LaneEnd> SolveLaneEndsWithinJunction(
   if (road_link->element_type == xodr::RoadLink::ElementType::kJunction) {
     MALIDRIVE_THROW_MESSAGE("Junctions connected to junctions are not supported.");
   }
-  return SolveLaneEndsForConnectingRoad(rg, xodr_lane_properties, road_headers, connection_type);
+  return SolveLaneEndsForConnectingRoad(rg, xodr_lane_properties, road_headers, connection_type, built_road_ids);
 }
 
 std::vector<maliput::api::LaneEnd> SolveLaneEndsForInnerLaneSection(
@@ -388,6 +407,9 @@ std::vector<rules::XodrSpeedProperties> GetLaneSpeedProperties(const xodr::Lane&
 
 const xodr::RoadHeader& GetXodrRoadFromMalidriveLane(const Lane* lane) {
   MALIDRIVE_THROW_UNLESS(lane != nullptr);
+  if (lane->get_xodr_road_header() != nullptr) {
+    return *lane->get_xodr_road_header();
+  }
   const xodr::DBManager* manager =
       static_cast<const malidrive::RoadGeometry*>(lane->segment()->junction()->road_geometry())->get_manager();
   MALIDRIVE_THROW_UNLESS(manager != nullptr);
@@ -405,6 +427,9 @@ const xodr::RoadHeader& GetXodrRoadFromMalidriveLane(const Lane* lane) {
 
 const xodr::Lane& GetXodrLaneFromMalidriveLane(const Lane* lane) {
   MALIDRIVE_THROW_UNLESS(lane != nullptr);
+  if (lane->get_xodr_lane() != nullptr) {
+    return *lane->get_xodr_lane();
+  }
   const xodr::RoadHeader& road_header = GetXodrRoadFromMalidriveLane(lane);
   const double s_half{(lane->get_track_s_end() - lane->get_track_s_start()) / 2 + lane->get_track_s_start()};
   const int lane_section_index = road_header.GetLaneSectionIndex(s_half);
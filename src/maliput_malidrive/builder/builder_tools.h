@@ -29,11 +29,17 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
+#include <future>
+#include <iterator>
 #include <optional>
+#include <set>
 #include <string>
+#include <vector>
 
 #include <maliput/api/lane_data.h>
 #include <maliput/api/road_geometry.h>
+#include <maliput/utility/thread_pool.h>
 
 #include "maliput_malidrive/base/lane.h"
 #include "maliput_malidrive/builder/rule_tools.h"
@@ -90,13 +96,16 @@ struct MalidriveXodrLaneProperties {
 /// @param road_headers RoadHeaders of the XODR Map.
 /// @param connection_type Is the type (successor or predecessor) of link that
 ///        is solved.
+/// @param built_road_ids XODR Roads being built. Links to XODR Roads out of it
+///        are skipped. When std::nullopt, all the XODR Roads are being built.
 ///
 /// @throws maliput::common::assertion_error When `rg` is nullptr.
 /// @throws maliput::common::assertion_error When there isn't a valid RoadLink.
 /// @throws maliput::common::assertion_error When there isn't a valid LaneLink.
 std::vector<maliput::api::LaneEnd> SolveLaneEndsForConnectingRoad(
     const maliput::api::RoadGeometry* rg, const MalidriveXodrLaneProperties& xodr_lane_properties,
-    const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers, XodrConnectionType connection_type);
+    const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers, XodrConnectionType connection_type,
+    const std::optional<std::set<xodr::RoadHeader::Id>>& built_road_ids = std::nullopt);
 
 /// Searches which LaneEnds connect to `xodr_lane_properties.lane` in `connection_type` direction
 /// considering the LaneEnd belongs to an external interface with a XODR Junction but the XODR Road does
@@ -109,6 +118,8 @@ std::vector<maliput::api::LaneEnd> SolveLaneEndsForConnectingRoad(
 /// @param junctions Junctions of the XODR Map.
 /// @param connection_type Is the type (successor or predecessor) of link that
 ///        is solved.
+/// @param built_road_ids XODR Roads being built. Links to XODR Roads out of it
+///        are skipped. When std::nullopt, all the XODR Roads are being built.
 ///
 /// @throws maliput::common::assertion_error When either `rg` is nullptr.
 /// @throws maliput::common::assertion_error When there isn't a valid RoadLink.
@@ -116,7 +127,8 @@ std::vector<maliput::api::LaneEnd> SolveLaneEndsForConnectingRoad(
 std::vector<maliput::api::LaneEnd> SolveLaneEndsForJunction(
     const maliput::api::RoadGeometry* rg, const MalidriveXodrLaneProperties& xodr_lane_properties,
     const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers,
-    const std::unordered_map<xodr::Junction::Id, xodr::Junction>& junctions, XodrConnectionType connection_type);
+    const std::unordered_map<xodr::Junction::Id, xodr::Junction>& junctions, XodrConnectionType connection_type,
+    const std::optional<std::set<xodr::RoadHeader::Id>>& built_road_ids = std::nullopt);
 
 /// Searches which LaneEnds connect to `xodr_lane_properties.lane` in `connection_type` direction
 /// considering the LaneEnd belongs to an external interface. The XODR Road that contains the LaneEnd is
@@ -128,12 +140,15 @@ std::vector<maliput::api::LaneEnd> SolveLaneEndsForJunction(
 /// @param road_headers RoadHeaders of the XODR Map.
 /// @param connection_type Is the type (successor or predecessor) of link that
 ///        is solved.
+/// @param built_road_ids XODR Roads being built. Links to XODR Roads out of it
+///        are skipped. When std::nullopt, all the XODR Roads are being built.
 ///
 /// @throws maliput::common::assertion_error When either `rg` is nullptr.
 /// @throws maliput::common::assertion_error When the RoadLink links to a junction.
 std::vector<maliput::api::LaneEnd> SolveLaneEndsWithinJunction(
     const maliput::api::RoadGeometry* rg, const MalidriveXodrLaneProperties& xodr_lane_properties,
-    const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers, XodrConnectionType connection_type);
+    const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers, XodrConnectionType connection_type,
+    const std::optional<std::set<xodr::RoadHeader::Id>>& built_road_ids = std::nullopt);
 
 /// Searches which LaneEnds connect to `lane_end` considering it
 /// belongs to an inner interface.
@@ -298,13 +313,17 @@ std::vector<rules::XodrSpeedProperties> GetLaneSpeedProperties(const xodr::Lane&
                                                                double s_track_end);
 
 /// @returns The xodr::RoadHeader that matches with the Road that contains `lane`.
+///          When `lane` holds it (see Lane::SetXodrLane()) it is returned
+///          directly, otherwise it is looked up by ID.
 /// @param lane The Lane to retrieve its correspondant xodr::RoadHeader. It must not be nullptr.
 ///
 /// @throws maliput::common::assertion_error When lane is nullptr.
 /// @throws maliput::common::assertion_error When the correspondant xodr::RoadHeader cannot be found.
 const xodr::RoadHeader& GetXodrRoadFromMalidriveLane(const Lane* lane);
 
-/// @returns The xodr::Lane that matches with `lane`.
+/// @returns The xodr::Lane that matches with `lane`. When `lane` holds it
+///          (see Lane::SetXodrLane()) it is returned directly, otherwise it is
+///          looked up by ID.
 /// @param lane The Lane to retrieve its correspondant xodr::Lane. It must not be nullptr.
 ///
 /// @throws maliput::common::assertion_error When lane is nullptr.
@@ -355,5 +374,49 @@ std::pair<std::string, std::optional<std::string>> VehicleUsageAndExclusiveRuleS
 /// @returns The p value that matches a local min in the cubic, if exists.
 std::optional<double> FindLocalMinFromCubicPol(double a, double b, double c, double d);
 
+/// Runs `num_tasks` independent tasks and concatenates their results in task
+/// order, so the output does not depend on how tasks are scheduled.
+///
+/// @tparam T The type of the elements the tasks produce.
+/// @tparam Task A callable with signature `std::vector<T>(int task_index)`.
+///         It must be safe to call it concurrently with different indices.
+/// @param num_tasks The number of tasks. It must be non-negative.
+/// @param num_threads The number of threads. When it is 1, the calling thread
+///        runs all the tasks, otherwise they are queued in a
+///        maliput::utility::ThreadPool. It must be positive.
+/// @param task The task to call with each index in [0, `num_tasks`).
+/// @returns The concatenation of the results of `task`.
+/// @throws maliput::common::assertion_error When `num_tasks` is negative or
+///         `num_threads` is zero.
+template <typename T, typename Task>
+std::vector<T> ConcatenateTaskResults(int num_tasks, std::size_t num_threads, Task task) {
+  MALIDRIVE_THROW_UNLESS(num_tasks >= 0);
+  MALIDRIVE_THROW_UNLESS(num_threads > 0);
+  std::vector<std::vector<T>> task_results(num_tasks);
+  if (num_threads == 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      task_results[i] = task(i);
+    }
+  } else {
+    maliput::utility::ThreadPool task_executor(num_threads);
+    std::vector<std::future<std::vector<T>>> futures;
+    for (int i = 0; i < num_tasks; ++i) {
+      futures.push_back(task_executor.Queue([&task, i]() { return task(i); }));
+    }
+    // The threads are on hold until start method is called.
+    task_executor.Start();
+    task_executor.Finish();
+    for (int i = 0; i < num_tasks; ++i) {
+      task_results[i] = futures[i].get();
+    }
+  }
+  std::vector<T> results;
+  for (auto& task_result : task_results) {
+    results.insert(results.end(), std::make_move_iterator(task_result.begin()),
+                   std::make_move_iterator(task_result.end()));
+  }
+  return results;
+}
+
 }  // namespace builder
 }  // namespace malidrive
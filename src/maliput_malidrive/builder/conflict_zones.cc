@@ -0,0 +1,276 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/builder/conflict_zones.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include <maliput/api/lane_data.h>
+#include <maliput/api/segment.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_malidrive/common/macros.h"
+
+namespace malidrive {
+namespace builder {
+namespace {
+
+using maliput::math::Vector2;
+
+// Maximum distance along a Lane between two samples of its footprint.
+constexpr double kSamplingStep{0.5};  // [m]
+
+// Quadrilateral between two consecutive samples of a footprint.
+using Quad = std::array<Vector2, 4>;
+// Cross section of a footprint at a certain `s`.
+using CrossSection = std::array<Vector2, 2>;
+
+// Footprint of a Lane in the x-y plane of the Inertial Frame, sampled at `s`.
+struct Footprint {
+  const maliput::api::Lane* lane{};
+  std::vector<double> s;
+  std::vector<CrossSection> cross_sections;
+  // Axis-aligned bounding box of the footprint.
+  Vector2 min;
+  Vector2 max;
+};
+
+// @returns The cross section of `lane` at `s`, i.e. the segment between its lane bounds shrunk by `margin`. Lanes
+//          narrower than twice `margin` collapse to their center.
+CrossSection ComputeCrossSection(const maliput::api::Lane* lane, double s, double margin) {
+  const maliput::api::RBounds bounds = lane->lane_bounds(s);
+  const double r_center = (bounds.min() + bounds.max()) / 2.;
+  const double r_min = std::min(bounds.min() + margin, r_center);
+  const double r_max = std::max(bounds.max() - margin, r_center);
+  const maliput::api::InertialPosition left = lane->ToInertialPosition({s, r_max, 0.});
+  const maliput::api::InertialPosition right = lane->ToInertialPosition({s, r_min, 0.});
+  return {Vector2(left.x(), left.y()), Vector2(right.x(), right.y())};
+}
+
+// @returns The Footprint of `lane` sampled every kSamplingStep at most. The footprint is shrunk by `margin` along
+//          `s` too, so Lanes that only meet at their ends (e.g. through a BranchPoint) do not overlap.
+Footprint ComputeFootprint(const maliput::api::Lane* lane, double margin) {
+  constexpr double kInfinity{std::numeric_limits<double>::infinity()};
+  Footprint footprint{lane, {}, {}, Vector2(kInfinity, kInfinity), Vector2(-kInfinity, -kInfinity)};
+  const double s_margin = std::min(margin, lane->length() / 2.);
+  const double s_start = s_margin;
+  const double s_end = lane->length() - s_margin;
+  const int num_quads = std::max(1, static_cast<int>(std::ceil((s_end - s_start) / kSamplingStep)));
+  for (int i = 0; i <= num_quads; ++i) {
+    const double s = s_start + (s_end - s_start) * static_cast<double>(i) / static_cast<double>(num_quads);
+    footprint.s.push_back(s);
+    footprint.cross_sections.push_back(ComputeCrossSection(lane, s, margin));
+    for (const Vector2& point : footprint.cross_sections.back()) {
+      footprint.min = Vector2(std::min(footprint.min.x(), point.x()), std::min(footprint.min.y(), point.y()));
+      footprint.max = Vector2(std::max(footprint.max.x(), point.x()), std::max(footprint.max.y(), point.y()));
+    }
+  }
+  return footprint;
+}
+
+// @returns The `i`-th Quad of `footprint`.
+Quad GetQuad(const Footprint& footprint, int i) {
+  return {footprint.cross_sections[i][1], footprint.cross_sections[i + 1][1], footprint.cross_sections[i + 1][0],
+          footprint.cross_sections[i][0]};
+}
+
+// @returns True when the axis-aligned bounding boxes of `a` and `b` overlap.
+template <std::size_t N, std::size_t M>
+bool BoundingBoxesOverlap(const std::array<Vector2, N>& a, const std::array<Vector2, M>& b) {
+  for (int axis = 0; axis < 2; ++axis) {
+    const auto by_axis = [axis](const Vector2& lhs, const Vector2& rhs) { return lhs[axis] < rhs[axis]; };
+    const auto [a_min, a_max] = std::minmax_element(a.begin(), a.end(), by_axis);
+    const auto [b_min, b_max] = std::minmax_element(b.begin(), b.end(), by_axis);
+    if ((*a_max)[axis] < (*b_min)[axis] || (*b_max)[axis] < (*a_min)[axis]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// @returns True when a normal of an edge of the convex polygon `a` separates `a` from the convex polygon `b`.
+template <std::size_t N, std::size_t M>
+bool HasSeparatingAxis(const std::array<Vector2, N>& a, const std::array<Vector2, M>& b) {
+  for (std::size_t i = 0; i < N; ++i) {
+    const Vector2 edge = a[(i + 1) % N] - a[i];
+    const Vector2 axis(-edge.y(), edge.x());
+    double a_min{std::numeric_limits<double>::infinity()};
+    double a_max{-std::numeric_limits<double>::infinity()};
+    for (const Vector2& point : a) {
+      a_min = std::min(a_min, axis.dot(point));
+      a_max = std::max(a_max, axis.dot(point));
+    }
+    double b_min{std::numeric_limits<double>::infinity()};
+    double b_max{-std::numeric_limits<double>::infinity()};
+    for (const Vector2& point : b) {
+      b_min = std::min(b_min, axis.dot(point));
+      b_max = std::max(b_max, axis.dot(point));
+    }
+    if (a_max < b_min || b_max < a_min) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// @returns True when the convex polygons `a` and `b` overlap. Segments are degenerate polygons.
+template <std::size_t N, std::size_t M>
+bool ConvexPolygonsOverlap(const std::array<Vector2, N>& a, const std::array<Vector2, M>& b) {
+  return BoundingBoxesOverlap(a, b) && !HasSeparatingAxis(a, b) && !HasSeparatingAxis(b, a);
+}
+
+// @returns True when `cross_section` overlaps any Quad of `footprint`.
+bool CrossSectionHitsFootprint(const CrossSection& cross_section, const Footprint& footprint) {
+  for (int i = 0; i + 1 < static_cast<int>(footprint.s.size()); ++i) {
+    if (ConvexPolygonsOverlap(cross_section, GetQuad(footprint, i))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// @returns The `s` intervals of `footprint` whose cross sections hit `other_footprint`. Interval extremes are refined
+//          by bisection up to `linear_tolerance`.
+std::vector<std::pair<double, double>> FindSIntervals(const Footprint& footprint, const Footprint& other_footprint,
+                                                      double linear_tolerance) {
+  const int num_samples = static_cast<int>(footprint.s.size());
+  std::vector<bool> hits(num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    hits[i] = CrossSectionHitsFootprint(footprint.cross_sections[i], other_footprint);
+  }
+  // @returns The `s` closest to the transition between `s_hit`, whose cross section hits `other_footprint`, and
+  //          `s_miss`, whose cross section does not, on the side of `s_hit`.
+  const auto refine = [&](double s_hit, double s_miss) {
+    while (std::abs(s_miss - s_hit) > linear_tolerance) {
+      const double s_mid = (s_hit + s_miss) / 2.;
+      if (CrossSectionHitsFootprint(ComputeCrossSection(footprint.lane, s_mid, linear_tolerance), other_footprint)) {
+        s_hit = s_mid;
+      } else {
+        s_miss = s_mid;
+      }
+    }
+    return s_hit;
+  };
+
+  std::vector<std::pair<double, double>> s_intervals;
+  for (int i = 0; i < num_samples; ++i) {
+    if (!hits[i]) {
+      continue;
+    }
+    const double s_start = i == 0 ? footprint.s[i] : refine(footprint.s[i], footprint.s[i - 1]);
+    while (i + 1 < num_samples && hits[i + 1]) {
+      ++i;
+    }
+    const double s_end = i + 1 == num_samples ? footprint.s[i] : refine(footprint.s[i], footprint.s[i + 1]);
+    s_intervals.push_back({s_start, s_end});
+  }
+  return s_intervals;
+}
+
+// @returns The Quads of `footprint` that overlap `s_interval`, extended by one Quad on each side.
+std::pair<int, int> GetQuadRange(const Footprint& footprint, const std::pair<double, double>& s_interval) {
+  const int num_quads = static_cast<int>(footprint.s.size()) - 1;
+  const int first = static_cast<int>(std::upper_bound(footprint.s.begin(), footprint.s.end(), s_interval.first) -
+                                     footprint.s.begin()) -
+                    2;
+  const int last = static_cast<int>(std::lower_bound(footprint.s.begin(), footprint.s.end(), s_interval.second) -
+                                    footprint.s.begin()) +
+                   1;
+  return {std::max(first, 0), std::min(last, num_quads)};
+}
+
+// @returns True when the Quads of `footprint_a` within `s_interval_a` overlap the Quads of `footprint_b` within
+//          `s_interval_b`.
+bool SIntervalsOverlap(const Footprint& footprint_a, const std::pair<double, double>& s_interval_a,
+                       const Footprint& footprint_b, const std::pair<double, double>& s_interval_b) {
+  const auto [first_a, last_a] = GetQuadRange(footprint_a, s_interval_a);
+  const auto [first_b, last_b] = GetQuadRange(footprint_b, s_interval_b);
+  for (int i = first_a; i < last_a; ++i) {
+    const Quad quad_a = GetQuad(footprint_a, i);
+    for (int j = first_b; j < last_b; ++j) {
+      if (ConvexPolygonsOverlap(quad_a, GetQuad(footprint_b, j))) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+std::vector<ConflictZone> FindConflictZones(const maliput::api::Junction* junction, double linear_tolerance) {
+  MALIDRIVE_THROW_UNLESS(junction != nullptr);
+  MALIDRIVE_THROW_UNLESS(linear_tolerance > 0.);
+
+  std::vector<Footprint> footprints;
+  for (int i = 0; i < junction->num_segments(); ++i) {
+    const maliput::api::Segment* segment = junction->segment(i);
+    for (int j = 0; j < segment->num_lanes(); ++j) {
+      footprints.push_back(ComputeFootprint(segment->lane(j), linear_tolerance));
+    }
+  }
+
+  std::vector<ConflictZone> conflict_zones;
+  for (std::size_t i = 0; i < footprints.size(); ++i) {
+    const Footprint& footprint_a = footprints[i];
+    for (std::size_t j = i + 1; j < footprints.size(); ++j) {
+      const Footprint& footprint_b = footprints[j];
+      if (footprint_a.lane->segment() == footprint_b.lane->segment() || footprint_a.max.x() < footprint_b.min.x() ||
+          footprint_b.max.x() < footprint_a.min.x() || footprint_a.max.y() < footprint_b.min.y() ||
+          footprint_b.max.y() < footprint_a.min.y()) {
+        continue;
+      }
+      const std::vector<std::pair<double, double>> s_intervals_a =
+          FindSIntervals(footprint_a, footprint_b, linear_tolerance);
+      if (s_intervals_a.empty()) {
+        continue;
+      }
+      const std::vector<std::pair<double, double>> s_intervals_b =
+          FindSIntervals(footprint_b, footprint_a, linear_tolerance);
+      for (const auto& s_interval_a : s_intervals_a) {
+        for (const auto& s_interval_b : s_intervals_b) {
+          if ((s_intervals_a.size() == 1 && s_intervals_b.size() == 1) ||
+              SIntervalsOverlap(footprint_a, s_interval_a, footprint_b, s_interval_b)) {
+            conflict_zones.push_back({footprint_a.lane, maliput::api::SRange(s_interval_a.first, s_interval_a.second),
+                                      footprint_b.lane, maliput::api::SRange(s_interval_b.first, s_interval_b.second)});
+          }
+        }
+      }
+    }
+  }
+  return conflict_zones;
+}
+
+}  // namespace builder
+}  // namespace malidrive
@@ -0,0 +1,65 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <vector>
+
+#include <maliput/api/junction.h>
+
+#include "maliput_malidrive/base/conflict_zone.h"
+
+namespace malidrive {
+namespace builder {
+
+/// Finds the ConflictZones of every pair of Lanes of @p junction.
+///
+/// Each Lane's footprint is the region between its lane bounds, shrunk by
+/// @p linear_tolerance both across and along the Lane so Lanes that only share
+/// a border or only meet end to start do not conflict, and projected onto the
+/// x-y plane of the Inertial Frame. Footprints are
+/// sampled into quadrilaterals; pairs whose bounding boxes are apart are
+/// culled. The `s` interval of a Lane is where its cross section intersects
+/// the other Lane's footprint, and its extremes are refined by bisection up to
+/// @p linear_tolerance.
+///
+/// Pairs of Lanes of the same Segment are skipped because they are laterally
+/// stacked.
+///
+/// @param junction The Junction to analyze. It must not be nullptr.
+/// @param linear_tolerance The tolerance. It must be positive.
+/// @returns The ConflictZones of @p junction. `lane_a` precedes `lane_b` in
+///          the order of @p junction's Segments and Lanes.
+/// @throws maliput::common::assertion_error When @p junction is nullptr.
+/// @throws maliput::common::assertion_error When @p linear_tolerance is not
+///         positive.
+std::vector<ConflictZone> FindConflictZones(const maliput::api::Junction* junction, double linear_tolerance);
+
+}  // namespace builder
+}  // namespace malidrive
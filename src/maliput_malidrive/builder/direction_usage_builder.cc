@@ -29,6 +29,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/builder/direction_usage_builder.h"
 
+#include <algorithm>
 #include <map>
 #include <unordered_map>
 
@@ -48,13 +49,25 @@ std::vector<DirectionUsageRule> DirectionUsageBuilder::operator()() {
   // visited, sort the Lanes first. This increases determinism w.r.t. ensuring that the same DirectionUsageRule ID is
   // applied to a particular Lane, as long as the set of Lanes within the RoadGeometry does not change. For more
   // information, see issue #211.
-  const std::map<maliput::api::LaneId, const maliput::api::Lane*> sorted_lanes(lanes.begin(), lanes.end());
-  std::vector<DirectionUsageRule> direction_usage_rules;
-  for (const auto lane_id_lane : sorted_lanes) {
-    direction_usage_rules.push_back(BuildDirectionUsageRuleFor(lane_id_lane.second));
-    maliput::log()->trace("Built DirectionUsageRule ", direction_usage_rules.back().id().string(), " for Lane ",
-                          lane_id_lane.first.string(), ".");
+  const std::map<maliput::api::LaneId, const maliput::api::Lane*> sorted_map_lanes(lanes.begin(), lanes.end());
+  std::vector<const maliput::api::Lane*> sorted_lanes;
+  for (const auto& lane_id_lane : sorted_map_lanes) {
+    sorted_lanes.push_back(lane_id_lane.second);
   }
+  // Rule indices start at one and follow the sorted Lanes. Each task builds the rules of a chunk of them.
+  const int num_lanes = static_cast<int>(sorted_lanes.size());
+  const int num_tasks = std::min(static_cast<int>(num_threads_), num_lanes);
+  const auto build_rules_for_chunk = [this, &sorted_lanes, num_lanes, num_tasks](int task_index) {
+    std::vector<DirectionUsageRule> chunk_rules;
+    for (int i = num_lanes * task_index / num_tasks; i < num_lanes * (task_index + 1) / num_tasks; ++i) {
+      chunk_rules.push_back(BuildDirectionUsageRuleFor(sorted_lanes[i], i + 1));
+      maliput::log()->trace("Built DirectionUsageRule ", chunk_rules.back().id().string(), " for Lane ",
+                            sorted_lanes[i]->id().string(), ".");
+    }
+    return chunk_rules;
+  };
+  std::vector<DirectionUsageRule> direction_usage_rules =
+      ConcatenateTaskResults<DirectionUsageRule>(num_tasks, num_threads_, build_rules_for_chunk);
 
   maliput::log()->trace("All DirectionUsageRules are built.");
   return direction_usage_rules;
@@ -73,19 +86,19 @@ DirectionUsageRule::State::Type DirectionUsageBuilder::ParseStateType(const std:
 }
 
 DirectionUsageRule::State DirectionUsageBuilder::BuildDirectionUsageRuleStateFor(const DirectionUsageRule::Id& rule_id,
-                                                                                 const Lane* lane) {
+                                                                                 const Lane* lane) const {
   MALIDRIVE_THROW_UNLESS(lane != nullptr);
   const DirectionUsageRule::State::Id state_id = GetDirectionUsageRuleStateId(rule_id);
   const DirectionUsageRule::State::Type state_type = ParseStateType(GetDirectionUsageRuleStateType(lane));
   return DirectionUsageRule::State(state_id, state_type, DirectionUsageRule::State::Severity::kStrict);
 }
 
-DirectionUsageRule DirectionUsageBuilder::BuildDirectionUsageRuleFor(const maliput::api::Lane* lane) {
+DirectionUsageRule DirectionUsageBuilder::BuildDirectionUsageRuleFor(const maliput::api::Lane* lane, int index) const {
   const Lane* mali_lane = dynamic_cast<const Lane*>(lane);
   MALIDRIVE_THROW_UNLESS(mali_lane != nullptr);
 
-  const DirectionUsageRule::Id rule_id = GetDirectionUsageRuleId(mali_lane->id(), direction_usage_indexer_.new_id());
-  const maliput::api::LaneSRange lane_s_range(mali_lane->id(), maliput::api::SRange(0., mali_lane->length()));
+  const DirectionUsageRule::Id rule_id = GetDirectionUsageRuleId(mali_lane->id(), index);
+  const maliput::api::LaneSRange lane_s_range(mali_lane->id(), maliput::api::SRange(0., mali_lane->EstimateLength()));
 
   return DirectionUsageRule(rule_id, lane_s_range, {BuildDirectionUsageRuleStateFor(rule_id, mali_lane)});
 }
@@ -29,6 +29,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -52,8 +53,14 @@ class DirectionUsageBuilder {
   /// Constructs a DirectionUsageBuilder.
   ///
   /// @param rg is the pointer to the maliput::api::RoadGeometry. It must not be nullptr.
-  DirectionUsageBuilder(const maliput::api::RoadGeometry* rg) : rg_(rg), direction_usage_indexer_(/* base ID*/ 0) {
+  /// @param num_threads is the number of threads to build the rules with. It
+  ///        must be positive.
+  /// @throws maliput::common::assertion_error When `rg` is nullptr or
+  ///         `num_threads` is zero.
+  DirectionUsageBuilder(const maliput::api::RoadGeometry* rg, std::size_t num_threads = 1)
+      : rg_(rg), num_threads_(num_threads) {
     MALIDRIVE_THROW_UNLESS(rg_ != nullptr);
+    MALIDRIVE_THROW_UNLESS(num_threads_ > 0);
   }
 
 #pragma GCC diagnostic push
@@ -61,6 +68,9 @@ class DirectionUsageBuilder {
   /// Builds a vector of maliput::api::rules::DirectionUsageRule.
   ///
   /// Traverses all the lanes within rg and builds a rule for each Lane.
+  ///
+  /// Lanes are sorted by ID and split in contiguous chunks that are built by
+  /// independent tasks, so rule IDs do not depend on the number of threads.
   std::vector<maliput::api::rules::DirectionUsageRule> operator()();
 #pragma GCC diagnostic pop
 
@@ -93,17 +103,18 @@ class DirectionUsageBuilder {
   /// @param lane is Lane pointer.  It must not be nullptr and its type
   ///        must be `malidrive::Lane`.
   maliput::api::rules::DirectionUsageRule::State BuildDirectionUsageRuleStateFor(
-      const maliput::api::rules::DirectionUsageRule::Id& rule_id, const Lane* lane);
+      const maliput::api::rules::DirectionUsageRule::Id& rule_id, const Lane* lane) const;
 
   /// Builds a maliput::api::rules::DirectionUsageRule for `lane`.
   ///
   /// @param lane is the Lane to inspect. It must not be nullptr and its type
   ///        must be `malidrive::Lane`.
-  maliput::api::rules::DirectionUsageRule BuildDirectionUsageRuleFor(const maliput::api::Lane* lane);
+  /// @param index is the index of the rule, used to build its ID.
+  maliput::api::rules::DirectionUsageRule BuildDirectionUsageRuleFor(const maliput::api::Lane* lane, int index) const;
 #pragma GCC diagnostic pop
 
   const maliput::api::RoadGeometry* rg_{};
-  UniqueIntegerProvider direction_usage_indexer_;
+  const std::size_t num_threads_{1};
 };
 
 }  // namespace builder
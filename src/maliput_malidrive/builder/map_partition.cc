@@ -0,0 +1,290 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/builder/map_partition.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <string>
+#include <utility>
+
+#include <maliput/common/logger.h>
+
+#include "maliput_malidrive/builder/builder_tools.h"
+#include "maliput_malidrive/builder/road_selection.h"
+#include "maliput_malidrive/common/macros.h"
+
+namespace malidrive {
+namespace builder {
+namespace {
+
+// Fraction of the lane length of a bisection by which refinement may unbalance it to reduce the number of cut edges.
+constexpr double kBalanceTolerance{0.05};
+// Bounds the number of refinement passes over the units of a bisection.
+constexpr int kMaxRefinementPasses{8};
+
+// XODR Junctions and XODR Roads outside of XODR Junctions are the units of the partition.
+struct UnitGraph {
+  // XODR Roads of each unit.
+  std::vector<std::vector<xodr::RoadHeader::Id>> roads;
+  // Drivable lane length of each unit.
+  std::vector<double> weights;
+  // Neighbours of each unit and the number of RoadGraph edges to each of them.
+  std::vector<std::map<int, int>> edges;
+
+  int size() const { return static_cast<int>(roads.size()); }
+};
+
+// @returns The summed length of the drivable lanes of `road_header`.
+double GetDrivableLaneLength(const xodr::RoadHeader& road_header) {
+  double lane_length{0.};
+  for (int i = 0; i < static_cast<int>(road_header.lanes.lanes_section.size()); ++i) {
+    const xodr::LaneSection& lane_section = road_header.lanes.lanes_section[i];
+    const auto num_drivable_lanes =
+        std::count_if(lane_section.left_lanes.begin(), lane_section.left_lanes.end(), is_driveable_lane) +
+        std::count_if(lane_section.right_lanes.begin(), lane_section.right_lanes.end(), is_driveable_lane);
+    lane_length += static_cast<double>(num_drivable_lanes) * road_header.GetLaneSectionLength(i);
+  }
+  return lane_length;
+}
+
+UnitGraph BuildUnitGraph(const xodr::DBManager& manager, const RoadGraph& road_graph,
+                         std::map<xodr::RoadHeader::Id, int>* unit_of_road) {
+  UnitGraph unit_graph;
+  std::map<std::string, int> unit_of_junction;
+  for (const auto& road_header : manager.GetRoadHeaders()) {
+    int unit{};
+    if (road_header.second.junction == "-1") {
+      unit = unit_graph.size();
+    } else {
+      const auto it = unit_of_junction.emplace(road_header.second.junction, unit_graph.size()).first;
+      unit = it->second;
+    }
+    if (unit == unit_graph.size()) {
+      unit_graph.roads.emplace_back();
+      unit_graph.weights.push_back(0.);
+      unit_graph.edges.emplace_back();
+    }
+    unit_graph.roads[unit].push_back(road_header.first);
+    unit_graph.weights[unit] += GetDrivableLaneLength(road_header.second);
+    unit_of_road->emplace(road_header.first, unit);
+  }
+  for (const auto& road_neighbours : road_graph) {
+    const int unit = unit_of_road->at(road_neighbours.first);
+    for (const auto& neighbour : road_neighbours.second) {
+      const int neighbour_unit = unit_of_road->at(neighbour);
+      if (neighbour_unit != unit) {
+        ++unit_graph.edges[unit][neighbour_unit];
+      }
+    }
+  }
+  return unit_graph;
+}
+
+// @returns The units in the connected component of `start` within `in_set`, in breadth-first order.
+std::vector<int> BreadthFirstOrder(const UnitGraph& unit_graph, const std::vector<bool>& in_set, int start) {
+  std::vector<int> order{start};
+  std::vector<bool> visited(unit_graph.size(), false);
+  visited[start] = true;
+  for (std::size_t next = 0; next < order.size(); ++next) {
+    for (const auto& neighbour : unit_graph.edges[order[next]]) {
+      if (in_set[neighbour.first] && !visited[neighbour.first]) {
+        visited[neighbour.first] = true;
+        order.push_back(neighbour.first);
+      }
+    }
+  }
+  return order;
+}
+
+// Splits `units` in two sides. The first one receives `num_left_regions` out of `num_regions` shares of the lane
+// length and must hold at least `num_left_regions` units; the second one at least `num_regions - num_left_regions`.
+std::pair<std::vector<int>, std::vector<int>> Bisect(const UnitGraph& unit_graph, const std::vector<int>& units,
+                                                     int num_left_regions, int num_regions) {
+  std::vector<bool> in_set(unit_graph.size(), false);
+  double total_weight{0.};
+  for (const int unit : units) {
+    in_set[unit] = true;
+    total_weight += unit_graph.weights[unit];
+  }
+
+  // Grows the first side in breadth-first order. Each connected component is traversed from a peripheral unit, the
+  // last one reached from its lowest unit, so the grown side stays compact.
+  std::vector<int> order;
+  std::vector<bool> ordered(unit_graph.size(), false);
+  for (const int unit : units) {
+    if (ordered[unit]) {
+      continue;
+    }
+    const int start = BreadthFirstOrder(unit_graph, in_set, unit).back();
+    for (const int component_unit : BreadthFirstOrder(unit_graph, in_set, start)) {
+      ordered[component_unit] = true;
+      order.push_back(component_unit);
+    }
+  }
+
+  const double target_weight = total_weight * num_left_regions / num_regions;
+  const std::array<int, 2> min_count{num_left_regions, num_regions - num_left_regions};
+  std::vector<int> side(unit_graph.size(), 1);
+  std::array<int, 2> count{0, static_cast<int>(units.size())};
+  double left_weight{0.};
+  for (const int unit : order) {
+    const double weight = unit_graph.weights[unit];
+    const bool must_take = count[0] < min_count[0];
+    const bool may_take = count[1] > min_count[1];
+    if (!must_take && (!may_take || std::abs(left_weight + weight - target_weight) >=
+                                        std::abs(left_weight - target_weight))) {
+      break;
+    }
+    side[unit] = 0;
+    ++count[0];
+    --count[1];
+    left_weight += weight;
+  }
+
+  // Moves boundary units to the other side while it reduces the number of cut edges without unbalancing the
+  // bisection, or keeps it and improves the balance.
+  const double tolerance = kBalanceTolerance * total_weight;
+  bool moved{true};
+  for (int pass = 0; moved && pass < kMaxRefinementPasses; ++pass) {
+    moved = false;
+    for (const int unit : units) {
+      const int from = side[unit];
+      if (count[from] <= min_count[from]) {
+        continue;
+      }
+      int internal_edges{0};
+      int external_edges{0};
+      for (const auto& neighbour : unit_graph.edges[unit]) {
+        if (in_set[neighbour.first]) {
+          (side[neighbour.first] == from ? internal_edges : external_edges) += neighbour.second;
+        }
+      }
+      if (external_edges == 0) {
+        continue;
+      }
+      const int gain = external_edges - internal_edges;
+      const double new_left_weight =
+          left_weight + (from == 0 ? -unit_graph.weights[unit] : unit_graph.weights[unit]);
+      const double imbalance = std::abs(left_weight - target_weight);
+      const double new_imbalance = std::abs(new_left_weight - target_weight);
+      if ((gain > 0 && new_imbalance <= std::max(imbalance, tolerance)) || (gain == 0 && new_imbalance < imbalance)) {
+        side[unit] = 1 - from;
+        --count[from];
+        ++count[1 - from];
+        left_weight = new_left_weight;
+        moved = true;
+      }
+    }
+  }
+
+  std::pair<std::vector<int>, std::vector<int>> sides;
+  for (const int unit : units) {
+    (side[unit] == 0 ? sides.first : sides.second).push_back(unit);
+  }
+  return sides;
+}
+
+// Recursively bisects `units` into `num_regions` regions, appended to `regions`.
+void Partition(const UnitGraph& unit_graph, const std::vector<int>& units, int num_regions,
+               std::vector<std::vector<int>>* regions) {
+  if (num_regions == 1) {
+    regions->push_back(units);
+    return;
+  }
+  const int num_left_regions = num_regions / 2;
+  const auto sides = Bisect(unit_graph, units, num_left_regions, num_regions);
+  Partition(unit_graph, sides.first, num_left_regions, regions);
+  Partition(unit_graph, sides.second, num_regions - num_left_regions, regions);
+}
+
+}  // namespace
+
+MapPartition PartitionMap(const xodr::DBManager& manager, int num_regions) {
+  const RoadGraph road_graph = BuildRoadGraph(manager);
+  std::map<xodr::RoadHeader::Id, int> unit_of_road;
+  const UnitGraph unit_graph = BuildUnitGraph(manager, road_graph, &unit_of_road);
+  MALIDRIVE_VALIDATE(num_regions > 0 && num_regions <= unit_graph.size(), maliput::common::assertion_error,
+                     "Number of regions must be in [1, " + std::to_string(unit_graph.size()) +
+                         "]: " + std::to_string(num_regions));
+
+  std::vector<int> units(unit_graph.size());
+  for (int i = 0; i < unit_graph.size(); ++i) {
+    units[i] = i;
+  }
+  std::vector<std::vector<int>> region_units;
+  Partition(unit_graph, units, num_regions, &region_units);
+
+  MapPartition partition;
+  partition.regions.resize(num_regions);
+  std::vector<int> region_of_unit(unit_graph.size());
+  for (int i = 0; i < num_regions; ++i) {
+    for (const int unit : region_units[i]) {
+      region_of_unit[unit] = i;
+      partition.regions[i].road_ids.insert(unit_graph.roads[unit].begin(), unit_graph.roads[unit].end());
+      partition.regions[i].lane_length += unit_graph.weights[unit];
+    }
+  }
+  for (const auto& road_neighbours : road_graph) {
+    const int unit = unit_of_road.at(road_neighbours.first);
+    MapRegion& region = partition.regions[region_of_unit[unit]];
+    for (const auto& neighbour : road_neighbours.second) {
+      const int neighbour_unit = unit_of_road.at(neighbour);
+      if (region_of_unit[neighbour_unit] == region_of_unit[unit]) {
+        continue;
+      }
+      region.halo_road_ids.insert(unit_graph.roads[neighbour_unit].begin(), unit_graph.roads[neighbour_unit].end());
+      // Each edge is visited from both of its XODR Roads.
+      if (road_neighbours.first < neighbour) {
+        ++partition.num_cut_edges;
+      }
+    }
+  }
+  maliput::log()->trace("Partitioned ", road_graph.size(), " XODR Roads into ", num_regions, " regions with ",
+                        partition.num_cut_edges, " cut edges.");
+  return partition;
+}
+
+BuildRegion ToBuildRegion(const MapRegion& region, bool include_halo) {
+  BuildRegion build_region;
+  for (const auto& road_id : region.road_ids) {
+    build_region.road_ids.push_back(road_id.string());
+  }
+  if (include_halo) {
+    for (const auto& road_id : region.halo_road_ids) {
+      build_region.road_ids.push_back(road_id.string());
+    }
+  }
+  return build_region;
+}
+
+}  // namespace builder
+}  // namespace malidrive
@@ -0,0 +1,89 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <set>
+#include <vector>
+
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/xodr/db_manager.h"
+#include "maliput_malidrive/xodr/road_header.h"
+
+namespace malidrive {
+namespace builder {
+
+/// A region of a MapPartition.
+struct MapRegion {
+  /// XODR Roads of the region. Every XODR Road of the map belongs to exactly
+  /// one region, and all the XODR Roads of a XODR Junction belong to the same
+  /// region.
+  std::set<xodr::RoadHeader::Id> road_ids{};
+  /// XODR Roads of other regions that are linked to `road_ids`. When a halo
+  /// XODR Road belongs to a XODR Junction, all the XODR Roads of that XODR
+  /// Junction are in the halo.
+  std::set<xodr::RoadHeader::Id> halo_road_ids{};
+  /// Total length of the drivable lanes of `road_ids`, in the XODR frame.
+  double lane_length{};
+};
+
+/// Splits a XODR map into regions of balanced lane length.
+struct MapPartition {
+  std::vector<MapRegion> regions{};
+  /// Number of RoadGraph edges whose XODR Roads belong to different regions.
+  int num_cut_edges{};
+};
+
+/// Partitions the XODR Roads of `manager` into `num_regions` regions.
+///
+/// XODR Junctions are not split: each of them is partitioned as a single
+/// unit, as well as each XODR Road outside of a XODR Junction. Units are
+/// weighted by the length of their drivable lanes and linked as in the
+/// RoadGraph. The partition is computed by recursive bisection: each
+/// bisection grows a region in breadth-first order from a peripheral unit
+/// until it holds its share of the lane length, and then moves boundary units
+/// to the other side while that reduces the number of cut edges without
+/// unbalancing the bisection. The result is deterministic.
+///
+/// @param manager Holds the XODR description.
+/// @param num_regions Number of regions. It must be positive and not greater
+///        than the number of units.
+/// @returns The MapPartition.
+/// @throws maliput::common::assertion_error When `num_regions` is out of range.
+MapPartition PartitionMap(const xodr::DBManager& manager, int num_regions);
+
+/// Creates a BuildRegion that loads `region` on its own.
+///
+/// @param region A MapRegion.
+/// @param include_halo When true, `region.halo_road_ids` are loaded too.
+/// @returns The BuildRegion, with no bounding box and no topological radius.
+BuildRegion ToBuildRegion(const MapRegion& region, bool include_halo);
+
+}  // namespace builder
+}  // namespace malidrive
@@ -0,0 +1,208 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/builder/progressive_road_geometry.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include <maliput/common/logger.h>
+
+#include "maliput_malidrive/builder/road_geometry_builder.h"
+#include "maliput_malidrive/builder/road_selection.h"
+#include "maliput_malidrive/builder/xodr_parser_configuration.h"
+
+namespace malidrive {
+namespace builder {
+
+std::pair<std::vector<xodr::RoadHeader::Id>, int> GetRoadsInPriorityOrder(
+    const xodr::DBManager& manager, const ProgressiveBuildSeed& seed,
+    const maliput::math::Vector3& inertial_to_backend_frame_translation) {
+  const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers = manager.GetRoadHeaders();
+  const RoadGraph road_graph = BuildRoadGraph(manager);
+
+  std::vector<xodr::RoadHeader::Id> road_ids;
+  road_ids.reserve(road_headers.size());
+  std::set<xodr::RoadHeader::Id> visited;
+  const auto visit = [&road_ids, &visited](const xodr::RoadHeader::Id& road_id) {
+    if (visited.insert(road_id).second) {
+      road_ids.push_back(road_id);
+    }
+  };
+
+  for (const auto& road_id : seed.road_ids) {
+    if (road_headers.find(road_id) != road_headers.end()) {
+      visit(road_id);
+    } else {
+      maliput::log()->warn("Seed XODR Road ID: ", road_id.string(), " is not in the XODR description.");
+    }
+  }
+  if (seed.region.has_value()) {
+    for (const auto& road_header : road_headers) {
+      if (IsRoadInRegion(road_header.second, seed.region->min_corner, seed.region->max_corner,
+                         inertial_to_backend_frame_translation)) {
+        visit(road_header.first);
+      }
+    }
+  }
+  const int num_seed_roads = static_cast<int>(road_ids.size());
+
+  // Breadth-first traversal. `road_ids` works as the queue: roads in [next, end) are yet to be expanded.
+  std::size_t next{0};
+  auto unvisited_it = road_headers.begin();
+  while (road_ids.size() < road_headers.size()) {
+    if (next == road_ids.size()) {
+      // Starts a new traversal from the first XODR Road that is not reachable from the previous ones.
+      while (visited.find(unvisited_it->first) != visited.end()) {
+        ++unvisited_it;
+      }
+      visit(unvisited_it->first);
+    }
+    for (const auto& neighbour : road_graph.at(road_ids[next])) {
+      visit(neighbour);
+    }
+    ++next;
+  }
+  return {road_ids, num_seed_roads};
+}
+
+ProgressiveRoadGeometry::ProgressiveRoadGeometry(const RoadGeometryConfiguration& road_geometry_configuration,
+                                                 const ProgressiveBuildSeed& seed, const BuildControl& build_control)
+    : stop_token_(std::make_shared<CancellationToken>(build_control.cancellation_token)) {
+  build_result_ = std::async(std::launch::async, [this, road_geometry_configuration, seed, build_control]() {
+                    Build(road_geometry_configuration, seed, build_control);
+                  }).share();
+}
+
+ProgressiveRoadGeometry::~ProgressiveRoadGeometry() {
+  stop_token_->Cancel();
+  build_result_.wait();
+}
+
+void ProgressiveRoadGeometry::Build(const RoadGeometryConfiguration& road_geometry_configuration,
+                                    const ProgressiveBuildSeed& seed, const BuildControl& build_control) {
+  const xodr::ParserConfiguration parser_config =
+      XodrParserConfigurationFromRoadGeometryConfiguration(road_geometry_configuration);
+  std::unique_ptr<xodr::DBManager> manager =
+      xodr::LoadDataBaseFromFile(road_geometry_configuration.opendrive_file, parser_config);
+  const auto [road_ids, num_seed_roads] =
+      GetRoadsInPriorityOrder(*manager, seed, road_geometry_configuration.inertial_to_backend_frame_translation);
+  const int num_roads = static_cast<int>(road_ids.size());
+  // Progress is reported per stage, so the builder of each stage only checks for cancellation. `stop_token_` follows
+  // the caller's token, so a stage stops when either of them is cancelled.
+  const BuildControl stage_build_control{{}, stop_token_};
+
+  int num_stage_roads = num_seed_roads > 0 ? num_seed_roads : num_roads;
+  build_control.ReportProgress(BuildPhase::kRoadGeometry, 0, num_roads);
+  while (true) {
+    build_control.ThrowIfCancelled();
+    if (manager == nullptr) {
+      manager = xodr::LoadDataBaseFromFile(road_geometry_configuration.opendrive_file, parser_config);
+    }
+    const bool done = num_stage_roads == num_roads;
+    std::set<xodr::RoadHeader::Id> stage_road_ids(road_ids.begin(), road_ids.begin() + num_stage_roads);
+    maliput::log()->trace("Building progressive stage with ", num_stage_roads, " of ", num_roads, " XODR Roads...");
+    std::shared_ptr<const maliput::api::RoadGeometry> road_geometry;
+    try {
+      road_geometry = RoadGeometryBuilder(std::move(manager), road_geometry_configuration, stage_build_control,
+                                          done ? std::nullopt : std::make_optional(stage_road_ids))();
+    } catch (const BuildCancelledError&) {
+      // Only the caller's cancellation is an error; the destructor's one is a normal stop.
+      build_control.ThrowIfCancelled();
+      return;
+    }
+    Publish(std::move(road_geometry), std::move(stage_road_ids), done);
+    build_control.ReportProgress(BuildPhase::kRoadGeometry, num_stage_roads, num_roads);
+    if (done) {
+      break;
+    }
+    if (stop_token_->IsCancelled()) {
+      build_control.ThrowIfCancelled();
+      return;
+    }
+    num_stage_roads = std::min(2 * num_stage_roads, num_roads);
+  }
+  build_control.ReportProgress(BuildPhase::kDone, 1, 1);
+}
+
+void ProgressiveRoadGeometry::Publish(std::shared_ptr<const maliput::api::RoadGeometry> road_geometry,
+                                      std::set<xodr::RoadHeader::Id> road_ids, bool done) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  road_geometry_ = std::move(road_geometry);
+  built_road_ids_ = std::move(road_ids);
+  done_ = done;
+}
+
+std::shared_ptr<const maliput::api::RoadGeometry> ProgressiveRoadGeometry::road_geometry() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return road_geometry_;
+}
+
+bool ProgressiveRoadGeometry::IsRoadAvailable(const xodr::RoadHeader::Id& road_id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return built_road_ids_.find(road_id) != built_road_ids_.end();
+}
+
+bool ProgressiveRoadGeometry::IsLaneAvailable(const maliput::api::LaneId& lane_id) const {
+  const std::shared_ptr<const maliput::api::RoadGeometry> road_geometry = this->road_geometry();
+  return road_geometry != nullptr && road_geometry->ById().GetLane(lane_id) != nullptr;
+}
+
+bool ProgressiveRoadGeometry::IsDone() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return done_;
+}
+
+std::optional<maliput::api::RoadPositionResult> ProgressiveRoadGeometry::ToRoadPosition(
+    const maliput::api::InertialPosition& inertial_position) const {
+  std::shared_ptr<const maliput::api::RoadGeometry> road_geometry;
+  bool done{false};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    road_geometry = road_geometry_;
+    done = done_;
+  }
+  if (road_geometry == nullptr) {
+    return std::nullopt;
+  }
+  const maliput::api::RoadPositionResult result = road_geometry->ToRoadPosition(inertial_position);
+  if (!done && result.distance > road_geometry->linear_tolerance()) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+std::shared_ptr<const maliput::api::RoadGeometry> ProgressiveRoadGeometry::WaitUntilDone() const {
+  build_result_.get();
+  return road_geometry();
+}
+
+}  // namespace builder
+}  // namespace malidrive
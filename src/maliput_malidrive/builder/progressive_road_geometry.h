@@ -0,0 +1,169 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_malidrive/builder/build_control.h"
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/common/macros.h"
+#include "maliput_malidrive/xodr/db_manager.h"
+#include "maliput_malidrive/xodr/road_header.h"
+
+namespace malidrive {
+namespace builder {
+
+/// Area of the map that is built first by a ProgressiveRoadGeometry.
+struct ProgressiveBuildSeed {
+  /// Axis aligned box in the Inertial Frame.
+  struct Region {
+    maliput::math::Vector2 min_corner{};
+    maliput::math::Vector2 max_corner{};
+  };
+
+  /// XODR Roads to build first.
+  std::vector<xodr::RoadHeader::Id> road_ids{};
+  /// When set, the XODR Roads with any plan view geometry overlapping the
+  /// region are also built first. See IsRoadInRegion().
+  std::optional<Region> region{};
+};
+
+/// Sorts the XODR Roads of `manager` in build priority order.
+///
+/// The XODR Roads selected by `seed` come first, followed by the rest in
+/// breadth-first order over the road links: XODR Roads linked through a
+/// predecessor / successor are neighbours, as well as a XODR Road linked to
+/// a XODR Junction and the connecting XODR Roads of that XODR Junction.
+/// XODR Roads which aren't reachable from the seed are appended at the end,
+/// also in breadth-first order.
+///
+/// @param manager Holds the XODR description.
+/// @param seed Area of the map to start from. Unknown XODR Road IDs are ignored.
+/// @param inertial_to_backend_frame_translation Translation from the Inertial
+///        Frame to the XODR frame, used to evaluate `seed.region`.
+/// @returns The IDs of all the XODR Roads of `manager` and the number of them
+///          selected by `seed`.
+std::pair<std::vector<xodr::RoadHeader::Id>, int> GetRoadsInPriorityOrder(
+    const xodr::DBManager& manager, const ProgressiveBuildSeed& seed,
+    const maliput::math::Vector3& inertial_to_backend_frame_translation);
+
+/// Builds a RoadGeometry in the background, region by region, so the area
+/// of interest can be queried before the whole map is built.
+///
+/// XODR Roads are built in the order given by GetRoadsInPriorityOrder(). The
+/// build runs in stages: the first stage builds the XODR Roads selected by
+/// the seed and each following stage doubles the number of built XODR Roads
+/// until the map is complete. After each stage a new RoadGeometry snapshot
+/// replaces the previous one. Because a RoadGeometry owns its XODR database,
+/// each stage parses the XODR file again; the doubling keeps the overall
+/// cost within a small factor of a single build. When the seed selects no
+/// XODR Road, the whole map is built in a single stage.
+///
+/// Snapshots are immutable: a snapshot obtained through road_geometry() can be
+/// queried while the following stages are built. Lanes that connect to XODR
+/// Roads which are not built yet are left unconnected at that end.
+class ProgressiveRoadGeometry {
+ public:
+  MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(ProgressiveRoadGeometry);
+
+  /// Starts the build in a background thread.
+  ///
+  /// @param road_geometry_configuration Configuration of the RoadGeometry.
+  /// @param seed Area of the map to build first.
+  /// @param build_control Its CancellationToken is checked while building;
+  ///        BuildPhase::kRoadGeometry progress is reported after each stage,
+  ///        counted in built XODR Roads, and BuildPhase::kDone at the end.
+  ProgressiveRoadGeometry(const RoadGeometryConfiguration& road_geometry_configuration,
+                          const ProgressiveBuildSeed& seed, const BuildControl& build_control = {});
+
+  /// Cancels the ongoing stage and waits for the background thread to stop.
+  ~ProgressiveRoadGeometry();
+
+  /// @returns The latest RoadGeometry snapshot, or nullptr when the first stage
+  ///          is not done yet.
+  std::shared_ptr<const maliput::api::RoadGeometry> road_geometry() const;
+
+  /// @returns True when `road_id` is built in the latest snapshot.
+  bool IsRoadAvailable(const xodr::RoadHeader::Id& road_id) const;
+
+  /// @returns True when `lane_id` is built in the latest snapshot.
+  bool IsLaneAvailable(const maliput::api::LaneId& lane_id) const;
+
+  /// @returns True when the whole map is built.
+  bool IsDone() const;
+
+  /// Maps `inertial_position` into the latest snapshot.
+  ///
+  /// @param inertial_position A position in the Inertial Frame.
+  /// @returns The result of the query in the latest snapshot, or std::nullopt
+  ///          when it is not yet available: no snapshot is built yet, or the
+  ///          position falls outside the built XODR Roads while the build is
+  ///          still in progress.
+  std::optional<maliput::api::RoadPositionResult> ToRoadPosition(
+      const maliput::api::InertialPosition& inertial_position) const;
+
+  /// Waits for the whole map to be built.
+  ///
+  /// @returns The complete RoadGeometry.
+  /// @throws BuildCancelledError When the build is cancelled.
+  /// @throws maliput::common::assertion_error When the build fails.
+  std::shared_ptr<const maliput::api::RoadGeometry> WaitUntilDone() const;
+
+ private:
+  // Builds all the stages and publishes a snapshot after each of them.
+  void Build(const RoadGeometryConfiguration& road_geometry_configuration, const ProgressiveBuildSeed& seed,
+             const BuildControl& build_control);
+
+  // Replaces the latest snapshot.
+  void Publish(std::shared_ptr<const maliput::api::RoadGeometry> road_geometry,
+               std::set<xodr::RoadHeader::Id> road_ids, bool done);
+
+  mutable std::mutex mutex_;
+  std::shared_ptr<const maliput::api::RoadGeometry> road_geometry_;
+  std::set<xodr::RoadHeader::Id> built_road_ids_;
+  bool done_{false};
+  // Checked by the stages together with the caller's CancellationToken, which it follows. The destructor cancels it
+  // to stop the build without waiting for the ongoing stage.
+  const std::shared_ptr<CancellationToken> stop_token_;
+  std::shared_future<void> build_result_;
+};
+
+}  // namespace builder
+}  // namespace malidrive
@@ -29,10 +29,11 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/builder/road_geometry_builder.h"
 
+#include <algorithm>
 #include <array>
 #include <future>
 #include <iterator>
-#include <thread>
+#include <mutex>
 
 #include <maliput/common/logger.h>
 #include <maliput/common/maliput_unused.h>
@@ -40,13 +41,19 @@
 #include <maliput/geometry_base/junction.h>
 #include <maliput/utility/thread_pool.h>
 
+#include "maliput_malidrive/base/lane_graph.h"
+#include "maliput_malidrive/base/lane_string_index.h"
+#include "maliput_malidrive/base/xodr_lane_index.h"
+#include "maliput_malidrive/builder/conflict_zones.h"
 #include "maliput_malidrive/builder/determine_tolerance.h"
 #include "maliput_malidrive/builder/road_curve_factory.h"
+#include "maliput_malidrive/builder/road_selection.h"
 #include "maliput_malidrive/builder/simplify_geometries.h"
 #include "maliput_malidrive/builder/xodr_parser_configuration.h"
 #include "maliput_malidrive/common/macros.h"
 #include "maliput_malidrive/road_curve/cubic_polynomial.h"
 #include "maliput_malidrive/road_curve/function.h"
+#include "maliput_malidrive/road_curve/joint_road_curve_offset.h"
 #include "maliput_malidrive/road_curve/lane_offset.h"
 #include "maliput_malidrive/road_curve/piecewise_function.h"
 #include "maliput_malidrive/road_curve/scaled_domain_function.h"
@@ -75,21 +82,57 @@ std::vector<xodr::DBManager::XodrGeometriesToSimplify> FilterGeometriesToSimplif
   return result;
 }
 
-// When `build_policy.num_threads.has_value()` it returns its value,
-// otherwise what the hardware supports minus one (running thread).
-//
-// `build_policy` Is the build policy for the RoadGeometryBuilder.
-std::size_t GetEffectiveNumberOfThreads(const malidrive::builder::BuildPolicy& build_policy) {
-  return build_policy.num_threads.has_value() ? static_cast<std::size_t>(build_policy.num_threads.value())
-                                              : std::thread::hardware_concurrency() - 1;
-  ;
+// Integrates the arc lengths of all the Lanes of a Segment together on the first request from any of them. It is
+// shared by the Lanes of the Segment when they are built lazily.
+class LazyJointRoadCurveOffset {
+ public:
+  MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(LazyJointRoadCurveOffset);
+
+  // See road_curve::JointRoadCurveOffset's constructor. `lane_offsets` must outlive this object.
+  LazyJointRoadCurveOffset(const road_curve::RoadCurve* road_curve,
+                           std::vector<const road_curve::Function*> lane_offsets, double p0, double p1)
+      : road_curve_(road_curve), lane_offsets_(std::move(lane_offsets)), p0_(p0), p1_(p1) {}
+
+  // @returns The arc length mappings of the `index`-th Lane. The first call integrates all the Lanes. It is
+  //          thread-safe.
+  Lane::ArcLengthFunctions Get(int index) {
+    std::call_once(joint_road_curve_offset_flag_, [this]() {
+      joint_road_curve_offset_ = std::make_unique<road_curve::JointRoadCurveOffset>(road_curve_, lane_offsets_, p0_,
+                                                                                    p1_, 1 /* num_threads */);
+    });
+    return {joint_road_curve_offset_->SFromP(index), joint_road_curve_offset_->PFromS(index),
+            joint_road_curve_offset_->PFromSBatch(index)};
+  }
+
+ private:
+  const road_curve::RoadCurve* road_curve_{};
+  const std::vector<const road_curve::Function*> lane_offsets_;
+  const double p0_{};
+  const double p1_{};
+  std::once_flag joint_road_curve_offset_flag_;
+  std::unique_ptr<road_curve::JointRoadCurveOffset> joint_road_curve_offset_;
+};
+
+// Returns the arc length mappings of the Lane `lane_id` of `road_geometry` when they can be reused by a new Lane with
+// the same geometry, otherwise std::nullopt. See Lane::GetArcLengthFunctions().
+std::optional<Lane::ArcLengthFunctions> FindReusableArcLengthFunctions(const RoadGeometry& road_geometry,
+                                                                       const maliput::api::LaneId& lane_id) {
+  const auto* lane = dynamic_cast<const Lane*>(road_geometry.ById().GetLane(lane_id));
+  return lane != nullptr ? lane->GetArcLengthFunctions() : std::nullopt;
 }
 
 }  // namespace
 
 RoadGeometryBuilder::RoadGeometryBuilder(std::unique_ptr<xodr::DBManager> manager,
-                                         const RoadGeometryConfiguration& road_geometry_configuration)
-    : rg_config_(road_geometry_configuration), manager_(std::move(manager)) {
+                                         const RoadGeometryConfiguration& road_geometry_configuration,
+                                         const BuildControl& build_control,
+                                         const std::optional<std::set<xodr::RoadHeader::Id>>& road_ids,
+                                         const RoadGeometry* previous_road_geometry)
+    : rg_config_(road_geometry_configuration),
+      build_control_(build_control),
+      road_ids_(road_ids),
+      manager_(std::move(manager)),
+      previous_road_geometry_(previous_road_geometry) {
   MALIDRIVE_THROW_UNLESS(manager_.get());
   MALIDRIVE_THROW_UNLESS(rg_config_.scale_length >= 0.);
   MALIDRIVE_VALIDATE(rg_config_.tolerances.angular_tolerance >= 0, maliput::common::assertion_error,
@@ -154,6 +197,25 @@ RoadGeometryBuilder::RoadGeometryBuilder(std::unique_ptr<xodr::DBManager> manage
           ? "SimplifyWithinToleranceAndKeepGeometryModel"
           : "None");
 
+  if (rg_config_.build_region.has_value()) {
+    std::set<xodr::RoadHeader::Id> region_road_ids = GetRoadsInBuildRegion(
+        *manager_, rg_config_.build_region.value(), rg_config_.inertial_to_backend_frame_translation);
+    if (road_ids_.has_value()) {
+      std::set<xodr::RoadHeader::Id> intersection;
+      std::set_intersection(road_ids_->begin(), road_ids_->end(), region_road_ids.begin(), region_road_ids.end(),
+                            std::inserter(intersection, intersection.begin()));
+      region_road_ids = std::move(intersection);
+    }
+    maliput::log()->trace("Build region: ", region_road_ids.size(), " XODR Roads to build.");
+    road_ids_ = std::move(region_road_ids);
+  }
+
+  if (previous_road_geometry_ != nullptr) {
+    MALIDRIVE_THROW_UNLESS(previous_road_geometry_->get_manager() != nullptr);
+    unchanged_road_ids_ = DiffRoads(*previous_road_geometry_->get_manager(), *manager_).unchanged;
+    maliput::log()->trace("Previous RoadGeometry: ", unchanged_road_ids_.size(), " unchanged XODR Roads to reuse.");
+  }
+
   factory_ = std::make_unique<builder::RoadCurveFactory>(
       rg_config_.tolerances.linear_tolerance.value(), rg_config_.scale_length, rg_config_.tolerances.angular_tolerance);
 }
@@ -239,7 +301,7 @@ void RoadGeometryBuilder::VerifyNonNegativeLaneWidth(const std::vector<xodr::Lan
   }
 }
 
-RoadGeometryBuilder::LaneConstructionResult RoadGeometryBuilder::BuildLane(
+RoadGeometryBuilder::LaneDescription RoadGeometryBuilder::BuildLaneDescription(
     const xodr::Lane* lane, const xodr::RoadHeader* road_header, const xodr::LaneSection* lane_section,
     int xodr_lane_section_index, const RoadCurveFactoryBase* factory, const RoadGeometryConfiguration& rg_config,
     Segment* segment, road_curve::LaneOffset::AdjacentLaneFunctions* adjacent_lane_functions) {
@@ -256,10 +318,6 @@ RoadGeometryBuilder::LaneConstructionResult RoadGeometryBuilder::BuildLane(
   // Build a maliput::api::LaneId.
   const maliput::api::LaneId lane_id = GetLaneId(xodr_track_id, xodr_lane_section_index, xodr_lane_id);
 
-  // Build a maliput::api::HBounds.
-  // TODO(#69): Un-hardcode the elevation bound.
-  const maliput::api::HBounds elevation_bounds{0., 5.};
-
   //@{
 
   maliput::log()->trace("Creating LaneWidth for lane id ", lane_id.string());
@@ -301,11 +359,42 @@ RoadGeometryBuilder::LaneConstructionResult RoadGeometryBuilder::BuildLane(
   //@}
   adjacent_lane_functions->width = lane_width.get();
   adjacent_lane_functions->offset = lane_offset.get();
-  maliput::log()->trace("Building lane id ", lane_id.string());
-  auto built_lane =
-      std::make_unique<Lane>(lane_id, xodr_track_id, xodr_lane_id, elevation_bounds, segment->road_curve(),
-                             std::move(lane_width), std::move(lane_offset), road_curve_p_0_lane, road_curve_p_1_lane);
-  return {segment, std::move(built_lane), {road_header, lane_section, xodr_lane_section_index, lane}};
+  return {lane_id,
+          xodr_track_id,
+          xodr_lane_id,
+          std::move(lane_width),
+          std::move(lane_offset),
+          road_curve_p_0_lane,
+          road_curve_p_1_lane,
+          {road_header, lane_section, xodr_lane_section_index, lane}};
+}
+
+RoadGeometryBuilder::LaneConstructionResult RoadGeometryBuilder::BuildLane(
+    LaneDescription lane_description, Segment* segment, Lane::ArcLengthFunctions arc_length_functions) {
+  MALIDRIVE_THROW_UNLESS(segment != nullptr);
+  // Build a maliput::api::HBounds.
+  // TODO(#69): Un-hardcode the elevation bound.
+  const maliput::api::HBounds elevation_bounds{0., 5.};
+  maliput::log()->trace("Building lane id ", lane_description.lane_id.string());
+  auto built_lane = std::make_unique<Lane>(
+      lane_description.lane_id, lane_description.xodr_track_id, lane_description.xodr_lane_id, elevation_bounds,
+      segment->road_curve(), std::move(lane_description.lane_width), std::move(lane_description.lane_offset),
+      lane_description.p0, lane_description.p1, std::move(arc_length_functions));
+  return {segment, std::move(built_lane), lane_description.xodr_lane_properties};
+}
+
+RoadGeometryBuilder::LaneConstructionResult RoadGeometryBuilder::BuildLane(
+    LaneDescription lane_description, Segment* segment,
+    std::function<Lane::ArcLengthFunctions()> arc_length_functions_builder) {
+  MALIDRIVE_THROW_UNLESS(segment != nullptr);
+  // TODO(#69): Un-hardcode the elevation bound.
+  const maliput::api::HBounds elevation_bounds{0., 5.};
+  maliput::log()->trace("Building lazy lane id ", lane_description.lane_id.string());
+  auto built_lane = std::make_unique<Lane>(
+      lane_description.lane_id, lane_description.xodr_track_id, lane_description.xodr_lane_id, elevation_bounds,
+      segment->road_curve(), std::move(lane_description.lane_width), std::move(lane_description.lane_offset),
+      lane_description.p0, lane_description.p1, std::move(arc_length_functions_builder));
+  return {segment, std::move(built_lane), lane_description.xodr_lane_properties};
 }
 
 std::vector<RoadGeometryBuilder::LaneConstructionResult> RoadGeometryBuilder::LanesBuilderParallelPolicy(
@@ -314,11 +403,16 @@ std::vector<RoadGeometryBuilder::LaneConstructionResult> RoadGeometryBuilder::La
   MALIDRIVE_THROW_UNLESS(num_of_threads > 0);
   maliput::utility::ThreadPool task_executor(num_of_threads);
 
+  // The tasks already run concurrently, so the integration of each Segment only fans out over the threads that
+  // would otherwise be idle, e.g. when there are fewer Junctions than threads. It keeps the total number of
+  // threads bounded by `num_of_threads`.
+  const std::size_t num_integration_threads =
+      std::max<std::size_t>(1, num_of_threads / std::max<std::size_t>(1, junctions_segments_attributes_.size()));
   // Queue all the tasks in the thread pool. Each task will build all the lanes of a junction.
   std::vector<std::future<std::vector<RoadGeometryBuilder::LaneConstructionResult>>> lanes_construction_results;
   for (const auto& junction_segments_attributes : junctions_segments_attributes_) {
-    lanes_construction_results.push_back(
-        task_executor.Queue(LanesBuilder(junction_segments_attributes, factory_.get(), rg_config_, rg)));
+    lanes_construction_results.push_back(task_executor.Queue(LanesBuilder(
+        junction_segments_attributes, factory_.get(), rg_config_, rg, build_control_, num_integration_threads)));
   }
   // The threads are on hold until start method is called.
   task_executor.Start();
@@ -339,10 +433,12 @@ std::vector<RoadGeometryBuilder::LaneConstructionResult> RoadGeometryBuilder::La
   std::vector<LaneConstructionResult> built_lanes_result;
   for (const auto& junction_segments_attributes : junctions_segments_attributes_) {
     for (const auto& segment_attributes : junction_segments_attributes.second) {
+      build_control_.ThrowIfCancelled();
       // Process lanes of the lane section.
       auto lanes_result = BuildLanesForSegment(
           segment_attributes.second.road_header, segment_attributes.second.lane_section,
-          segment_attributes.second.lane_section_index, factory_.get(), rg_config_, rg, segment_attributes.first);
+          segment_attributes.second.lane_section_index, factory_.get(), rg_config_, rg, segment_attributes.first,
+          segment_attributes.second.previous_road_geometry, GetEffectiveNumberOfThreads(rg_config_.build_policy));
       built_lanes_result.insert(built_lanes_result.end(), std::make_move_iterator(lanes_result.begin()),
                                 std::make_move_iterator(lanes_result.end()));
     }
@@ -353,10 +449,12 @@ std::vector<RoadGeometryBuilder::LaneConstructionResult> RoadGeometryBuilder::La
 std::vector<RoadGeometryBuilder::LaneConstructionResult> RoadGeometryBuilder::LanesBuilder::operator()() {
   std::vector<LaneConstructionResult> built_lanes_result;
   for (const auto& segment_attributes : junction_segments_attributes.second) {
+    build_control.ThrowIfCancelled();
     // Process lanes of the lane section.
     auto lanes_result = BuildLanesForSegment(
         segment_attributes.second.road_header, segment_attributes.second.lane_section,
-        segment_attributes.second.lane_section_index, factory, rg_config, rg, segment_attributes.first);
+        segment_attributes.second.lane_section_index, factory, rg_config, rg, segment_attributes.first,
+        segment_attributes.second.previous_road_geometry, num_integration_threads);
     built_lanes_result.insert(built_lanes_result.end(), std::make_move_iterator(lanes_result.begin()),
                               std::make_move_iterator(lanes_result.end()));
   }
@@ -370,6 +468,7 @@ void RoadGeometryBuilder::FillSegmentsWithLanes(RoadGeometry* rg) {
           ? LanesBuilderParallelPolicy(GetEffectiveNumberOfThreads(rg_config_.build_policy), rg)
           : LanesBuilderSequentialPolicy(rg);
   for (auto& built_lane : built_lanes_result) {
+    built_lane.lane->SetXodrLane(built_lane.xodr_lane_properties.road_header, built_lane.xodr_lane_properties.lane);
     const auto result = lane_xodr_lane_properties_.insert(
         {built_lane.lane->id(), {built_lane.lane.get(), built_lane.xodr_lane_properties}});
     MALIDRIVE_THROW_UNLESS(result.second == true);
@@ -488,31 +587,71 @@ std::unique_ptr<const maliput::api::RoadGeometry> RoadGeometryBuilder::DoBuild()
   maliput::log()->trace("Using: angular_tolerance: ", rg_config_.tolerances.angular_tolerance);
   maliput::log()->trace("Using: scale_length: ", rg_config_.scale_length);
 
-  const std::map<xodr::RoadHeader::Id, xodr::RoadHeader> road_headers = manager_->GetRoadHeaders();
+  // Bound by reference: the DBManager is moved into the RoadGeometry below but the XODR Roads it holds stay in place,
+  // so Lanes may keep pointers to them.
+  const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers = manager_->GetRoadHeaders();
 
-  const std::vector<xodr::DBManager::XodrGeometriesToSimplify> geometries_to_simplify =
+  const bool simplify_geometries =
       rg_config_.simplification_policy ==
-              RoadGeometryConfiguration::SimplificationPolicy::kSimplifyWithinToleranceAndKeepGeometryModel
-          ? manager_->GetGeometriesToSimplify(rg_config_.tolerances.linear_tolerance.value())
-          : std::vector<xodr::DBManager::XodrGeometriesToSimplify>();
+      RoadGeometryConfiguration::SimplificationPolicy::kSimplifyWithinToleranceAndKeepGeometryModel;
+  const std::vector<xodr::DBManager::XodrGeometriesToSimplify> geometries_to_simplify =
+      simplify_geometries ? manager_->GetGeometriesToSimplify(rg_config_.tolerances.linear_tolerance.value())
+                          : std::vector<xodr::DBManager::XodrGeometriesToSimplify>();
 
   auto rg =
       std::make_unique<RoadGeometry>(rg_config_.id, std::move(manager_), rg_config_.tolerances.linear_tolerance.value(),
                                      rg_config_.tolerances.angular_tolerance, rg_config_.scale_length,
                                      rg_config_.inertial_to_backend_frame_translation);
+  rg->set_simplified_geometries(simplify_geometries);
+
+  // The geometry of the previous RoadGeometry is only valid for the same tolerances, scale length and simplification
+  // policy.
+  const RoadGeometry* previous_road_geometry =
+      previous_road_geometry_ != nullptr &&
+              previous_road_geometry_->linear_tolerance() == rg_config_.tolerances.linear_tolerance.value() &&
+              previous_road_geometry_->angular_tolerance() == rg_config_.tolerances.angular_tolerance &&
+              previous_road_geometry_->scale_length() == rg_config_.scale_length &&
+              previous_road_geometry_->simplified_geometries() == simplify_geometries
+          ? previous_road_geometry_
+          : nullptr;
+  int num_reused_roads{0};
 
   maliput::log()->trace("Visiting XODR Roads...");
+  const auto is_road_to_build = [this](const xodr::RoadHeader::Id& road_id) {
+    return !road_ids_.has_value() || road_ids_->find(road_id) != road_ids_->end();
+  };
+  const int num_roads = static_cast<int>(std::count_if(road_headers.begin(), road_headers.end(),
+                                                      [&is_road_to_build](const auto& road_header) {
+                                                        return is_road_to_build(road_header.first);
+                                                      }));
+  int num_visited_roads{0};
+  build_control_.ReportProgress(BuildPhase::kRoadGeometry, num_visited_roads, num_roads);
   for (const auto& road_header : road_headers) {
+    if (!is_road_to_build(road_header.first)) {
+      continue;
+    }
+    build_control_.ThrowIfCancelled();
     maliput::log()->trace("Visiting XODR Road ID: ", road_header.first);
-    auto road_curve = BuildRoadCurve(
-        road_header.second, FilterGeometriesToSimplifyByRoadHeaderId(geometries_to_simplify, road_header.first));
-    maliput::log()->trace("Creating ReferenceLineOffset for road id ", road_header.first.string());
-    auto reference_line_offset = std::make_unique<road_curve::ScaledDomainFunction>(
-        factory_->MakeReferenceLineOffset(road_header.second.lanes.lanes_offset, road_header.second.s0(),
-                                          road_header.second.s1()),
-        road_curve->p0(), road_curve->p1(), rg_config_.tolerances.linear_tolerance.value());
-    // Add RoadCurve and the reference-line-offset function to the RoadGeometry.
-    rg->AddRoadCharacteristics(road_header.first, std::move(road_curve), std::move(reference_line_offset));
+    const std::optional<RoadGeometry::RoadCharacteristics> previous_road_characteristics =
+        previous_road_geometry != nullptr && unchanged_road_ids_.find(road_header.first) != unchanged_road_ids_.end()
+            ? previous_road_geometry->FindRoadCharacteristics(road_header.first)
+            : std::nullopt;
+    if (previous_road_characteristics.has_value()) {
+      maliput::log()->trace("Reusing RoadCurve and ReferenceLineOffset for road id ", road_header.first.string());
+      rg->AddRoadCharacteristics(road_header.first, previous_road_characteristics->road_curve,
+                                 previous_road_characteristics->reference_line_offset);
+      ++num_reused_roads;
+    } else {
+      auto road_curve = BuildRoadCurve(
+          road_header.second, FilterGeometriesToSimplifyByRoadHeaderId(geometries_to_simplify, road_header.first));
+      maliput::log()->trace("Creating ReferenceLineOffset for road id ", road_header.first.string());
+      auto reference_line_offset = std::make_unique<road_curve::ScaledDomainFunction>(
+          factory_->MakeReferenceLineOffset(road_header.second.lanes.lanes_offset, road_header.second.s0(),
+                                            road_header.second.s1()),
+          road_curve->p0(), road_curve->p1(), rg_config_.tolerances.linear_tolerance.value());
+      // Add RoadCurve and the reference-line-offset function to the RoadGeometry.
+      rg->AddRoadCharacteristics(road_header.first, std::move(road_curve), std::move(reference_line_offset));
+    }
     int lane_section_index = 0;
     for (const auto& lane_section : road_header.second.lanes.lanes_section) {
       maliput::log()->trace("Visiting XODR LaneSection: ", lane_section_index, " of Road: ", road_header.first, "...");
@@ -546,10 +685,16 @@ std::unique_ptr<const maliput::api::RoadGeometry> RoadGeometryBuilder::DoBuild()
                             " in XODR Road: ", road_header.first, "...");
 
       // Save all the attributes for building the lanes later on.
-      junctions_segments_attributes_[junction][segment] = {&road_header.second, &lane_section, lane_section_index};
+      junctions_segments_attributes_[junction][segment] = {
+          &road_header.second, &lane_section, lane_section_index,
+          previous_road_characteristics.has_value() ? previous_road_geometry : nullptr};
 
       lane_section_index++;
     }
+    build_control_.ReportProgress(BuildPhase::kRoadGeometry, ++num_visited_roads, num_roads);
+  }
+  if (previous_road_geometry_ != nullptr) {
+    maliput::log()->debug("Reused the geometry of ", num_reused_roads, " of ", num_roads, " XODR Roads.");
   }
   FillSegmentsWithLanes(rg.get());
 
@@ -558,11 +703,62 @@ std::unique_ptr<const maliput::api::RoadGeometry> RoadGeometryBuilder::DoBuild()
   for (size_t i = 0; i < bps_.size(); ++i) {
     rg->AddBranchPoint(std::move(bps_[i]));
   }
+  if (rg_config_.build_policy.lazy_lane_construction) {
+    // The LaneGraph and the ConflictZones query the geometry of the Lanes, so they are deferred too.
+    maliput::log()->trace("Deferring LaneGraph and LaneStringIndex...");
+    rg->DeferLaneGraph(LaneGraph::kDefaultLaneChangePenalty);
+  } else {
+    maliput::log()->trace("Building LaneGraph...");
+    rg->SetLaneGraph(std::make_unique<LaneGraph>(*rg, LaneGraph::kDefaultLaneChangePenalty));
+    maliput::log()->trace("Building LaneStringIndex...");
+    rg->SetLaneStringIndex(std::make_unique<LaneStringIndex>(rg->lane_graph()));
+  }
+  maliput::log()->trace("Building XodrLaneIndex...");
+  rg->SetXodrLaneIndex(std::make_unique<XodrLaneIndex>(*rg));
+  if (rg_config_.build_policy.lazy_lane_construction) {
+    maliput::log()->trace("Deferring ConflictZones...");
+    rg->DeferConflictZones([linear_tolerance = rg->linear_tolerance()](const maliput::api::Junction* junction) {
+      return FindConflictZones(junction, linear_tolerance);
+    });
+  } else {
+    maliput::log()->trace("Building ConflictZones...");
+    BuildConflictZones(rg.get());
+  }
 
   maliput::log()->trace("RoadGeometry is built.");
   return rg;
 }
 
+void RoadGeometryBuilder::BuildConflictZones(RoadGeometry* rg) {
+  MALIDRIVE_THROW_UNLESS(rg != nullptr);
+  const double linear_tolerance = rg->linear_tolerance();
+  std::vector<std::vector<ConflictZone>> conflict_zones(rg->num_junctions());
+  if (rg_config_.build_policy.type == malidrive::builder::BuildPolicy::Type::kParallel) {
+    maliput::utility::ThreadPool task_executor(GetEffectiveNumberOfThreads(rg_config_.build_policy));
+    // Queue all the tasks in the thread pool. Each task will compute the ConflictZones of a junction.
+    std::vector<std::future<std::vector<ConflictZone>>> conflict_zones_results;
+    for (int i = 0; i < rg->num_junctions(); ++i) {
+      const maliput::api::Junction* junction = rg->junction(i);
+      conflict_zones_results.push_back(task_executor.Queue(
+          [junction, linear_tolerance]() { return FindConflictZones(junction, linear_tolerance); }));
+    }
+    task_executor.Start();
+    task_executor.Finish();
+    for (int i = 0; i < rg->num_junctions(); ++i) {
+      conflict_zones[i] = conflict_zones_results[i].get();
+    }
+  } else {
+    for (int i = 0; i < rg->num_junctions(); ++i) {
+      conflict_zones[i] = FindConflictZones(rg->junction(i), linear_tolerance);
+    }
+  }
+  for (int i = 0; i < rg->num_junctions(); ++i) {
+    if (!conflict_zones[i].empty()) {
+      rg->SetConflictZones(rg->junction(i)->id(), std::move(conflict_zones[i]));
+    }
+  }
+}
+
 std::unique_ptr<road_curve::RoadCurve> RoadGeometryBuilder::BuildRoadCurve(
     const xodr::RoadHeader& road_header,
     const std::vector<xodr::DBManager::XodrGeometriesToSimplify>& geometries_to_simplify) {
@@ -604,14 +800,15 @@ std::unique_ptr<road_curve::RoadCurve> RoadGeometryBuilder::BuildRoadCurve(
 std::vector<RoadGeometryBuilder::LaneConstructionResult> RoadGeometryBuilder::BuildLanesForSegment(
     const xodr::RoadHeader* road_header, const xodr::LaneSection* lane_section, int xodr_lane_section_index,
     const RoadCurveFactoryBase* factory, const RoadGeometryConfiguration& rg_config, RoadGeometry* rg,
-    Segment* segment) {
+    Segment* segment, const RoadGeometry* previous_road_geometry, std::size_t num_integration_threads) {
   MALIDRIVE_THROW_UNLESS(lane_section != nullptr);
   MALIDRIVE_THROW_UNLESS(road_header != nullptr);
   MALIDRIVE_THROW_UNLESS(segment != nullptr);
   MALIDRIVE_THROW_UNLESS(rg != nullptr);
   MALIDRIVE_THROW_UNLESS(factory != nullptr);
+  MALIDRIVE_THROW_UNLESS(num_integration_threads > 0);
 
-  std::vector<RoadGeometryBuilder::LaneConstructionResult> built_lanes_result;
+  std::vector<LaneDescription> lane_descriptions;
   road_curve::LaneOffset::AdjacentLaneFunctions adjacent_lane_functions{nullptr, nullptr};
 
   // Lanes must be built from the center to the external lanes to correctly compute their
@@ -623,17 +820,104 @@ std::vector<RoadGeometryBuilder::LaneConstructionResult> RoadGeometryBuilder::Bu
   for (auto lane_it = lane_section->right_lanes.crbegin(); lane_it != lane_section->right_lanes.crend(); ++lane_it) {
     maliput::log()->trace("Building Lane ID: ", road_header->id.string(), "_", xodr_lane_section_index, "_",
                           lane_it->id.string(), ".");
-    LaneConstructionResult lane_construction_result =
-        BuildLane(&(*lane_it), road_header, lane_section, xodr_lane_section_index, factory, rg_config, segment,
-                  &adjacent_lane_functions);
-    maliput::log()->trace("Built Lane ID: ", lane_construction_result.lane->id().string(), ".");
-    built_lanes_result.insert(built_lanes_result.begin(), std::move(lane_construction_result));
+    lane_descriptions.insert(lane_descriptions.begin(),
+                             BuildLaneDescription(&(*lane_it), road_header, lane_section, xodr_lane_section_index,
+                                                  factory, rg_config, segment, &adjacent_lane_functions));
   }
   adjacent_lane_functions = road_curve::LaneOffset::AdjacentLaneFunctions{nullptr, nullptr};
   for (auto lane_it = lane_section->left_lanes.cbegin(); lane_it != lane_section->left_lanes.cend(); ++lane_it) {
+    lane_descriptions.push_back(BuildLaneDescription(&(*lane_it), road_header, lane_section, xodr_lane_section_index,
+                                                     factory, rg_config, segment, &adjacent_lane_functions));
+  }
+
+  // Lanes whose arc length mappings were already integrated for the previous RoadGeometry reuse them.
+  std::vector<std::optional<Lane::ArcLengthFunctions>> reused_arc_length_functions(lane_descriptions.size());
+  if (previous_road_geometry != nullptr) {
+    for (int i = 0; i < static_cast<int>(lane_descriptions.size()); ++i) {
+      reused_arc_length_functions[i] =
+          FindReusableArcLengthFunctions(*previous_road_geometry, lane_descriptions[i].lane_id);
+    }
+  }
+
+  // Lanes hidden by RoadGeometryConfiguration::omit_nondrivable_lanes are only needed for the lane offsets of the outer
+  // lanes, so they are left out of the joint integration and integrate on their own if ever queried. Lanes that reuse
+  // their arc length mappings are left out too.
+  std::vector<int> joint_indices(lane_descriptions.size(), -1);
+  std::vector<const road_curve::Function*> lane_offsets;
+  for (int i = 0; i < static_cast<int>(lane_descriptions.size()); ++i) {
+    if (rg_config.omit_nondrivable_lanes && !is_driveable_lane(*lane_descriptions[i].xodr_lane_properties.lane)) {
+      continue;
+    }
+    if (reused_arc_length_functions[i].has_value()) {
+      continue;
+    }
+    joint_indices[i] = static_cast<int>(lane_offsets.size());
+    lane_offsets.push_back(lane_descriptions[i].lane_offset.get());
+  }
+  if (lane_offsets.size() < lane_descriptions.size()) {
+    maliput::log()->trace("Left ", lane_descriptions.size() - lane_offsets.size(),
+                          " hidden or reused lanes of segment ", segment->id().string(),
+                          " out of the joint integration.");
+  }
+  const auto deferred_arc_length_functions = []() { return Lane::ArcLengthFunctions{}; };
+  // Builds the `i`-th Lane with its reused arc length mappings.
+  const auto build_reused_lane = [&lane_descriptions, &reused_arc_length_functions, segment](int i) {
+    maliput::log()->trace("Reusing the arc length mappings of Lane ID: ", lane_descriptions[i].lane_id.string(), ".");
+    return BuildLane(std::move(lane_descriptions[i]), segment, *reused_arc_length_functions[i]);
+  };
+
+  std::vector<RoadGeometryBuilder::LaneConstructionResult> built_lanes_result;
+  if (rg_config.build_policy.lazy_lane_construction) {
+    // The arc lengths of all the lanes are integrated together on the first geometric query to any of them.
+    std::shared_ptr<LazyJointRoadCurveOffset> lazy_joint_road_curve_offset;
+    if (!lane_offsets.empty()) {
+      lazy_joint_road_curve_offset = std::make_shared<LazyJointRoadCurveOffset>(
+          segment->road_curve(), std::move(lane_offsets), lane_descriptions.front().p0, lane_descriptions.front().p1);
+    }
+    for (int i = 0; i < static_cast<int>(lane_descriptions.size()); ++i) {
+      const int joint_index = joint_indices[i];
+      built_lanes_result.push_back(
+          reused_arc_length_functions[i].has_value() ? build_reused_lane(i)
+          : joint_index < 0 ? BuildLane(std::move(lane_descriptions[i]), segment, deferred_arc_length_functions)
+                            : BuildLane(std::move(lane_descriptions[i]), segment,
+                                        [lazy_joint_road_curve_offset, joint_index]() {
+                                          return lazy_joint_road_curve_offset->Get(joint_index);
+                                        }));
+      maliput::log()->trace("Built Lane ID: ", built_lanes_result.back().lane->id().string(), ".");
+    }
+    return built_lanes_result;
+  }
+
+  // All the lanes share the RoadCurve and the p range, so their arc lengths are integrated together.
+  // Lanes whose ground curve is shorter than the linear tolerance use linear mappings instead, see Lane's constructor.
+  std::unique_ptr<road_curve::JointRoadCurveOffset> joint_road_curve_offset;
+  if (!lane_offsets.empty()) {
+    const road_curve::RoadCurve* segment_road_curve = segment->road_curve();
+    const double p0 = lane_descriptions.front().p0;
+    const double p1 = lane_descriptions.front().p1;
+    const double lane_ground_curve_lmax =
+        segment_road_curve->LMax() * (p1 - p0) / (segment_road_curve->p1() - segment_road_curve->p0());
+    if (lane_ground_curve_lmax > segment_road_curve->linear_tolerance()) {
+      // Long roads made of many geometries would otherwise integrate sequentially and set the build wall time.
+      joint_road_curve_offset = std::make_unique<road_curve::JointRoadCurveOffset>(
+          segment_road_curve, lane_offsets, p0, p1, num_integration_threads);
+      maliput::log()->trace("Integrated ", lane_offsets.size(), " lanes of segment ", segment->id().string(), " in ",
+                            joint_road_curve_offset->num_chunks(), " chunks with ",
+                            joint_road_curve_offset->num_evaluations(), " RoadCurve evaluations.");
+    }
+  }
+
+  for (int i = 0; i < static_cast<int>(lane_descriptions.size()); ++i) {
+    const int joint_index = joint_indices[i];
     LaneConstructionResult lane_construction_result =
-        BuildLane(&(*lane_it), road_header, lane_section, xodr_lane_section_index, factory, rg_config, segment,
-                  &adjacent_lane_functions);
+        reused_arc_length_functions[i].has_value() ? build_reused_lane(i)
+        : joint_index < 0 ? BuildLane(std::move(lane_descriptions[i]), segment, deferred_arc_length_functions)
+        : joint_road_curve_offset != nullptr
+            ? BuildLane(std::move(lane_descriptions[i]), segment,
+                        Lane::ArcLengthFunctions{joint_road_curve_offset->SFromP(joint_index),
+                                                 joint_road_curve_offset->PFromS(joint_index),
+                                                 joint_road_curve_offset->PFromSBatch(joint_index)})
+            : BuildLane(std::move(lane_descriptions[i]), segment, Lane::ArcLengthFunctions{});
     maliput::log()->trace("Built Lane ID: ", lane_construction_result.lane->id().string(), ".");
     built_lanes_result.push_back(std::move(lane_construction_result));
   }
@@ -740,22 +1024,24 @@ std::vector<maliput::api::LaneEnd> RoadGeometryBuilder::FindConnectingLaneEndsFo
         if (xodr_lane_properties.road_header->road_link.predecessor->element_type ==
             xodr::RoadLink::ElementType::kRoad) {
           return SolveLaneEndsForConnectingRoad(rg, xodr_lane_properties, rg->get_manager()->GetRoadHeaders(),
-                                                XodrConnectionType::kPredecessor);
+                                                XodrConnectionType::kPredecessor, road_ids_);
         } else {
           // Predecessor is a junction.
           return SolveLaneEndsForJunction(rg, xodr_lane_properties, rg->get_manager()->GetRoadHeaders(),
-                                          rg->get_manager()->GetJunctions(), XodrConnectionType::kPredecessor);
+                                          rg->get_manager()->GetJunctions(), XodrConnectionType::kPredecessor,
+                                          road_ids_);
         }
       }
     } else {
       if (xodr_lane_properties.road_header->road_link.successor.has_value()) {
         if (xodr_lane_properties.road_header->road_link.successor->element_type == xodr::RoadLink::ElementType::kRoad) {
           return SolveLaneEndsForConnectingRoad(rg, xodr_lane_properties, rg->get_manager()->GetRoadHeaders(),
-                                                XodrConnectionType::kSuccessor);
+                                                XodrConnectionType::kSuccessor, road_ids_);
         } else {
           // Successor is a junction.
           return SolveLaneEndsForJunction(rg, xodr_lane_properties, rg->get_manager()->GetRoadHeaders(),
-                                          rg->get_manager()->GetJunctions(), XodrConnectionType::kSuccessor);
+                                          rg->get_manager()->GetJunctions(), XodrConnectionType::kSuccessor,
+                                          road_ids_);
         }
       }
     }
@@ -765,7 +1051,8 @@ std::vector<maliput::api::LaneEnd> RoadGeometryBuilder::FindConnectingLaneEndsFo
     return SolveLaneEndsWithinJunction(rg, xodr_lane_properties, rg->get_manager()->GetRoadHeaders(),
                                        lane_end.end != maliput::api::LaneEnd::Which::kStart
                                            ? XodrConnectionType::kSuccessor
-                                           : XodrConnectionType::kPredecessor);
+                                           : XodrConnectionType::kPredecessor,
+                                       road_ids_);
   }
 }
 
@@ -29,8 +29,11 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -40,6 +43,7 @@
 #include "maliput_malidrive/base/lane.h"
 #include "maliput_malidrive/base/road_geometry.h"
 #include "maliput_malidrive/base/segment.h"
+#include "maliput_malidrive/builder/build_control.h"
 #include "maliput_malidrive/builder/builder_tools.h"
 #include "maliput_malidrive/builder/id_providers.h"
 #include "maliput_malidrive/builder/road_curve_factory.h"
@@ -138,6 +142,31 @@ class RoadGeometryBuilder {
   /// Note: the `opendrive_file` parameter of `road_geometry_configuration` is
   /// ignored because a manager is expected to emerge.
   ///
+  /// `build_control` reports BuildPhase::kRoadGeometry progress once per XODR
+  /// Road and is checked for cancellation before each XODR Road and each
+  /// Segment's Lanes are built. When several tolerances are tried, progress
+  /// restarts with each trial.
+  ///
+  /// When `road_ids` is provided, only those XODR Roads are built. Lanes that
+  /// connect to XODR Roads which are not built are left unconnected at that
+  /// end. It is used to build a region of the map first, see
+  /// ProgressiveRoadGeometry. When
+  /// `road_geometry_configuration.build_region` is set too, only the XODR
+  /// Roads in both are built.
+  ///
+  /// When `previous_road_geometry` is provided, the XODR Roads whose
+  /// xodr::RoadHeader did not change with respect to its xodr::DBManager, see
+  /// DiffRoads(), reuse its road_curve::RoadCurves and the arc length mappings
+  /// of its Lanes, see Lane::GetArcLengthFunctions(). Only the changed XODR
+  /// Roads are integrated again. Junctions, Segments, Lanes and BranchPoints
+  /// are always built anew. The reuse only happens while the tolerances, the
+  /// scale length and whether XODR geometries are simplified, see
+  /// `road_geometry_configuration.simplification_policy`, match those of
+  /// `previous_road_geometry`. It must outlive operator()() but not the
+  /// resulting RoadGeometry.
+  ///
+  /// @throws BuildCancelledError From operator()() when `build_control` is
+  /// cancelled.
   /// @throws maliput::common::assertion_error When
   /// `road_geometry_configuration.tolerances.linear_tolerance`,
   /// `road_geometry_configuration.tolerances.angular_tolerance` or
@@ -145,8 +174,15 @@ class RoadGeometryBuilder {
   /// @throws maliput::common::assertion_error When `road_geometry_configuration.tolerances.max_linear_tolerance` is
   /// less than `road_geometry_configuration.tolerances.linear_tolerance`.
   /// @throws maliput::common::assertion_error When `manager` is nullptr.
+  /// @throws maliput::common::assertion_error When
+  /// `road_geometry_configuration.build_region->topological_radius` is negative.
+  /// @throws maliput::common::assertion_error When `previous_road_geometry`
+  /// has no xodr::DBManager.
   RoadGeometryBuilder(std::unique_ptr<xodr::DBManager> manager,
-                      const RoadGeometryConfiguration& road_geometry_configuration);
+                      const RoadGeometryConfiguration& road_geometry_configuration,
+                      const BuildControl& build_control = {},
+                      const std::optional<std::set<xodr::RoadHeader::Id>>& road_ids = std::nullopt,
+                      const RoadGeometry* previous_road_geometry = nullptr);
 
   /// Creates a maliput equivalent backend (malidrive::RoadGeometry).
   ///
@@ -173,6 +209,22 @@ class RoadGeometryBuilder {
     const xodr::RoadHeader* road_header{};
     const xodr::LaneSection* lane_section{};
     int lane_section_index{};
+    // RoadGeometry whose Lanes hold the arc length mappings to reuse for the Lanes of the Segment. When nullptr, they
+    // are integrated.
+    const RoadGeometry* previous_road_geometry{};
+  };
+
+  // Holds the functions and identifiers needed to construct a Lane.
+  struct LaneDescription {
+    maliput::api::LaneId lane_id;
+    int xodr_track_id{};
+    int xodr_lane_id{};
+    std::unique_ptr<road_curve::Function> lane_width{};
+    std::unique_ptr<road_curve::Function> lane_offset{};
+    double p0{};
+    double p1{};
+    MalidriveXodrLaneProperties xodr_lane_properties{nullptr /*road_header*/, nullptr /*lane_section*/,
+                                                     0 /*lane_section_index*/, nullptr /*lane*/};
   };
 
   // Holds the lane construction task result.
@@ -190,22 +242,29 @@ class RoadGeometryBuilder {
     // `factory_in` Is a pointer to the RoadCurveFactoryBase.
     // `rg_config_in` road geometry configuration.
     // `rg_in` Is a pointer to the RoadGeometry.
+    // `build_control_in` Is checked for cancellation before the Lanes of each Segment are built.
+    // `num_integration_threads_in` Is the number of threads each Segment's arc length integration may use. It must be
+    //                              positive.
     //
     // Note: All input parameters are aliased and thus must remain valid for the duration of this class instance.
     //
     // @throws maliput::common::assertion_error When `rg` is nullptr.
     // @throws maliput::common::assertion_error When `factory` is nullptr.
+    // @throws maliput::common::assertion_error When `num_integration_threads_in` is zero.
     LanesBuilder(const std::pair<maliput::geometry_base::Junction*,
                                  std::map<Segment*, RoadGeometryBuilder::SegmentConstructionAttributes>>&
                      junction_segments_attributes_in,
                  const RoadCurveFactoryBase* factory_in, const RoadGeometryConfiguration& rg_config_in,
-                 RoadGeometry* rg_in)
+                 RoadGeometry* rg_in, const BuildControl& build_control_in, std::size_t num_integration_threads_in)
         : junction_segments_attributes(junction_segments_attributes_in),
           factory(factory_in),
           rg_config(rg_config_in),
-          rg(rg_in) {
+          rg(rg_in),
+          build_control(build_control_in),
+          num_integration_threads(num_integration_threads_in) {
       MALIDRIVE_THROW_UNLESS(rg != nullptr);
       MALIDRIVE_THROW_UNLESS(factory != nullptr);
+      MALIDRIVE_THROW_UNLESS(num_integration_threads > 0);
     }
 
     // Returns A vector containing all the created Lanes and its properties.
@@ -219,6 +278,8 @@ class RoadGeometryBuilder {
     const RoadCurveFactoryBase* factory{};
     const RoadGeometryConfiguration& rg_config;
     RoadGeometry* rg{};
+    const BuildControl& build_control;
+    const std::size_t num_integration_threads{};
   };
 
   // Convenient enumeration to identify on which side of a BranchPoint a LaneEnd
@@ -242,7 +303,8 @@ class RoadGeometryBuilder {
       const maliput::api::LaneEnd& lane_end,
       const std::vector<std::unique_ptr<maliput::geometry_base::BranchPoint>>& bps);
 
-  // Builds a Lane and returns within a LaneConstructionResult that holds extra attributes related to the lane.
+  // Builds the width and offset functions of a Lane and returns them within a LaneDescription that holds extra
+  // attributes related to the lane.
   // `lane` must not be nullptr.
   // `road_header` must not be nullptr.
   // `lane_section` must not be nullptr.
@@ -251,18 +313,39 @@ class RoadGeometryBuilder {
   // `rg_config` road geometry configuration.
   // `segment` must not be nullptr.
   // `adjacent_lane_functions` holds the offset and width functions of the immediate inner lane, must not be nullptr.
+  //                           It is updated with the functions of the new lane.
   //
   // @throws maliput::common::assertion_error When aforementioned conditions aren't met.
-  static LaneConstructionResult BuildLane(const xodr::Lane* lane, const xodr::RoadHeader* road_header,
-                                          const xodr::LaneSection* lane_section, int xodr_lane_section_index,
-                                          const RoadCurveFactoryBase* factory,
-                                          const RoadGeometryConfiguration& rg_config, Segment* segment,
-                                          road_curve::LaneOffset::AdjacentLaneFunctions* adjacent_lane_functions);
+  static LaneDescription BuildLaneDescription(const xodr::Lane* lane, const xodr::RoadHeader* road_header,
+                                              const xodr::LaneSection* lane_section, int xodr_lane_section_index,
+                                              const RoadCurveFactoryBase* factory,
+                                              const RoadGeometryConfiguration& rg_config, Segment* segment,
+                                              road_curve::LaneOffset::AdjacentLaneFunctions* adjacent_lane_functions);
+
+  // Builds a Lane out of `lane_description` and returns within a LaneConstructionResult that holds extra attributes
+  // related to the lane.
+  // `segment` must not be nullptr.
+  // `arc_length_functions` are the arc length mappings of the lane. When any of `s_from_p` or `p_from_s` is empty,
+  // the Lane integrates its own.
+  //
+  // @throws maliput::common::assertion_error When `segment` is nullptr.
+  static LaneConstructionResult BuildLane(LaneDescription lane_description, Segment* segment,
+                                          Lane::ArcLengthFunctions arc_length_functions);
+
+  // Same as the other BuildLane() but the arc length mappings of the Lane are built on its first geometric query out
+  // of `arc_length_functions_builder`. See malidrive::Lane.
+  //
+  // @throws maliput::common::assertion_error When `segment` is nullptr.
+  static LaneConstructionResult BuildLane(LaneDescription lane_description, Segment* segment,
+                                          std::function<Lane::ArcLengthFunctions()> arc_length_functions_builder);
+
   // Builds malidrive::Lanes from the XODR `lane_section` and returns a vector of
   // LaneConstructionResult objects containing the built Lane and properties needed to later on
   // add the Lane to its correspondant Segment.
   // While the Lanes are built from the center to the external lanes to correctly compute their
   // lane offset, the returned vector is filled with the Lanes in right-to-left order of the Segment.
+  // The arc length of all the Lanes is integrated at once with a road_curve::JointRoadCurveOffset, so the
+  // RoadCurve is evaluated once per integration node for the whole Segment.
   //
   // `road_header` must not be nullptr.
   // `lane_section` must not be nullptr.
@@ -271,15 +354,18 @@ class RoadGeometryBuilder {
   // `factory` must not be nullptr.
   // `rg_config` road geometry configuration.
   // `segment` must not be nullptr.
+  // `previous_road_geometry` holds Lanes with the same IDs and geometry whose arc length mappings are reused instead
+  //                          of integrated. It may be nullptr.
+  // `num_integration_threads` is the number of threads the integration of the arc length of the Lanes may use. It
+  //                           must be positive. Callers that already run in a thread pool pass their share of it.
   //
   // @throws maliput::common::assertion_error When either `segment`,
   //         `lane_section`, `road_header` or `rg` are nullptr.
-  static std::vector<LaneConstructionResult> BuildLanesForSegment(const xodr::RoadHeader* road_header,
-                                                                  const xodr::LaneSection* lane_section,
-                                                                  int xodr_lane_section_index,
-                                                                  const RoadCurveFactoryBase* factory,
-                                                                  const RoadGeometryConfiguration& rg_config,
-                                                                  RoadGeometry* rg, Segment* segment);
+  // @throws maliput::common::assertion_error When `num_integration_threads` is zero.
+  static std::vector<LaneConstructionResult> BuildLanesForSegment(
+      const xodr::RoadHeader* road_header, const xodr::LaneSection* lane_section, int xodr_lane_section_index,
+      const RoadCurveFactoryBase* factory, const RoadGeometryConfiguration& rg_config, RoadGeometry* rg,
+      Segment* segment, const RoadGeometry* previous_road_geometry, std::size_t num_integration_threads);
 
   // Analyzes the width description of the Lane and looks for negative width values.
   // In order to guarantee non-negative values, each piece of the piecewise-defined lane width function must comply
@@ -404,6 +490,14 @@ class RoadGeometryBuilder {
   // @throws maliput::common::assertion_error When `rg` is nullptr.
   void FillSegmentsWithLanes(RoadGeometry* rg);
 
+  // Computes the ConflictZones of every Junction of the RoadGeometry and stores them in it.
+  // When #rg_config_.build_policy is parallel, each thread takes care of a Junction at a time.
+  //
+  // `rg` Is a pointer to the RoadGeometry.
+  //
+  // @throws maliput::common::assertion_error When `rg` is nullptr.
+  void BuildConflictZones(RoadGeometry* rg);
+
   // Executes the build process itself.
   //
   // Visits nodes in the xodr map via DBManager to build Junctions, Segments and
@@ -465,9 +559,21 @@ class RoadGeometryBuilder {
   // Holds the configuration of this builder.
   RoadGeometryConfiguration rg_config_;
 
+  // Reports progress and checks cancellation.
+  const BuildControl build_control_;
+
+  // XODR Roads to build, narrowed by RoadGeometryConfiguration::build_region. When nullopt, all of them are built.
+  std::optional<std::set<xodr::RoadHeader::Id>> road_ids_;
+
   // Holds the xodr database.
   std::unique_ptr<xodr::DBManager> manager_;
 
+  // RoadGeometry to reuse the geometry of the unchanged XODR Roads from. It may be nullptr.
+  const RoadGeometry* previous_road_geometry_{};
+
+  // XODR Roads whose xodr::RoadHeader is equal in #manager_ and in the xodr::DBManager of #previous_road_geometry_.
+  std::set<xodr::RoadHeader::Id> unchanged_road_ids_;
+
   // Holds the factory to build road curves.
   std::unique_ptr<RoadCurveFactoryBase> factory_;
 
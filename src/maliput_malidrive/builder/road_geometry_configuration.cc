@@ -29,8 +29,12 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/builder/road_geometry_configuration.h"
 
+#include <algorithm>
 #include <map>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "maliput_malidrive/builder/params.h"
 #include "maliput_malidrive/common/macros.h"
@@ -85,6 +89,16 @@ std::vector<std::string> SplitTextBy(const std::string& text, char token) {
   return strings;
 }
 
+// Returns @p text without its leading and trailing whitespaces.
+std::string Trim(const std::string& text) {
+  const auto first = text.find_first_not_of(" \t");
+  if (first == std::string::npos) {
+    return "";
+  }
+  const auto last = text.find_last_not_of(" \t");
+  return text.substr(first, last - first + 1);
+}
+
 // Parses @p bool_str to obtain a boolean type.
 //
 // @returns True when `bool_str` is "true", "True", "TRUE", "on", "On" or "ON".
@@ -152,6 +166,11 @@ RoadGeometryConfiguration RoadGeometryConfiguration::FromMap(
     rg_config.build_policy = BuildPolicy{build_policy_type, num_threads};
   }
 
+  it = road_geometry_configuration.find(params::kLazyLaneConstruction);
+  if (it != road_geometry_configuration.end()) {
+    rg_config.build_policy.lazy_lane_construction = ParseBoolean(it->second);
+  }
+
   it = road_geometry_configuration.find(params::kSimplificationPolicy);
   if (it != road_geometry_configuration.end()) {
     rg_config.simplification_policy = FromStrToSimplificationPolicy(it->second);
@@ -166,6 +185,35 @@ RoadGeometryConfiguration RoadGeometryConfiguration::FromMap(
   if (it != road_geometry_configuration.end()) {
     rg_config.omit_nondrivable_lanes = ParseBoolean(it->second);
   }
+
+  it = road_geometry_configuration.find(params::kBuildRegionBoundingBox);
+  if (it != road_geometry_configuration.end()) {
+    const maliput::math::Vector4 corners = maliput::math::Vector4::FromStr(it->second);
+    rg_config.build_region.emplace();
+    rg_config.build_region->bounding_box =
+        BuildRegion::BoundingBox{{corners.x(), corners.y()}, {corners.z(), corners.w()}};
+  }
+
+  it = road_geometry_configuration.find(params::kBuildRegionRoadIds);
+  if (it != road_geometry_configuration.end()) {
+    if (!rg_config.build_region.has_value()) {
+      rg_config.build_region.emplace();
+    }
+    for (const std::string& road_id : SplitTextBy(it->second, ',')) {
+      const std::string trimmed_road_id = Trim(road_id);
+      if (!trimmed_road_id.empty()) {
+        rg_config.build_region->road_ids.push_back(trimmed_road_id);
+      }
+    }
+  }
+
+  it = road_geometry_configuration.find(params::kBuildRegionTopologicalRadius);
+  if (it != road_geometry_configuration.end()) {
+    if (!rg_config.build_region.has_value()) {
+      rg_config.build_region.emplace();
+    }
+    rg_config.build_region->topological_radius = std::stoi(it->second);
+  }
   return rg_config;
 }
 
@@ -189,6 +237,22 @@ std::map<std::string, std::string> RoadGeometryConfiguration::ToStringMap() cons
   if (build_policy.num_threads.has_value()) {
     config_map.emplace(params::kNumThreads, std::to_string(build_policy.num_threads.value()));
   }
+  config_map.emplace(params::kLazyLaneConstruction, build_policy.lazy_lane_construction ? "true" : "false");
+  if (build_region.has_value()) {
+    if (build_region->bounding_box.has_value()) {
+      const BuildRegion::BoundingBox& bounding_box = build_region->bounding_box.value();
+      config_map.emplace(params::kBuildRegionBoundingBox,
+                         maliput::math::Vector4{bounding_box.min_corner.x(), bounding_box.min_corner.y(),
+                                                bounding_box.max_corner.x(), bounding_box.max_corner.y()}
+                             .to_str());
+    }
+    std::string road_ids;
+    for (const std::string& road_id : build_region->road_ids) {
+      road_ids += (road_ids.empty() ? "" : ",") + road_id;
+    }
+    config_map.emplace(params::kBuildRegionRoadIds, road_ids);
+    config_map.emplace(params::kBuildRegionTopologicalRadius, std::to_string(build_region->topological_radius));
+  }
   return config_map;
 }
 
@@ -202,6 +266,18 @@ BuildPolicy::Type BuildPolicy::FromStrToType(const std::string& type) {
 
 std::string BuildPolicy::FromTypeToStr(const BuildPolicy::Type& type) { return build_policy_type_to_str.at(type); }
 
+std::size_t GetEffectiveNumberOfThreads(const BuildPolicy& build_policy) {
+  if (build_policy.type != BuildPolicy::Type::kParallel) {
+    return 1;
+  }
+  if (build_policy.num_threads.has_value()) {
+    return static_cast<std::size_t>(std::max(build_policy.num_threads.value(), 1));
+  }
+  // std::thread::hardware_concurrency() returns zero when it is not computable.
+  const unsigned int hardware_concurrency = std::thread::hardware_concurrency();
+  return hardware_concurrency > 1 ? static_cast<std::size_t>(hardware_concurrency - 1) : 1;
+}
+
 RoadGeometryConfiguration::SimplificationPolicy RoadGeometryConfiguration::FromStrToSimplificationPolicy(
     const std::string& policy) {
   const auto it = str_to_simplification_policy.find(policy);
@@ -29,8 +29,10 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <maliput/api/road_network.h>
 #include <maliput/math/vector.h>
@@ -64,9 +66,49 @@ struct BuildPolicy {
 
   Type type{Type::kSequential};
   std::optional<int> num_threads{};
+  /// When true, the arc length mappings of the Lanes of a Segment are
+  /// integrated on the first geometric query to any of them instead of at load
+  /// time. Integration errors then surface on that query and do not take part
+  /// in the linear tolerance range search. Rule builders use
+  /// Lane::EstimateLength() and Lane::EstimateLaneSFromTrackS(), so they do
+  /// not trigger it. See params::kLazyLaneConstruction.
+  bool lazy_lane_construction{false};
 };
 
+/// Computes the number of threads a build uses under `build_policy`.
+///
+/// @param build_policy The BuildPolicy of the build.
+/// @returns One when `build_policy.type` is BuildPolicy::Type::kSequential.
+///          Otherwise, `build_policy.num_threads` when it has a value, or what
+///          the hardware supports minus one (the running thread). It is at
+///          least one, even when the hardware concurrency is unknown.
+std::size_t GetEffectiveNumberOfThreads(const BuildPolicy& build_policy);
+
 /// RoadGeometry construction parameters.
+/// Restricts a RoadGeometry to an area of the XODR map.
+///
+/// The XODR description is parsed fully, but only the selected XODR Roads are
+/// built. A XODR Road is selected when its ID is listed in `road_ids` or when
+/// any of its plan view geometries overlaps `bounding_box`. Selected XODR
+/// Roads are expanded `topological_radius` times by their neighbours: XODR
+/// Roads linked through a predecessor / successor, or through a XODR Junction.
+/// Finally, when a selected XODR Road belongs to a XODR Junction, all the
+/// connecting XODR Roads of that XODR Junction are selected too.
+///
+/// Lanes that connect to XODR Roads which are not selected are left
+/// unconnected at that end.
+struct BuildRegion {
+  /// Axis aligned box in the Inertial Frame.
+  struct BoundingBox {
+    maliput::math::Vector2 min_corner{};
+    maliput::math::Vector2 max_corner{};
+  };
+
+  std::optional<BoundingBox> bounding_box{};
+  std::vector<std::string> road_ids{};
+  int topological_radius{0};
+};
+
 struct RoadGeometryConfiguration {
   /// Level of flexibility in terms of adhering to the OpenDrive standard
   /// when constructing a RoadGeometry. This is useful when working with
@@ -182,6 +224,8 @@ struct RoadGeometryConfiguration {
   // Lane 1 will not be considered but lane 2 yes. However, because of omitting
   // lane 1, the lane 2 will have an incorrect lane offset function.
   bool omit_nondrivable_lanes{true};
+  /// When set, only the XODR Roads within the region are built.
+  std::optional<BuildRegion> build_region{};
   /// @}
 };
 
@@ -29,6 +29,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/builder/road_network_builder.h"
 
+#include <cstddef>
+#include <future>
 #include <map>
 #include <optional>
 #include <utility>
@@ -48,6 +50,7 @@
 #include <maliput/common/logger.h>
 #include <maliput/common/maliput_unused.h>
 
+#include "maliput_malidrive/base/road_geometry.h"
 #include "maliput_malidrive/builder/builder_tools.h"
 #include "maliput_malidrive/builder/direction_usage_builder.h"
 #include "maliput_malidrive/builder/discrete_value_rule_state_provider_builder.h"
@@ -73,36 +76,65 @@ std::unique_ptr<maliput::api::RoadNetwork> RoadNetworkBuilder::operator()() cons
   const auto& rg_config = rn_config.road_geometry_configuration;
   MALIDRIVE_VALIDATE(!rg_config.opendrive_file.empty(), std::runtime_error, "opendrive_file cannot be empty");
 
+  // The TrafficLightBook and the rule types of the RuleRegistry YAML file do not depend on the RoadGeometry, so they
+  // are loaded while the XODR file is parsed and the RoadGeometry is built.
+  auto traffic_light_book_future = std::async(std::launch::async, [&rn_config]() {
+    maliput::log()->trace("Building TrafficLightBook...");
+    auto traffic_light_book = !rn_config.traffic_light_book.has_value()
+                                  ? std::make_unique<maliput::TrafficLightBook>()
+                                  : maliput::LoadTrafficLightBookFromFile(rn_config.traffic_light_book.value());
+    maliput::log()->trace("Built TrafficLightBook.");
+    return traffic_light_book;
+  });
+  auto loaded_rule_registry_future = std::async(std::launch::async, [&rn_config]() {
+    return RuleRegistryBuilder::LoadRuleRegistry(rn_config.rule_registry);
+  });
+
   const xodr::ParserConfiguration parser_config = XodrParserConfigurationFromRoadGeometryConfiguration(rg_config);
+  build_control_.ReportProgress(BuildPhase::kParsing, 0, 1);
   maliput::log()->trace("Loading database from file: ", rg_config.opendrive_file, " ...");
   auto db_manager = xodr::LoadDataBaseFromFile(rg_config.opendrive_file, parser_config);
+  build_control_.ReportProgress(BuildPhase::kParsing, 1, 1);
+  build_control_.ThrowIfCancelled();
+  const RoadGeometry* previous_rg =
+      previous_road_network_ != nullptr ? dynamic_cast<const RoadGeometry*>(previous_road_network_->road_geometry())
+                                        : nullptr;
+  if (previous_road_network_ != nullptr && previous_rg == nullptr) {
+    maliput::log()->warn("The previous RoadNetwork is not a maliput_malidrive one, it is ignored.");
+  }
   maliput::log()->trace("Building RoadGeometry...");
-  std::unique_ptr<const maliput::api::RoadGeometry> rg =
-      builder::RoadGeometryBuilder(std::move(db_manager), rg_config)();
-
-  auto direction_usages = DirectionUsageBuilder(rg.get())();
-  maliput::common::unused(direction_usages);
-  auto speed_limits = SpeedLimitBuilder(rg.get())();
-  maliput::common::unused(speed_limits);
-
-  maliput::log()->trace("Building TrafficLightBook...");
-  auto traffic_light_book = !rn_config.traffic_light_book.has_value()
-                                ? std::make_unique<maliput::TrafficLightBook>()
-                                : maliput::LoadTrafficLightBookFromFile(rn_config.traffic_light_book.value());
-  maliput::log()->trace("Built TrafficLightBook.");
+  std::unique_ptr<const maliput::api::RoadGeometry> rg = builder::RoadGeometryBuilder(
+      std::move(db_manager), rg_config, build_control_, std::nullopt /* road_ids */, previous_rg)();
+  build_control_.ThrowIfCancelled();
+  build_control_.ReportProgress(BuildPhase::kRules, 0, 1);
+
+  // Old rules are built while the RuleRegistry is completed with the rule types that depend on the RoadGeometry.
+  const std::size_t num_threads_for_rules = GetEffectiveNumberOfThreads(rg_config.build_policy);
+  auto old_rules_future = std::async(std::launch::async, [&rg, num_threads_for_rules]() {
+    auto direction_usages = DirectionUsageBuilder(rg.get(), num_threads_for_rules)();
+    auto speed_limits = SpeedLimitBuilder(rg.get(), num_threads_for_rules)();
+    return std::make_pair(std::move(direction_usages), std::move(speed_limits));
+  });
 
   maliput::log()->trace("Building RuleRegistry...");
-  auto rule_registry = RuleRegistryBuilder(rg.get(), rn_config.rule_registry)();
+  auto rule_registry = RuleRegistryBuilder(rg.get(), rn_config.rule_registry)(loaded_rule_registry_future.get());
   maliput::log()->trace("Built RuleRegistry...");
 
+  const auto [direction_usages, speed_limits] = old_rules_future.get();
+  auto traffic_light_book = traffic_light_book_future.get();
+
   maliput::log()->trace("Building RuleRoadBook...\n\t|_ ",
                         rn_config.rule_registry.has_value() ? "Based on new rule API" : "Based on old rule API");
 
   auto rule_book = rn_config.rule_registry.has_value()
-                       ? RoadRuleBookBuilder(rg.get(), rule_registry.get(), rn_config.road_rule_book)()
+                       ? RoadRuleBookBuilder(rg.get(), rule_registry.get(), rn_config.road_rule_book,
+                                             num_threads_for_rules)()
                        : RoadRuleBookBuilderOldRules(rg.get(), rule_registry.get(), rn_config.road_rule_book,
                                                      direction_usages, speed_limits)();
   maliput::log()->trace("Built RuleRoadBook.");
+  build_control_.ReportProgress(BuildPhase::kRules, 1, 1);
+  build_control_.ThrowIfCancelled();
+  build_control_.ReportProgress(BuildPhase::kBooks, 0, 1);
 
   maliput::log()->trace("Building PhaseRingBook...");
   maliput::log()->trace("Building PhaseRingBook...\n\t|_ ",
@@ -144,6 +176,8 @@ std::unique_ptr<maliput::api::RoadNetwork> RoadNetworkBuilder::operator()() cons
                                                                                          manual_phase_provider.get());
 #pragma GCC diagnostic pop
   maliput::log()->trace("Built RuleStateProvider.");
+  build_control_.ReportProgress(BuildPhase::kBooks, 1, 1);
+  build_control_.ReportProgress(BuildPhase::kDone, 1, 1);
 
   return std::make_unique<maliput::api::RoadNetwork>(
       std::move(rg), std::move(rule_book), std::move(traffic_light_book), std::move(intersection_book),
@@ -29,7 +29,12 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/builder/road_rulebook_builder.h"
 
+#include <utility>
+#include <vector>
+
+#include <maliput/api/junction.h>
 #include <maliput/api/regions.h>
+#include <maliput/api/segment.h>
 #include <maliput/base/road_rulebook_loader.h>
 
 #include "maliput_malidrive/builder/builder_tools.h"
@@ -45,12 +50,34 @@ using maliput::api::rules::DiscreteValueRule;
 using maliput::api::rules::RangeValueRule;
 using maliput::api::rules::Rule;
 
+namespace {
+
+// @returns The malidrive::Lanes of `junction`.
+// @throws maliput::common::assertion_error When a Lane of `junction` is not a malidrive::Lane.
+std::vector<const Lane*> GetLanesOf(const maliput::api::Junction* junction) {
+  std::vector<const Lane*> lanes;
+  for (int i = 0; i < junction->num_segments(); ++i) {
+    const maliput::api::Segment* segment = junction->segment(i);
+    for (int j = 0; j < segment->num_lanes(); ++j) {
+      const Lane* lane = dynamic_cast<const Lane*>(segment->lane(j));
+      MALIDRIVE_THROW_UNLESS(lane != nullptr);
+      lanes.push_back(lane);
+    }
+  }
+  return lanes;
+}
+
+}  // namespace
+
 RoadRuleBookBuilder::RoadRuleBookBuilder(const maliput::api::RoadGeometry* rg,
                                          const maliput::api::rules::RuleRegistry* rule_registry,
-                                         const std::optional<std::string>& road_rulebook_file_path)
-    : rg_(rg), rule_registry_(rule_registry), road_rulebook_file_path_(road_rulebook_file_path) {
+                                         const std::optional<std::string>& road_rulebook_file_path,
+                                         std::size_t num_threads)
+    : rg_(rg), rule_registry_(rule_registry), road_rulebook_file_path_(road_rulebook_file_path),
+      num_threads_(num_threads) {
   MALIDRIVE_THROW_UNLESS(rg_ != nullptr);
   MALIDRIVE_THROW_UNLESS(rule_registry_ != nullptr);
+  MALIDRIVE_THROW_UNLESS(num_threads_ > 0);
 }
 
 std::unique_ptr<const maliput::api::rules::RoadRulebook> RoadRuleBookBuilder::operator()() {
@@ -66,78 +93,86 @@ std::unique_ptr<const maliput::api::rules::RoadRulebook> RoadRuleBookBuilder::op
   maliput::ManualRulebook* rulebook_ptr = dynamic_cast<maliput::ManualRulebook*>(rulebook.get());
   MALIDRIVE_THROW_UNLESS(rulebook_ptr != nullptr);
 
-  AddsXODRBasedRulesToRulebook(rg_, rule_registry_, rulebook_ptr);
+  AddsXODRBasedRulesToRulebook(rg_, rule_registry_, rulebook_ptr, num_threads_);
 
   return rulebook;
 }
 
 LaneSRoute RoadRuleBookBuilder::CreateLaneSRouteFor(const Lane* lane) {
   MALIDRIVE_THROW_UNLESS(lane != nullptr);
-  return LaneSRoute({LaneSRange(lane->id(), SRange(0., lane->length()))});
+  return LaneSRoute({LaneSRange(lane->id(), SRange(0., lane->EstimateLength()))});
 }
 
 void RoadRuleBookBuilder::AddsXODRBasedRulesToRulebook(const maliput::api::RoadGeometry* rg,
                                                        const maliput::api::rules::RuleRegistry* rule_registry,
-                                                       maliput::ManualRulebook* rulebook) {
+                                                       maliput::ManualRulebook* rulebook, std::size_t num_threads) {
   MALIDRIVE_THROW_UNLESS(rg != nullptr);
   MALIDRIVE_THROW_UNLESS(rule_registry != nullptr);
   MALIDRIVE_THROW_UNLESS(rulebook != nullptr);
+  MALIDRIVE_THROW_UNLESS(num_threads > 0);
 
   // Discrete Value Rules
   // @{
   // Creates vehicle usage and vehicle exclusive rules for the entire RoadGeometry.
-  AddsVehicleExclusiveAndUsageRulesToRulebook(rg, rule_registry, rulebook);
+  AddsVehicleExclusiveAndUsageRulesToRulebook(rg, rule_registry, rulebook, num_threads);
   // Creates direction usage rules for the entire RoadGeometry.
-  AddsDirectionUsageRulesToRulebook(rg, rule_registry, rulebook);
+  AddsDirectionUsageRulesToRulebook(rg, rule_registry, rulebook, num_threads);
   // @}
 
   // Range Value Rules
   // @{
   // Creates speed limit rules for the entire RoadGeometry.
-  AddsSpeedLimitRulesToRulebook(rg, rule_registry, rulebook);
+  AddsSpeedLimitRulesToRulebook(rg, rule_registry, rulebook, num_threads);
   // @}
 }
 
 void RoadRuleBookBuilder::AddsVehicleExclusiveAndUsageRulesToRulebook(
     const maliput::api::RoadGeometry* rg, const maliput::api::rules::RuleRegistry* rule_registry,
-    maliput::ManualRulebook* rulebook) {
+    maliput::ManualRulebook* rulebook, std::size_t num_threads) {
   MALIDRIVE_DEMAND(rg != nullptr);
   MALIDRIVE_DEMAND(rule_registry != nullptr);
   MALIDRIVE_DEMAND(rulebook != nullptr);
   const int severity{Rule::State::kStrict};
 
-  for (const auto& lane_id_lane : rg->ById().GetLanes()) {
-    const Lane* lane = dynamic_cast<const Lane*>(lane_id_lane.second);
-    MALIDRIVE_THROW_UNLESS(lane != nullptr);
+  // Each task builds the rules of the Lanes of a Junction.
+  const auto build_rules_for_junction = [rg, rule_registry, severity](int junction_index) {
+    std::vector<DiscreteValueRule> built_rules;
+    for (const Lane* lane : GetLanesOf(rg->junction(junction_index))) {
+      const std::pair<std::string, std::optional<std::string>> vehicle_rule_values =
+          VehicleUsageAndExclusiveRuleStateValues(lane);
 
-    const std::pair<std::string, std::optional<std::string>> vehicle_rule_values =
-        VehicleUsageAndExclusiveRuleStateValues(lane);
+      const LaneSRoute lane_s_route = CreateLaneSRouteFor(lane);
+      Rule::RelatedRules related_rules;
+      if (vehicle_rule_values.second.has_value()) {
+        const Rule::Id rule_id(GetRuleIdFrom(rules::VehicleExclusiveRuleTypeId(), lane->id()));
+        built_rules.push_back(rule_registry->BuildDiscreteValueRule(
+            rule_id, rules::VehicleExclusiveRuleTypeId(), lane_s_route,
+            {DiscreteValueRule::DiscreteValue{
+                severity, {} /* related rules */, {} /* related_unique_ids */, vehicle_rule_values.second.value()}}));
 
-    const LaneSRoute lane_s_route = CreateLaneSRouteFor(lane);
-    Rule::RelatedRules related_rules;
-    if (vehicle_rule_values.second.has_value()) {
-      const Rule::Id rule_id(GetRuleIdFrom(rules::VehicleExclusiveRuleTypeId(), lane->id()));
-      rulebook->AddRule(rule_registry->BuildDiscreteValueRule(
-          rule_id, rules::VehicleExclusiveRuleTypeId(), lane_s_route,
-          {DiscreteValueRule::DiscreteValue{
-              severity, {} /* related rules */, {} /* related_unique_ids */, vehicle_rule_values.second.value()}}));
+        MALIDRIVE_VALIDATE(
+            related_rules.emplace(rules::VehicleExclusiveRuleTypeId().string(), std::vector<Rule::Id>{rule_id}).second,
+            maliput::common::assertion_error,
+            "Failed to fill related rules for vehicle exclusive rule at lane : " + lane->id().string());
+      }
 
-      MALIDRIVE_VALIDATE(
-          related_rules.emplace(rules::VehicleExclusiveRuleTypeId().string(), std::vector<Rule::Id>{rule_id}).second,
-          maliput::common::assertion_error,
-          "Failed to fill related rules for vehicle exclusive rule at lane : " + lane_id_lane.first.string());
+      built_rules.push_back(rule_registry->BuildDiscreteValueRule(
+          GetRuleIdFrom(rules::VehicleUsageRuleTypeId(), lane->id()), rules::VehicleUsageRuleTypeId(), lane_s_route,
+          {DiscreteValueRule::DiscreteValue{
+              severity, related_rules, {} /* related_unique_ids */, vehicle_rule_values.first}}));
     }
+    return built_rules;
+  };
 
-    rulebook->AddRule(rule_registry->BuildDiscreteValueRule(
-        GetRuleIdFrom(rules::VehicleUsageRuleTypeId(), lane->id()), rules::VehicleUsageRuleTypeId(), lane_s_route,
-        {DiscreteValueRule::DiscreteValue{
-            severity, related_rules, {} /* related_unique_ids */, vehicle_rule_values.first}}));
+  for (auto& rule :
+       ConcatenateTaskResults<DiscreteValueRule>(rg->num_junctions(), num_threads, build_rules_for_junction)) {
+    rulebook->AddRule(std::move(rule));
   }
 }
 
 void RoadRuleBookBuilder::AddsSpeedLimitRulesToRulebook(const maliput::api::RoadGeometry* rg,
                                                         const maliput::api::rules::RuleRegistry* rule_registry,
-                                                        maliput::ManualRulebook* rulebook) {
+                                                        maliput::ManualRulebook* rulebook, std::size_t num_threads) {
   MALIDRIVE_DEMAND(rg != nullptr);
   MALIDRIVE_DEMAND(rule_registry != nullptr);
   MALIDRIVE_DEMAND(rulebook != nullptr);
@@ -160,41 +195,60 @@ void RoadRuleBookBuilder::AddsSpeedLimitRulesToRulebook(const maliput::api::Road
     return result;
   };
 
-  for (const auto& lane_id_lane : rg->ById().GetLanes()) {
-    const Lane* lane = dynamic_cast<const Lane*>(lane_id_lane.second);
-    MALIDRIVE_THROW_UNLESS(lane != nullptr);
-
-    const auto max_speed_limits = GetMaxSpeedLimitFor(lane);
-    UniqueIntegerProvider speed_limit_indexer(0);
-    for (const auto& speed_limit : max_speed_limits) {
-      const Rule::Id rule_id = GetRuleIdFrom(maliput::SpeedLimitRuleTypeId(), lane->id(), speed_limit_indexer.new_id());
-      const std::optional<RangeValueRule::Range> range = range_from_max_speed_limit(speed_limit.max);
-      const LaneSRoute lane_s_route({LaneSRange(
-          lane->id(), SRange(lane->LaneSFromTrackS(speed_limit.s_start), lane->LaneSFromTrackS(speed_limit.s_end)))});
-      MALIDRIVE_VALIDATE(range.has_value(), maliput::common::assertion_error,
-                         "Failed to obtain speed limit rule range for lane : " + lane_id_lane.first.string());
-      rulebook->AddRule(
-          rule_registry->BuildRangeValueRule(rule_id, maliput::SpeedLimitRuleTypeId(), lane_s_route, {*range}));
+  // Each task builds the rules of the Lanes of a Junction.
+  const auto build_rules_for_junction = [rg, rule_registry, &range_from_max_speed_limit](int junction_index) {
+    std::vector<RangeValueRule> built_rules;
+    for (const Lane* lane : GetLanesOf(rg->junction(junction_index))) {
+      const auto max_speed_limits = GetMaxSpeedLimitFor(lane);
+      UniqueIntegerProvider speed_limit_indexer(0);
+      for (const auto& speed_limit : max_speed_limits) {
+        const Rule::Id rule_id =
+            GetRuleIdFrom(maliput::SpeedLimitRuleTypeId(), lane->id(), speed_limit_indexer.new_id());
+        const std::optional<RangeValueRule::Range> range = range_from_max_speed_limit(speed_limit.max);
+        const LaneSRoute lane_s_route(
+            {LaneSRange(lane->id(), SRange(lane->EstimateLaneSFromTrackS(speed_limit.s_start),
+                                           lane->EstimateLaneSFromTrackS(speed_limit.s_end)))});
+        MALIDRIVE_VALIDATE(range.has_value(), maliput::common::assertion_error,
+                           "Failed to obtain speed limit rule range for lane : " + lane->id().string());
+        built_rules.push_back(
+            rule_registry->BuildRangeValueRule(rule_id, maliput::SpeedLimitRuleTypeId(), lane_s_route, {*range}));
+      }
     }
+    return built_rules;
+  };
+
+  for (auto& rule :
+       ConcatenateTaskResults<RangeValueRule>(rg->num_junctions(), num_threads, build_rules_for_junction)) {
+    rulebook->AddRule(std::move(rule));
   }
 }
 
 void RoadRuleBookBuilder::AddsDirectionUsageRulesToRulebook(const maliput::api::RoadGeometry* rg,
                                                             const maliput::api::rules::RuleRegistry* rule_registry,
-                                                            maliput::ManualRulebook* rulebook) {
+                                                            maliput::ManualRulebook* rulebook,
+                                                            std::size_t num_threads) {
   MALIDRIVE_THROW_UNLESS(rg != nullptr);
   MALIDRIVE_THROW_UNLESS(rule_registry != nullptr);
   MALIDRIVE_THROW_UNLESS(rulebook != nullptr);
   const int severity{Rule::State::kStrict};
-  for (const auto& lane_id_lane : rg->ById().GetLanes()) {
+  // Each task builds the rules of the Lanes of a Junction.
+  const auto build_rules_for_junction = [rg, rule_registry, severity](int junction_index) {
     const Rule::RelatedRules empty_related_rules;
     const Rule::RelatedUniqueIds empty_related_unique_ids;
-    const Lane* lane = dynamic_cast<const Lane*>(lane_id_lane.second);
-    rulebook->AddRule(rule_registry->BuildDiscreteValueRule(
-        GetRuleIdFrom(maliput::DirectionUsageRuleTypeId(), lane->id()), maliput::DirectionUsageRuleTypeId(),
-        CreateLaneSRouteFor(lane),
-        {DiscreteValueRule::DiscreteValue{severity, empty_related_rules, empty_related_unique_ids,
-                                          GetDirectionUsageRuleStateType(lane)}}));
+    std::vector<DiscreteValueRule> built_rules;
+    for (const Lane* lane : GetLanesOf(rg->junction(junction_index))) {
+      built_rules.push_back(rule_registry->BuildDiscreteValueRule(
+          GetRuleIdFrom(maliput::DirectionUsageRuleTypeId(), lane->id()), maliput::DirectionUsageRuleTypeId(),
+          CreateLaneSRouteFor(lane),
+          {DiscreteValueRule::DiscreteValue{severity, empty_related_rules, empty_related_unique_ids,
+                                            GetDirectionUsageRuleStateType(lane)}}));
+    }
+    return built_rules;
+  };
+
+  for (auto& rule :
+       ConcatenateTaskResults<DiscreteValueRule>(rg->num_junctions(), num_threads, build_rules_for_junction)) {
+    rulebook->AddRule(std::move(rule));
   }
 }
 
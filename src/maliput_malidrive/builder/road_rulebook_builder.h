@@ -27,6 +27,7 @@
 // CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
@@ -72,19 +73,29 @@ class RoadRuleBookBuilder {
   /// - Speed-Limit Rule Type
   /// - Direction-Usage Rule Type
   ///
+  /// Rules of the Lanes of each Junction are built by an independent task and
+  /// added to `rulebook` in Junction order, regardless of `num_threads`.
+  ///
   /// See malidrive::builder::RuleRegistryBuilder for further information.
+  ///
+  /// @param num_threads is the number of threads to build the rules with. It
+  ///        must be positive.
+  /// @throw maliput::assertion_error When `num_threads` is zero.
   static void AddsXODRBasedRulesToRulebook(const maliput::api::RoadGeometry* rg,
                                            const maliput::api::rules::RuleRegistry* rule_registry,
-                                           maliput::ManualRulebook* rulebook);
+                                           maliput::ManualRulebook* rulebook, std::size_t num_threads = 1);
 
   /// Constructs a RoadRuleBook.
   ///
   /// @param rg is the pointer to the RoadGeometry. It must not be nullptr.
   /// @param rule_registry is the pointer to the RuleRegistry. It must not be nullptr.
   /// @param road_rulebook_file_path to the yaml file to load the RoadRulebook.
+  /// @param num_threads is the number of threads to build the XODR based rules
+  ///        with. It must be positive.
   /// @throw maliput::assertion_error When `rg` or `rule_registry` are nullptr.
+  /// @throw maliput::assertion_error When `num_threads` is zero.
   RoadRuleBookBuilder(const maliput::api::RoadGeometry* rg, const maliput::api::rules::RuleRegistry* rule_registry,
-                      const std::optional<std::string>& road_rulebook_file_path);
+                      const std::optional<std::string>& road_rulebook_file_path, std::size_t num_threads = 1);
 
   MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(RoadRuleBookBuilder)
   RoadRuleBookBuilder() = delete;
@@ -101,9 +112,10 @@ class RoadRuleBookBuilder {
   // @param rule_registry is the pointer to the RuleRegistry. It must not be nullptr.
   // @param rulebook The pointer to the RoadRulebook based to add the rules.
   //        It must not be nullptr.
+  // @param num_threads is the number of threads to build the rules with.
   static void AddsVehicleExclusiveAndUsageRulesToRulebook(const maliput::api::RoadGeometry* rg,
                                                           const maliput::api::rules::RuleRegistry* rule_registry,
-                                                          maliput::ManualRulebook* rulebook);
+                                                          maliput::ManualRulebook* rulebook, std::size_t num_threads);
 
   // Creates speed limit rules for all Lanes in the RoadGeometry.
   // Rule values have been previously registered in the
@@ -119,6 +131,7 @@ class RoadRuleBookBuilder {
   // @param rule_registry is the pointer to the RuleRegistry. It must not be nullptr.
   // @param rulebook The RoadRulebook to which to add the rules.
   //        It must not be nullptr.
+  // @param num_threads is the number of threads to build the rules with.
   //
   // @throws maliput::common::assertion_error When `rg` is nullptr.
   // @throws maliput::common::assertion_error When `rule_registry` is nullptr.
@@ -131,7 +144,7 @@ class RoadRuleBookBuilder {
   // maliput::SpeedLimitRuleTypeId() rule type.
   static void AddsSpeedLimitRulesToRulebook(const maliput::api::RoadGeometry* rg,
                                             const maliput::api::rules::RuleRegistry* rule_registry,
-                                            maliput::ManualRulebook* rulebook);
+                                            maliput::ManualRulebook* rulebook, std::size_t num_threads);
 
   // Creates direction usage rules for the entire RoadGeometry.
   // Direction Usage Rule Type must have been previously registered in the
@@ -142,11 +155,12 @@ class RoadRuleBookBuilder {
   // @param rule_registry is the pointer to the RuleRegistry. It must not be nullptr.
   // @param rulebook The RoadRulebook to add the rules.
   //        It must not be nullptr.
+  // @param num_threads is the number of threads to build the rules with.
   //
   // @throws maliput::common::assertion_error When `rulebook` is nullptr.
   static void AddsDirectionUsageRulesToRulebook(const maliput::api::RoadGeometry* rg,
                                                 const maliput::api::rules::RuleRegistry* rule_registry,
-                                                maliput::ManualRulebook* rulebook);
+                                                maliput::ManualRulebook* rulebook, std::size_t num_threads);
 
   // @returns A LaneSRoute that covers `lane.`
   // @throws maliput::common::assertion_error When `lane` is nullptr.
@@ -155,6 +169,7 @@ class RoadRuleBookBuilder {
   const maliput::api::RoadGeometry* rg_{};
   const maliput::api::rules::RuleRegistry* rule_registry_{};
   const std::optional<std::string> road_rulebook_file_path_{};
+  const std::size_t num_threads_{1};
 };
 
 }  // namespace builder
@@ -0,0 +1,276 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/builder/road_selection.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include <maliput/common/logger.h>
+
+#include "maliput_malidrive/common/macros.h"
+
+namespace malidrive {
+namespace builder {
+namespace {
+
+// Number of steps spiral geometries are sampled with to bound them.
+constexpr int kNumSpiralSteps{32};
+
+// Axis aligned box in the XODR frame.
+struct Box {
+  // Grows the box to contain `point`.
+  void Extend(const maliput::math::Vector2& point) {
+    min_corner = {std::min(min_corner.x(), point.x()), std::min(min_corner.y(), point.y())};
+    max_corner = {std::max(max_corner.x(), point.x()), std::max(max_corner.y(), point.y())};
+  }
+
+  maliput::math::Vector2 min_corner;
+  maliput::math::Vector2 max_corner;
+};
+
+// @returns The axis aligned bounding box of the reference line of `geometry`.
+Box GetGeometryBoundingBox(const xodr::Geometry& geometry) {
+  const maliput::math::Vector2& start = geometry.start_point;
+  Box box{start, start};
+  const auto extend_with_line = [&box, &start, &geometry]() {
+    box.Extend(start + geometry.length *
+                           maliput::math::Vector2(std::cos(geometry.orientation), std::sin(geometry.orientation)));
+  };
+  switch (geometry.type) {
+    case xodr::Geometry::Type::kLine:
+      extend_with_line();
+      break;
+    case xodr::Geometry::Type::kArc: {
+      const double curvature = std::get<xodr::Geometry::Arc>(geometry.description).curvature;
+      if (curvature == 0.) {
+        extend_with_line();
+        break;
+      }
+      const double radius = 1. / std::abs(curvature);
+      const maliput::math::Vector2 center =
+          start + maliput::math::Vector2(-std::sin(geometry.orientation), std::cos(geometry.orientation)) / curvature;
+      // Angles of the start and end points around the center.
+      const double theta_start = geometry.orientation - std::copysign(M_PI / 2., curvature);
+      const double theta_end = theta_start + curvature * geometry.length;
+      const auto point_at = [&center, radius](double theta) {
+        return center + radius * maliput::math::Vector2(std::cos(theta), std::sin(theta));
+      };
+      box.Extend(point_at(theta_end));
+      // The arc reaches its extreme x and y coordinates at the multiples of pi / 2 it sweeps.
+      const double theta_min = std::min(theta_start, theta_end);
+      const double theta_max = std::max(theta_start, theta_end);
+      if (theta_max - theta_min >= 2. * M_PI) {
+        box.Extend(center - maliput::math::Vector2(radius, radius));
+        box.Extend(center + maliput::math::Vector2(radius, radius));
+        break;
+      }
+      for (double k = std::ceil(theta_min / (M_PI / 2.)); k * M_PI / 2. <= theta_max; ++k) {
+        box.Extend(point_at(k * M_PI / 2.));
+      }
+      break;
+    }
+    case xodr::Geometry::Type::kSpiral: {
+      // Integrates the heading, which is quadratic in s, with the midpoint rule.
+      const xodr::Geometry::Spiral& spiral = std::get<xodr::Geometry::Spiral>(geometry.description);
+      const double step = geometry.length / kNumSpiralSteps;
+      const double curvature_dot = (spiral.curv_end - spiral.curv_start) / geometry.length;
+      maliput::math::Vector2 point = start;
+      for (int i = 0; i < kNumSpiralSteps; ++i) {
+        const double s = (i + 0.5) * step;
+        const double heading = geometry.orientation + spiral.curv_start * s + curvature_dot * s * s / 2.;
+        point = point + step * maliput::math::Vector2(std::cos(heading), std::sin(heading));
+        box.Extend(point);
+      }
+      // Points in between samples are within a step of them.
+      box.min_corner = box.min_corner - maliput::math::Vector2(step, step);
+      box.max_corner = box.max_corner + maliput::math::Vector2(step, step);
+      break;
+    }
+  }
+  return box;
+}
+
+}  // namespace
+
+RoadGraph BuildRoadGraph(const xodr::DBManager& manager) {
+  const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers = manager.GetRoadHeaders();
+  // Collects the connecting XODR Roads of each XODR Junction.
+  std::map<std::string, std::set<xodr::RoadHeader::Id>> junction_roads;
+  for (const auto& junction : manager.GetJunctions()) {
+    for (const auto& connection : junction.second.connections) {
+      junction_roads[junction.first.string()].insert(xodr::RoadHeader::Id(connection.second.connecting_road));
+    }
+  }
+
+  RoadGraph road_graph;
+  const auto connect = [&road_graph, &road_headers](const xodr::RoadHeader::Id& a, const xodr::RoadHeader::Id& b) {
+    if (a == b || road_headers.find(a) == road_headers.end() || road_headers.find(b) == road_headers.end()) {
+      return;
+    }
+    road_graph[a].insert(b);
+    road_graph[b].insert(a);
+  };
+  const auto connect_link = [&connect, &junction_roads](const xodr::RoadHeader::Id& road_id,
+                                                          const std::optional<xodr::RoadLink::LinkAttributes>& link) {
+    if (!link.has_value()) {
+      return;
+    }
+    if (link->element_type == xodr::RoadLink::ElementType::kRoad) {
+      connect(road_id, xodr::RoadHeader::Id(link->element_id.string()));
+    } else {
+      const auto junction_roads_it = junction_roads.find(link->element_id.string());
+      if (junction_roads_it != junction_roads.end()) {
+        for (const auto& junction_road_id : junction_roads_it->second) {
+          connect(road_id, junction_road_id);
+        }
+      }
+    }
+  };
+  for (const auto& road_header : road_headers) {
+    road_graph[road_header.first];
+    connect_link(road_header.first, road_header.second.road_link.predecessor);
+    connect_link(road_header.first, road_header.second.road_link.successor);
+    if (road_header.second.junction != "-1") {
+      const auto junction_roads_it = junction_roads.find(road_header.second.junction);
+      if (junction_roads_it != junction_roads.end()) {
+        for (const auto& junction_road_id : junction_roads_it->second) {
+          connect(road_header.first, junction_road_id);
+        }
+      }
+    }
+  }
+  return road_graph;
+}
+
+bool IsRoadInRegion(const xodr::RoadHeader& road_header, const maliput::math::Vector2& min_corner,
+                    const maliput::math::Vector2& max_corner,
+                    const maliput::math::Vector3& inertial_to_backend_frame_translation) {
+  const maliput::math::Vector2 translation{inertial_to_backend_frame_translation.x(),
+                                           inertial_to_backend_frame_translation.y()};
+  const auto& geometries = road_header.reference_geometry.plan_view.geometries;
+  return std::any_of(geometries.begin(), geometries.end(), [&](const xodr::Geometry& geometry) {
+    const Box box = GetGeometryBoundingBox(geometry);
+    const maliput::math::Vector2 box_min_corner = box.min_corner + translation;
+    const maliput::math::Vector2 box_max_corner = box.max_corner + translation;
+    return box_min_corner.x() <= max_corner.x() && box_max_corner.x() >= min_corner.x() &&
+           box_min_corner.y() <= max_corner.y() && box_max_corner.y() >= min_corner.y();
+  });
+}
+
+std::set<xodr::RoadHeader::Id> GetRoadsInBuildRegion(
+    const xodr::DBManager& manager, const BuildRegion& build_region,
+    const maliput::math::Vector3& inertial_to_backend_frame_translation) {
+  MALIDRIVE_VALIDATE(build_region.topological_radius >= 0, maliput::common::assertion_error,
+                     "BuildRegion's topological_radius must be non-negative: " +
+                         std::to_string(build_region.topological_radius));
+  const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& road_headers = manager.GetRoadHeaders();
+
+  std::set<xodr::RoadHeader::Id> road_ids;
+  for (const auto& road_id : build_region.road_ids) {
+    const xodr::RoadHeader::Id xodr_road_id(road_id);
+    if (road_headers.find(xodr_road_id) != road_headers.end()) {
+      road_ids.insert(xodr_road_id);
+    } else {
+      maliput::log()->warn("Build region's XODR Road ID: ", road_id, " is not in the XODR description.");
+    }
+  }
+  if (build_region.bounding_box.has_value()) {
+    for (const auto& road_header : road_headers) {
+      if (IsRoadInRegion(road_header.second, build_region.bounding_box->min_corner,
+                         build_region.bounding_box->max_corner, inertial_to_backend_frame_translation)) {
+        road_ids.insert(road_header.first);
+      }
+    }
+  }
+
+  if (build_region.topological_radius > 0) {
+    const RoadGraph road_graph = BuildRoadGraph(manager);
+    std::set<xodr::RoadHeader::Id> frontier = road_ids;
+    for (int i = 0; i < build_region.topological_radius && !frontier.empty(); ++i) {
+      std::set<xodr::RoadHeader::Id> next_frontier;
+      for (const auto& road_id : frontier) {
+        for (const auto& neighbour : road_graph.at(road_id)) {
+          if (road_ids.insert(neighbour).second) {
+            next_frontier.insert(neighbour);
+          }
+        }
+      }
+      frontier = std::move(next_frontier);
+    }
+  }
+
+  // Junction closure: a XODR Junction is either fully built or not built at all.
+  std::set<std::string> junction_ids;
+  for (const auto& road_id : road_ids) {
+    const std::string& junction_id = road_headers.at(road_id).junction;
+    if (junction_id != "-1") {
+      junction_ids.insert(junction_id);
+    }
+  }
+  for (const auto& road_header : road_headers) {
+    if (junction_ids.find(road_header.second.junction) != junction_ids.end()) {
+      road_ids.insert(road_header.first);
+    }
+  }
+  maliput::log()->trace("Build region selects ", road_ids.size(), " of ", road_headers.size(), " XODR Roads.");
+  return road_ids;
+}
+
+RoadDiff DiffRoads(const xodr::DBManager& previous, const xodr::DBManager& current) {
+  const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& previous_road_headers = previous.GetRoadHeaders();
+  const std::map<xodr::RoadHeader::Id, xodr::RoadHeader>& current_road_headers = current.GetRoadHeaders();
+  RoadDiff road_diff;
+  for (const auto& road_header : current_road_headers) {
+    const auto previous_it = previous_road_headers.find(road_header.first);
+    if (previous_it == previous_road_headers.end()) {
+      road_diff.added.insert(road_header.first);
+    } else if (previous_it->second == road_header.second) {
+      road_diff.unchanged.insert(road_header.first);
+    } else {
+      road_diff.changed.insert(road_header.first);
+    }
+  }
+  for (const auto& road_header : previous_road_headers) {
+    if (current_road_headers.find(road_header.first) == current_road_headers.end()) {
+      road_diff.removed.insert(road_header.first);
+    }
+  }
+  maliput::log()->trace("XODR Roads diff: ", road_diff.added.size(), " added, ", road_diff.removed.size(),
+                        " removed, ", road_diff.changed.size(), " changed, ", road_diff.unchanged.size(),
+                        " unchanged.");
+  return road_diff;
+}
+
+}  // namespace builder
+}  // namespace malidrive
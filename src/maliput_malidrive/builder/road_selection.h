@@ -0,0 +1,111 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <map>
+#include <set>
+
+#include <maliput/math/vector.h>
+
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/xodr/db_manager.h"
+#include "maliput_malidrive/xodr/road_header.h"
+
+namespace malidrive {
+namespace builder {
+
+/// Adjacency between XODR Roads. XODR Roads linked through a predecessor /
+/// successor are neighbours, as well as a XODR Road linked to a XODR Junction
+/// and the connecting XODR Roads of that XODR Junction, and the connecting
+/// XODR Roads of the same XODR Junction.
+using RoadGraph = std::map<xodr::RoadHeader::Id, std::set<xodr::RoadHeader::Id>>;
+
+/// Builds the RoadGraph of the XODR Roads in `manager`.
+///
+/// @param manager Holds the XODR description.
+/// @returns The RoadGraph. All the XODR Roads of `manager` are keys of it.
+RoadGraph BuildRoadGraph(const xodr::DBManager& manager);
+
+/// Determines whether `road_header` overlaps an axis aligned box.
+///
+/// The axis aligned bounding box of each plan view geometry is tested against
+/// the box. Line and arc geometries are bounded analytically, spiral ones are
+/// sampled and padded by the sampling step. The lateral extent of the XODR
+/// Lanes is not accounted for: only the reference line is bounded.
+///
+/// @param road_header The XODR Road.
+/// @param min_corner Minimum corner of the box in the Inertial Frame.
+/// @param max_corner Maximum corner of the box in the Inertial Frame.
+/// @param inertial_to_backend_frame_translation Translation from the Inertial
+///        Frame to the XODR frame.
+/// @returns True when the bounding box of any plan view geometry of
+///          `road_header` overlaps the box.
+bool IsRoadInRegion(const xodr::RoadHeader& road_header, const maliput::math::Vector2& min_corner,
+                    const maliput::math::Vector2& max_corner,
+                    const maliput::math::Vector3& inertial_to_backend_frame_translation);
+
+/// Selects the XODR Roads of `manager` within `build_region`. See BuildRegion
+/// for the selection criteria.
+///
+/// @param manager Holds the XODR description.
+/// @param build_region The region to select. Unknown XODR Road IDs are ignored.
+/// @param inertial_to_backend_frame_translation Translation from the Inertial
+///        Frame to the XODR frame, used to evaluate `build_region.bounding_box`.
+/// @returns The IDs of the selected XODR Roads.
+/// @throws maliput::common::assertion_error When `build_region.topological_radius`
+///         is negative.
+std::set<xodr::RoadHeader::Id> GetRoadsInBuildRegion(
+    const xodr::DBManager& manager, const BuildRegion& build_region,
+    const maliput::math::Vector3& inertial_to_backend_frame_translation);
+
+/// Differences between the XODR Roads of two XODR descriptions.
+struct RoadDiff {
+  /// XODR Roads that are only in the current description.
+  std::set<xodr::RoadHeader::Id> added;
+  /// XODR Roads that are only in the previous description.
+  std::set<xodr::RoadHeader::Id> removed;
+  /// XODR Roads in both descriptions whose xodr::RoadHeaders differ.
+  std::set<xodr::RoadHeader::Id> changed;
+  /// XODR Roads in both descriptions whose xodr::RoadHeaders are equal.
+  std::set<xodr::RoadHeader::Id> unchanged;
+};
+
+/// Compares the XODR Roads of `previous` and `current` by xodr::RoadHeader
+/// equality. Geometry built out of an unchanged XODR Road of `previous` can be
+/// reused for `current`, while its connectivity, e.g. BranchPoints, may still
+/// differ because of the changed XODR Roads and XODR Junctions.
+///
+/// @param previous Holds the previous XODR description.
+/// @param current Holds the current XODR description.
+/// @returns The RoadDiff from `previous` to `current`.
+RoadDiff DiffRoads(const xodr::DBManager& previous, const xodr::DBManager& current);
+
+}  // namespace builder
+}  // namespace malidrive
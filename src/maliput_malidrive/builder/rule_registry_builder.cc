@@ -48,18 +48,27 @@ RuleRegistryBuilder::RuleRegistryBuilder(const maliput::api::RoadGeometry* rg,
 }
 
 std::unique_ptr<maliput::api::rules::RuleRegistry> RuleRegistryBuilder::operator()() {
-  maliput::log()->trace(rule_registry_file_path_.has_value()
-                            ? "RuleRegistry file provided: " + rule_registry_file_path_.value()
-                            : "No RuleRegistry file provided");
-  auto rule_registry = !rule_registry_file_path_.has_value()
-                           ? std::make_unique<maliput::api::rules::RuleRegistry>()
-                           : maliput::LoadRuleRegistryFromFile(rule_registry_file_path_.value());
+  return (*this)(LoadRuleRegistry(rule_registry_file_path_));
+}
+
+std::unique_ptr<maliput::api::rules::RuleRegistry> RuleRegistryBuilder::operator()(
+    std::unique_ptr<maliput::api::rules::RuleRegistry> rule_registry) {
+  MALIDRIVE_THROW_UNLESS(rule_registry != nullptr);
   AddDiscreteValueRuleTypes(rule_registry.get());
   AddSpeedLimitRuleType(rule_registry.get());
 
   return rule_registry;
 }
 
+std::unique_ptr<maliput::api::rules::RuleRegistry> RuleRegistryBuilder::LoadRuleRegistry(
+    const std::optional<std::string>& rule_registry_file_path) {
+  maliput::log()->trace(rule_registry_file_path.has_value()
+                            ? "RuleRegistry file provided: " + rule_registry_file_path.value()
+                            : "No RuleRegistry file provided");
+  return !rule_registry_file_path.has_value() ? std::make_unique<maliput::api::rules::RuleRegistry>()
+                                              : maliput::LoadRuleRegistryFromFile(rule_registry_file_path.value());
+}
+
 void RuleRegistryBuilder::AddDiscreteValueRuleTypes(maliput::api::rules::RuleRegistry* rule_registry) const {
   MALIDRIVE_THROW_UNLESS(rule_registry != nullptr);
 
@@ -28,6 +28,8 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
+#include <optional>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -67,6 +69,27 @@ class RuleRegistryBuilder {
   ///      - @see maliput::SpeedLimitRuleTypeId().
   std::unique_ptr<maliput::api::rules::RuleRegistry> operator()();
 
+  /// Builds a maliput::api::rules::RuleRegistry out of `rule_registry`, which
+  /// already holds the rule types of the YAML file, i.e. it only runs the
+  /// second step of operator()(). The rule registry file path provided at
+  /// construction is ignored.
+  ///
+  /// @param rule_registry The maliput::api::rules::RuleRegistry to complete.
+  ///        It must not be nullptr. See LoadRuleRegistry().
+  /// @throws maliput::common::assertion_error When `rule_registry` is nullptr.
+  std::unique_ptr<maliput::api::rules::RuleRegistry> operator()(
+      std::unique_ptr<maliput::api::rules::RuleRegistry> rule_registry);
+
+  /// Loads a maliput::api::rules::RuleRegistry with the rule types of a YAML
+  /// file. It does not need a RoadGeometry, so it may run while the
+  /// RoadGeometry is built.
+  ///
+  /// @param rule_registry_file_path YAML file path for loading the
+  ///        maliput::api::rules::RuleRegistry. When it is std::nullopt, an
+  ///        empty maliput::api::rules::RuleRegistry is returned.
+  static std::unique_ptr<maliput::api::rules::RuleRegistry> LoadRuleRegistry(
+      const std::optional<std::string>& rule_registry_file_path);
+
  private:
   // The following two methods are temporary and should be removed once
   // DiscreteValueRule types are loaded via a YAML loader.
@@ -47,20 +47,25 @@ using maliput::api::rules::SpeedLimitRule;
 
 std::vector<SpeedLimitRule> SpeedLimitBuilder::operator()() {
   maliput::log()->trace("Building SpeedLimitRules...");
-  std::vector<SpeedLimitRule> speed_limits;
-  for (int i = 0; i < rg_->num_junctions(); ++i) {
-    const maliput::api::Junction* junction = rg_->junction(i);
+  // Each task builds the rules of the Lanes of a Junction.
+  const auto build_speed_limits_for_junction = [this](int junction_index) {
+    const maliput::api::Junction* junction = rg_->junction(junction_index);
+    std::vector<SpeedLimitRule> junction_speed_limits;
     for (int j = 0; j < junction->num_segments(); ++j) {
       const std::vector<SpeedLimitRule> segment_speed_limits = BuildSpeedLimitFor(junction->segment(j));
-      speed_limits.insert(speed_limits.end(), segment_speed_limits.begin(), segment_speed_limits.end());
+      junction_speed_limits.insert(junction_speed_limits.end(), segment_speed_limits.begin(),
+                                   segment_speed_limits.end());
     }
-  }
+    return junction_speed_limits;
+  };
+  std::vector<SpeedLimitRule> speed_limits =
+      ConcatenateTaskResults<SpeedLimitRule>(rg_->num_junctions(), num_threads_, build_speed_limits_for_junction);
   maliput::log()->trace("All SpeedLimitRules are built.");
   return speed_limits;
 }
 
 std::vector<maliput::api::rules::SpeedLimitRule> SpeedLimitBuilder::BuildSpeedLimitFor(
-    const maliput::api::Segment* segment) {
+    const maliput::api::Segment* segment) const {
   MALIDRIVE_THROW_UNLESS(segment != nullptr);
 
   const double kDefaultMinSpeedLimit{constants::kDefaultMinSpeedLimit};
@@ -72,8 +77,8 @@ std::vector<maliput::api::rules::SpeedLimitRule> SpeedLimitBuilder::BuildSpeedLi
     const auto max_speed_limits = GetMaxSpeedLimitFor(lane);
     UniqueIntegerProvider speed_limit_indexer(0);
     for (const auto& speed_limit : max_speed_limits) {
-      const double s0{lane->LaneSFromTrackS(speed_limit.s_start)};
-      const double s1{lane->LaneSFromTrackS(speed_limit.s_end)};
+      const double s0{lane->EstimateLaneSFromTrackS(speed_limit.s_start)};
+      const double s1{lane->EstimateLaneSFromTrackS(speed_limit.s_end)};
       const LaneSRange lane_s_range(lane->id(), SRange(s0, s1));
       const SpeedLimitRule speed_limit_rule(GetSpeedLimitId(lane->id(), speed_limit_indexer.new_id()), lane_s_range,
                                             kDefaultSeverity, kDefaultMinSpeedLimit, speed_limit.max);
@@ -29,6 +29,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 #include <maliput/api/road_geometry.h>
@@ -53,11 +54,22 @@ class SpeedLimitBuilder {
   /// Constructs a SpeedLimitBuilder.
   ///
   /// @param rg is the RoadGeometry pointer. It must not be nullptr.
-  SpeedLimitBuilder(const maliput::api::RoadGeometry* rg) : rg_(rg) { MALIDRIVE_THROW_UNLESS(rg_ != nullptr); }
+  /// @param num_threads is the number of threads to build the rules with. It
+  ///        must be positive.
+  /// @throws maliput::common::assertion_error When `rg` is nullptr or
+  ///         `num_threads` is zero.
+  SpeedLimitBuilder(const maliput::api::RoadGeometry* rg, std::size_t num_threads = 1)
+      : rg_(rg), num_threads_(num_threads) {
+    MALIDRIVE_THROW_UNLESS(rg_ != nullptr);
+    MALIDRIVE_THROW_UNLESS(num_threads_ > 0);
+  }
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
   /// Builds a vector of SpeedLimitRules for each Lane in rg.
+  ///
+  /// Rules of each Junction are built by an independent task and returned in
+  /// Junction order, regardless of the number of threads.
   std::vector<maliput::api::rules::SpeedLimitRule> operator()();
 #pragma GCC diagnostic pop
 
@@ -73,10 +85,11 @@ class SpeedLimitBuilder {
   // information about it in the map.
   //
   // @pre `segment` must not be nullptr.
-  std::vector<maliput::api::rules::SpeedLimitRule> BuildSpeedLimitFor(const maliput::api::Segment* segment);
+  std::vector<maliput::api::rules::SpeedLimitRule> BuildSpeedLimitFor(const maliput::api::Segment* segment) const;
 #pragma GCC diagnostic pop
 
   const maliput::api::RoadGeometry* rg_{};
+  const std::size_t num_threads_{1};
 };
 
 }  // namespace builder
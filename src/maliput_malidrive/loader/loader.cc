@@ -43,5 +43,8 @@ namespace loader {
 template std::unique_ptr<maliput::api::RoadNetwork> Load<builder::RoadNetworkBuilder>(
     const std::map<std::string, std::string>& road_network_configuration);
 
+template std::future<std::unique_ptr<maliput::api::RoadNetwork>> LoadAsync<builder::RoadNetworkBuilder>(
+    const std::map<std::string, std::string>& road_network_configuration, const builder::BuildControl& build_control);
+
 }  // namespace loader
 }  // namespace malidrive
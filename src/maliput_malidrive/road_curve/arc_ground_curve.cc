@@ -29,6 +29,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/road_curve/arc_ground_curve.h"
 
+#include <algorithm>
+
 #include <maliput/math/saturate.h>
 
 namespace malidrive {
@@ -85,6 +87,59 @@ double saturate_on_wrapped_bounds(double theta, double theta_min, double theta_m
 
 }  // namespace
 
+void ArcGroundCurve::DoThetaBatch(const std::vector<double>& p, std::vector<double>* thetas) const {
+  // Saturation may throw, so it is done in a first pass that keeps the
+  // evaluation loop free of branches.
+  double* theta = thetas->data();
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    theta[i] = validate_p_(p[i]);
+  }
+  const double heading_dot = d_theta_ / (p1_ - p0_);
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    theta[i] = theta0_ + (theta[i] - p0_) * heading_dot;
+  }
+}
+
+void ArcGroundCurve::DoGBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const {
+  DoThetaBatch(p, x);
+  const double abs_radius = std::abs(radius_);
+  double* x_data = x->data();
+  double* y_data = y->data();
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    const double theta = x_data[i];
+    x_data[i] = center_.x() + abs_radius * std::cos(theta);
+    y_data[i] = center_.y() + abs_radius * std::sin(theta);
+  }
+}
+
+void ArcGroundCurve::DoGDotBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const {
+  DoThetaBatch(p, x);
+  const double speed = std::copysign(arc_length_ / (p1_ - p0_), d_theta_);
+  double* x_data = x->data();
+  double* y_data = y->data();
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    const double theta = x_data[i];
+    x_data[i] = -speed * std::sin(theta);
+    y_data[i] = speed * std::cos(theta);
+  }
+}
+
+void ArcGroundCurve::DoHeadingBatch(const std::vector<double>& p, std::vector<double>* headings) const {
+  DoThetaBatch(p, headings);
+  const double heading_offset = std::copysign(M_PI / 2., d_theta_);
+  double* heading = headings->data();
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    heading[i] += heading_offset;
+  }
+}
+
+void ArcGroundCurve::DoHeadingDotBatch(const std::vector<double>& p, std::vector<double>* heading_dots) const {
+  for (const double p_i : p) {
+    validate_p_(p_i);
+  }
+  std::fill(heading_dots->begin(), heading_dots->end(), d_theta_ / (p1_ - p0_));
+}
+
 double ArcGroundCurve::DoGInverse(const maliput::math::Vector2& xy) const {
   // displacement vector from center of arc to xy
   const maliput::math::Vector2 center_to_xy = xy - center_;
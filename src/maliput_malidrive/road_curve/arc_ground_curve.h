@@ -30,6 +30,7 @@
 #pragma once
 
 #include <cmath>
+#include <vector>
 
 #include <maliput/common/range_validator.h>
 
@@ -119,6 +120,15 @@ class ArcGroundCurve : public GroundCurve {
 
   double DoGInverse(const maliput::math::Vector2&) const override;
 
+  void DoGBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const override;
+  void DoGDotBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const override;
+  void DoHeadingBatch(const std::vector<double>& p, std::vector<double>* headings) const override;
+  void DoHeadingDotBatch(const std::vector<double>& p, std::vector<double>* heading_dots) const override;
+
+  // Fills `thetas` with DoTheta() of each element of `p`. `thetas` must have
+  // the same size as `p`.
+  void DoThetaBatch(const std::vector<double>& p, std::vector<double>* thetas) const;
+
   double DoHeading(double p) const override {
     p = validate_p_(p);
     return DoTheta(p) + std::copysign(M_PI / 2., d_theta_);
@@ -29,6 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 #include <maliput/common/range_validator.h>
 
 #include "maliput_malidrive/common/macros.h"
@@ -96,6 +99,38 @@ class CubicPolynomial : public Function {
     return 6. * a_ * p + 2 * b_;
   }
 
+  // Saturation may throw, so it is done in a first pass that keeps the
+  // polynomial evaluation loop free of branches.
+  void do_f_batch(const std::vector<double>& p, std::vector<double>* images) const override {
+    double* f = images->data();
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      f[i] = validate_p_(p[i]);
+    }
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      f[i] = ((a_ * f[i] + b_) * f[i] + c_) * f[i] + d_;
+    }
+  }
+
+  void do_f_dot_batch(const std::vector<double>& p, std::vector<double>* images) const override {
+    double* f_dot = images->data();
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      f_dot[i] = validate_p_(p[i]);
+    }
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      f_dot[i] = (3. * a_ * f_dot[i] + 2. * b_) * f_dot[i] + c_;
+    }
+  }
+
+  void do_f_dot_dot_batch(const std::vector<double>& p, std::vector<double>* images) const override {
+    double* f_dot_dot = images->data();
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      f_dot_dot[i] = validate_p_(p[i]);
+    }
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      f_dot_dot[i] = 6. * a_ * f_dot_dot[i] + 2. * b_;
+    }
+  }
+
   double do_p0() const override { return p0_; }
   double do_p1() const override { return p1_; }
   bool DoIsG1Contiguous() const override { return true; }
@@ -29,6 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 #include "maliput_malidrive/common/macros.h"
 
 namespace malidrive {
@@ -84,6 +87,45 @@ class Function {
   /// @return The image of @f$ F''(p) @f$.
   double f_dot_dot(double p) const { return do_f_dot_dot(p); }
 
+  /// Evaluates @f$ F(p) @f$ for each element of @p p.
+  ///
+  /// @param p The parameters. They must be in the range @f$ [`p0()`; `p1()`] @f$.
+  /// @param images The images of @f$ F(p) @f$. It is resized to `p.size()`.
+  /// @throws maliput::common::assertion_error When @p images is nullptr.
+  /// @throws maliput::common::assertion_error When any of @p p is not in
+  ///         @f$ [`p0()`; `p1()`] @f$.
+  void f(const std::vector<double>& p, std::vector<double>* images) const {
+    MALIDRIVE_THROW_UNLESS(images != nullptr);
+    images->resize(p.size());
+    do_f_batch(p, images);
+  }
+
+  /// Evaluates @f$ F'(p) @f$ for each element of @p p.
+  ///
+  /// @param p The parameters. They must be in the range @f$ [`p0()`; `p1()`] @f$.
+  /// @param images The images of @f$ F'(p) @f$. It is resized to `p.size()`.
+  /// @throws maliput::common::assertion_error When @p images is nullptr.
+  /// @throws maliput::common::assertion_error When any of @p p is not in
+  ///         @f$ [`p0()`; `p1()`] @f$.
+  void f_dot(const std::vector<double>& p, std::vector<double>* images) const {
+    MALIDRIVE_THROW_UNLESS(images != nullptr);
+    images->resize(p.size());
+    do_f_dot_batch(p, images);
+  }
+
+  /// Evaluates @f$ F''(p) @f$ for each element of @p p.
+  ///
+  /// @param p The parameters. They must be in the range @f$ [`p0()`; `p1()`] @f$.
+  /// @param images The images of @f$ F''(p) @f$. It is resized to `p.size()`.
+  /// @throws maliput::common::assertion_error When @p images is nullptr.
+  /// @throws maliput::common::assertion_error When any of @p p is not in
+  ///         @f$ [`p0()`; `p1()`] @f$.
+  void f_dot_dot(const std::vector<double>& p, std::vector<double>* images) const {
+    MALIDRIVE_THROW_UNLESS(images != nullptr);
+    images->resize(p.size());
+    do_f_dot_dot_batch(p, images);
+  }
+
   /// @returns The lower bound range of @f$ p @f$.
   double p0() const { return do_p0(); }
 
@@ -107,6 +149,27 @@ class Function {
   virtual double do_p1() const = 0;
   virtual bool DoIsG1Contiguous() const = 0;
   //@}
+
+  // Batched versions of do_f(), do_f_dot() and do_f_dot_dot(). `images` has
+  // the same size as `p`. Implementations with a closed form should override them with a loop
+  // the compiler can vectorize; by default they evaluate one p at a time.
+  //@{
+  virtual void do_f_batch(const std::vector<double>& p, std::vector<double>* images) const {
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      (*images)[i] = do_f(p[i]);
+    }
+  }
+  virtual void do_f_dot_batch(const std::vector<double>& p, std::vector<double>* images) const {
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      (*images)[i] = do_f_dot(p[i]);
+    }
+  }
+  virtual void do_f_dot_dot_batch(const std::vector<double>& p, std::vector<double>* images) const {
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      (*images)[i] = do_f_dot_dot(p[i]);
+    }
+  }
+  //@}
 };
 
 }  // namespace road_curve
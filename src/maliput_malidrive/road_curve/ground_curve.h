@@ -29,6 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 #include <maliput/math/vector.h>
 
 #include "maliput_malidrive/common/macros.h"
@@ -103,6 +106,69 @@ class GroundCurve {
   /// @return The derivative of the heading of @f$ G(p) @f$ at @p p.
   double HeadingDot(double p) const { return DoHeadingDot(p); }
 
+  /// Evaluates @f$ G(p) @f$ for each element of @p p.
+  ///
+  /// @param p The parameters. They must be in the range @f$ [`p0()`; `p1()`] @f$.
+  /// @param x The x coordinates of the images of @f$ G(p) @f$. It is resized
+  ///        to `p.size()`.
+  /// @param y The y coordinates of the images of @f$ G(p) @f$. It is resized
+  ///        to `p.size()`.
+  /// @throws maliput::common::assertion_error When @p x or @p y are nullptr.
+  /// @throws maliput::common::assertion_error When any of @p p is not in
+  ///         @f$ [`p0()`; `p1()`] @f$.
+  void G(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const {
+    MALIDRIVE_THROW_UNLESS(x != nullptr);
+    MALIDRIVE_THROW_UNLESS(y != nullptr);
+    x->resize(p.size());
+    y->resize(p.size());
+    DoGBatch(p, x, y);
+  }
+
+  /// Evaluates @f$ G'(p) @f$ for each element of @p p.
+  ///
+  /// @param p The parameters. They must be in the range @f$ [`p0()`; `p1()`] @f$.
+  /// @param x The x coordinates of the images of @f$ G'(p) @f$. It is resized
+  ///        to `p.size()`.
+  /// @param y The y coordinates of the images of @f$ G'(p) @f$. It is resized
+  ///        to `p.size()`.
+  /// @throws maliput::common::assertion_error When @p x or @p y are nullptr.
+  /// @throws maliput::common::assertion_error When any of @p p is not in
+  ///         @f$ [`p0()`; `p1()`] @f$.
+  void GDot(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const {
+    MALIDRIVE_THROW_UNLESS(x != nullptr);
+    MALIDRIVE_THROW_UNLESS(y != nullptr);
+    x->resize(p.size());
+    y->resize(p.size());
+    DoGDotBatch(p, x, y);
+  }
+
+  /// Evaluates @f$ θ(p) @f$ for each element of @p p.
+  ///
+  /// @param p The parameters. They must be in the range @f$ [`p0()`; `p1()`] @f$.
+  /// @param headings The headings of @f$ G(p) @f$. It is resized to `p.size()`.
+  /// @throws maliput::common::assertion_error When @p headings is nullptr.
+  /// @throws maliput::common::assertion_error When any of @p p is not in
+  ///         @f$ [`p0()`; `p1()`] @f$.
+  void Heading(const std::vector<double>& p, std::vector<double>* headings) const {
+    MALIDRIVE_THROW_UNLESS(headings != nullptr);
+    headings->resize(p.size());
+    DoHeadingBatch(p, headings);
+  }
+
+  /// Evaluates @f$ θ'(p) @f$ for each element of @p p.
+  ///
+  /// @param p The parameters. They must be in the range @f$ [`p0()`; `p1()`] @f$.
+  /// @param heading_dots The derivatives of the heading of @f$ G(p) @f$. It is
+  ///        resized to `p.size()`.
+  /// @throws maliput::common::assertion_error When @p heading_dots is nullptr.
+  /// @throws maliput::common::assertion_error When any of @p p is not in
+  ///         @f$ [`p0()`; `p1()`] @f$.
+  void HeadingDot(const std::vector<double>& p, std::vector<double>* heading_dots) const {
+    MALIDRIVE_THROW_UNLESS(heading_dots != nullptr);
+    heading_dots->resize(p.size());
+    DoHeadingDotBatch(p, heading_dots);
+  }
+
   /// Evaluates @f$ G⁻¹(x, y) @f$.
   ///
   /// @param xy A point in ℝ² that is used as a point in the domain of
@@ -130,6 +196,12 @@ class GroundCurve {
   ///         @f$ [`p0()`; `p1()`] @f$.
   bool IsG1Contiguous() const { return DoIsG1Contiguous(); }
 
+  /// @return The @f$ p @f$ values, in increasing order and within
+  ///         @f$ (`p0()`; `p1()`) @f$, where the underlying geometry of the
+  ///         curve changes. Curves described by a single geometry return an
+  ///         empty vector.
+  std::vector<double> Breakpoints() const { return DoBreakpoints(); }
+
  protected:
   GroundCurve() = default;
 
@@ -149,6 +221,40 @@ class GroundCurve {
   virtual double do_p1() const = 0;
   virtual bool DoIsG1Contiguous() const = 0;
   //@}
+
+  // Single geometry curves have no breakpoints.
+  virtual std::vector<double> DoBreakpoints() const { return {}; }
+
+  // Batched versions of DoG(), DoGDot(), DoHeading() and DoHeadingDot().
+  // Outputs have the same size as `p`. Implementations with a closed form
+  // should override them with a loop the compiler can vectorize; by default
+  // they evaluate one p at a time.
+  //@{
+  virtual void DoGBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const {
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      const maliput::math::Vector2 g = DoG(p[i]);
+      (*x)[i] = g.x();
+      (*y)[i] = g.y();
+    }
+  }
+  virtual void DoGDotBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const {
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      const maliput::math::Vector2 g_dot = DoGDot(p[i]);
+      (*x)[i] = g_dot.x();
+      (*y)[i] = g_dot.y();
+    }
+  }
+  virtual void DoHeadingBatch(const std::vector<double>& p, std::vector<double>* headings) const {
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      (*headings)[i] = DoHeading(p[i]);
+    }
+  }
+  virtual void DoHeadingDotBatch(const std::vector<double>& p, std::vector<double>* heading_dots) const {
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      (*heading_dots)[i] = DoHeadingDot(p[i]);
+    }
+  }
+  //@}
 };
 
 }  // namespace road_curve
@@ -0,0 +1,314 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/road_curve/joint_road_curve_offset.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <iterator>
+#include <utility>
+
+#include <maliput/common/logger.h>
+#include <maliput/math/saturate.h>
+#include <maliput/math/vector.h>
+
+namespace malidrive {
+namespace road_curve {
+namespace {
+
+// Evaluates at `x` the cubic Hermite interpolant that matches `y0` and `d0`
+// as value and derivative at `x0`, and `y1` and `d1` at `x1`.
+double EvalHermite(double x0, double x1, double y0, double y1, double d0, double d1, double x) {
+  const double h = x1 - x0;
+  const double t = (x - x0) / h;
+  const double t2 = t * t;
+  const double t3 = t2 * t;
+  return (2. * t3 - 3. * t2 + 1.) * y0 + (t3 - 2. * t2 + t) * h * d0 + (-2. * t3 + 3. * t2) * y1 + (t3 - t2) * h * d1;
+}
+
+// @returns The index `i` of the interval [`knots[i]`, `knots[i + 1]`] that
+//          contains `x`. `knots` must be sorted and hold at least two values.
+int FindInterval(const std::vector<double>& knots, double x) {
+  const int index = static_cast<int>(std::distance(knots.begin(), std::upper_bound(knots.begin(), knots.end(), x))) - 1;
+  return std::clamp(index, 0, static_cast<int>(knots.size()) - 2);
+}
+
+}  // namespace
+
+JointRoadCurveOffset::JointRoadCurveOffset(const RoadCurve* road_curve,
+                                           const std::vector<const Function*>& lane_offsets, double p0, double p1,
+                                           std::size_t num_threads)
+    : road_curve_(road_curve), lane_offsets_(lane_offsets), p0_(p0), p1_(p1) {
+  MALIDRIVE_THROW_UNLESS(road_curve_ != nullptr);
+  for (const Function* lane_offset : lane_offsets_) {
+    MALIDRIVE_THROW_UNLESS(lane_offset != nullptr);
+  }
+  MALIDRIVE_THROW_UNLESS(p0_ >= 0.);
+  MALIDRIVE_THROW_UNLESS(p0_ < p1_);
+  MALIDRIVE_THROW_UNLESS(num_threads > 0);
+
+  // See RoadCurveOffset's constructor for the rationale of this relative
+  // tolerance.
+  relative_tolerance_ = std::max(road_curve_->linear_tolerance() / road_curve_->LMax(), kMinRelativeTolerance);
+  const double absolute_tolerance = relative_tolerance_ * road_curve_->LMax();
+  quadrature_tolerance_rate_ = absolute_tolerance * kQuadratureToleranceMultiplier / (p1_ - p0_);
+  interpolation_tolerance_ = absolute_tolerance * kInterpolationToleranceMultiplier;
+  // Like RoadCurveOffset's maximum step size, node intervals are bounded by the
+  // scale length, expressed in the p domain.
+  max_step_ = road_curve_->scale_length() * (road_curve_->p1() - road_curve_->p0()) / road_curve_->LMax();
+  if (max_step_ <= 0.) {
+    max_step_ = p1_ - p0_;
+  }
+
+  const std::vector<double> chunk_bounds = ComputeChunkBounds();
+  num_chunks_ = static_cast<int>(chunk_bounds.size()) - 1;
+  std::vector<IntegrationResult> chunk_results = IntegrateChunks(chunk_bounds, num_threads);
+
+  // Stitches the chunks. Every chunk but the first one starts with the last
+  // node of the previous chunk, so that node is skipped and the arc length of
+  // the preceding chunks is added.
+  std::vector<ArcLengthTable> tables = std::move(chunk_results.front().tables);
+  num_evaluations_ = chunk_results.front().num_evaluations;
+  for (std::size_t k = 1; k < chunk_results.size(); ++k) {
+    num_evaluations_ += chunk_results[k].num_evaluations;
+    for (std::size_t i = 0; i < tables.size(); ++i) {
+      ArcLengthTable& table = tables[i];
+      const ArcLengthTable& chunk_table = chunk_results[k].tables[i];
+      const double s_offset = table.s.back();
+      table.p.insert(table.p.end(), std::next(chunk_table.p.begin()), chunk_table.p.end());
+      std::transform(std::next(chunk_table.s.begin()), chunk_table.s.end(), std::back_inserter(table.s),
+                     [s_offset](double s) { return s + s_offset; });
+      table.s_dot.insert(table.s_dot.end(), std::next(chunk_table.s_dot.begin()), chunk_table.s_dot.end());
+    }
+  }
+  for (ArcLengthTable& table : tables) {
+    arc_length_tables_.push_back(std::make_shared<const ArcLengthTable>(std::move(table)));
+  }
+}
+
+std::vector<double> JointRoadCurveOffset::ComputeChunkBounds() const {
+  const double min_chunk_length = road_curve_->linear_tolerance();
+  std::vector<double> chunk_bounds{p0_};
+  for (const double breakpoint : road_curve_->ground_curve()->Breakpoints()) {
+    if (breakpoint - chunk_bounds.back() > min_chunk_length && p1_ - breakpoint > min_chunk_length) {
+      chunk_bounds.push_back(breakpoint);
+    }
+  }
+  chunk_bounds.push_back(p1_);
+  return chunk_bounds;
+}
+
+std::vector<JointRoadCurveOffset::IntegrationResult> JointRoadCurveOffset::IntegrateChunks(
+    const std::vector<double>& chunk_bounds, std::size_t num_threads) const {
+  const std::size_t num_chunks = chunk_bounds.size() - 1;
+  std::vector<IntegrationResult> results(num_chunks);
+  num_threads = std::min(num_threads, num_chunks);
+  if (num_threads == 1) {
+    for (std::size_t k = 0; k < num_chunks; ++k) {
+      results[k] = Integrate(chunk_bounds[k], chunk_bounds[k + 1]);
+    }
+    return results;
+  }
+
+  // Each worker takes the next pending chunk until there are none left. Chunks
+  // write to different elements of `results`, so no further synchronization is
+  // needed.
+  std::atomic<std::size_t> next_chunk{0};
+  const auto worker = [this, &chunk_bounds, &results, &next_chunk, num_chunks]() {
+    for (std::size_t k = next_chunk++; k < num_chunks; k = next_chunk++) {
+      results[k] = Integrate(chunk_bounds[k], chunk_bounds[k + 1]);
+    }
+  };
+  std::vector<std::future<void>> workers;
+  for (std::size_t i = 0; i < num_threads; ++i) {
+    workers.push_back(std::async(std::launch::async, worker));
+  }
+  // get() rethrows any exception thrown while integrating.
+  for (std::future<void>& future : workers) {
+    future.get();
+  }
+  return results;
+}
+
+JointRoadCurveOffset::Sample JointRoadCurveOffset::Evaluate(double p) const {
+  const RoadCurve::Frame frame = road_curve_->EvalFrame(p);
+  const RoadCurve::FrameDot frame_dot = road_curve_->EvalFrameDot(p);
+  const maliput::math::Vector3 r_hat = frame.rotation.col(1);
+  const maliput::math::Vector3 r_hat_dot = frame_dot.rotation_dot.col(1);
+  Sample sample{p, std::vector<double>(lane_offsets_.size())};
+  for (size_t i = 0; i < lane_offsets_.size(); ++i) {
+    const double r = lane_offsets_[i]->f(p);
+    const double r_dot = lane_offsets_[i]->f_dot(p);
+    // W'(p, r(p), 0) = (G'(p), Z'(p)) + R'(p) * (0, r(p), 0) + R(p) * (0, r'(p), 0)
+    sample.s_dot[i] = (frame_dot.origin_dot + r * r_hat_dot + r_dot * r_hat).norm();
+  }
+  return sample;
+}
+
+JointRoadCurveOffset::IntegrationResult JointRoadCurveOffset::Integrate(double p_start, double p_end) const {
+  const int num_offsets = static_cast<int>(lane_offsets_.size());
+  IntegrationResult result{std::vector<ArcLengthTable>(num_offsets), 0};
+  const auto evaluate = [this, &result](double p) {
+    ++result.num_evaluations;
+    return Evaluate(p);
+  };
+  const auto append_node = [&result, num_offsets](const Sample& sample, const std::vector<double>& s) {
+    for (int i = 0; i < num_offsets; ++i) {
+      result.tables[i].p.push_back(sample.p);
+      result.tables[i].s.push_back(s[i]);
+      result.tables[i].s_dot.push_back(sample.s_dot[i]);
+    }
+  };
+
+  // Holds a node interval whose quadrature has not been accepted yet.
+  struct Interval {
+    Sample start;
+    Sample middle;
+    Sample end;
+    int depth{};
+  };
+
+  Sample start = evaluate(p_start);
+  std::vector<double> s_start(num_offsets, 0.);
+  append_node(start, s_start);
+
+  const int num_initial_intervals = std::max(1, static_cast<int>(std::ceil((p_end - p_start) / max_step_)));
+  const double initial_step = (p_end - p_start) / static_cast<double>(num_initial_intervals);
+  std::vector<double> s_middle(num_offsets);
+  std::vector<double> s_end(num_offsets);
+  for (int k = 0; k < num_initial_intervals; ++k) {
+    const double p_a = start.p;
+    const double p_b = k == num_initial_intervals - 1 ? p_end : p_start + static_cast<double>(k + 1) * initial_step;
+    Sample end = evaluate(p_b);
+    // Intervals are processed from left to right, so the arc length
+    // accumulates as nodes are appended.
+    std::vector<Interval> pending{{start, evaluate((p_a + p_b) / 2.), end, 0}};
+    while (!pending.empty()) {
+      Interval interval = std::move(pending.back());
+      pending.pop_back();
+      const double a = interval.start.p;
+      const double m = interval.middle.p;
+      const double b = interval.end.p;
+      const double h = b - a;
+      Sample left_middle = evaluate((a + m) / 2.);
+      Sample right_middle = evaluate((m + b) / 2.);
+
+      bool accept{true};
+      for (int i = 0; i < num_offsets; ++i) {
+        const double f_a = interval.start.s_dot[i];
+        const double f_m = interval.middle.s_dot[i];
+        const double f_b = interval.end.s_dot[i];
+        // Simpson's rule over the whole interval and over each half.
+        const double coarse = h / 6. * (f_a + 4. * f_m + f_b);
+        const double left = h / 12. * (f_a + 4. * left_middle.s_dot[i] + f_m);
+        const double right = h / 12. * (f_m + 4. * right_middle.s_dot[i] + f_b);
+        s_middle[i] = s_start[i] + left;
+        s_end[i] = s_middle[i] + right;
+        const double quadrature_error = std::abs(left + right - coarse) / 15.;
+        // Both s(p) and p(s) are interpolated, so both interpolants are checked
+        // at the middle node. The error of p(s) is scaled to a length.
+        const double s_interpolation_error =
+            std::abs(EvalHermite(a, b, s_start[i], s_end[i], f_a, f_b, m) - s_middle[i]);
+        const double p_interpolation_error =
+            std::abs(EvalHermite(s_start[i], s_end[i], a, b, 1. / f_a, 1. / f_b, s_middle[i]) - m) * f_m;
+        if (quadrature_error > quadrature_tolerance_rate_ * h || s_interpolation_error > interpolation_tolerance_ ||
+            p_interpolation_error > interpolation_tolerance_) {
+          accept = false;
+          break;
+        }
+      }
+
+      if (!accept && interval.depth < kMaxDepth) {
+        // The right half is pushed first so the left half is processed next.
+        pending.push_back({interval.middle, std::move(right_middle), interval.end, interval.depth + 1});
+        pending.push_back({std::move(interval.start), std::move(left_middle), interval.middle, interval.depth + 1});
+        continue;
+      }
+      if (!accept) {
+        maliput::log()->debug("Arc length integration reached the maximum refinement in [", a, ", ", b,
+                              "]. Accepting the interval.");
+        // s_middle and s_end were left partially computed by the early exit.
+        for (int i = 0; i < num_offsets; ++i) {
+          s_middle[i] =
+              s_start[i] + h / 12. * (interval.start.s_dot[i] + 4. * left_middle.s_dot[i] + interval.middle.s_dot[i]);
+          s_end[i] =
+              s_middle[i] + h / 12. * (interval.middle.s_dot[i] + 4. * right_middle.s_dot[i] + interval.end.s_dot[i]);
+        }
+      }
+      append_node(interval.middle, s_middle);
+      append_node(interval.end, s_end);
+      s_start = s_end;
+    }
+    start = std::move(end);
+  }
+  return result;
+}
+
+std::function<double(double)> JointRoadCurveOffset::SFromP(int index) const {
+  MALIDRIVE_IS_IN_RANGE(index, 0, num_offsets() - 1);
+  return [table = arc_length_tables_[index]](double p) {
+    p = maliput::math::saturate(p, table->p.front(), table->p.back());
+    const int i = FindInterval(table->p, p);
+    return EvalHermite(table->p[i], table->p[i + 1], table->s[i], table->s[i + 1], table->s_dot[i],
+                       table->s_dot[i + 1], p);
+  };
+}
+
+std::function<double(double)> JointRoadCurveOffset::PFromS(int index) const {
+  MALIDRIVE_IS_IN_RANGE(index, 0, num_offsets() - 1);
+  return [table = arc_length_tables_[index]](double s) {
+    s = maliput::math::saturate(s, table->s.front(), table->s.back());
+    const int i = FindInterval(table->s, s);
+    return EvalHermite(table->s[i], table->s[i + 1], table->p[i], table->p[i + 1], 1. / table->s_dot[i],
+                       1. / table->s_dot[i + 1], s);
+  };
+}
+
+std::function<void(const std::vector<double>&, std::vector<double>*)> JointRoadCurveOffset::PFromSBatch(
+    int index) const {
+  MALIDRIVE_IS_IN_RANGE(index, 0, num_offsets() - 1);
+  return [table = arc_length_tables_[index]](const std::vector<double>& s, std::vector<double>* p) {
+    MALIDRIVE_THROW_UNLESS(p != nullptr);
+    p->resize(s.size());
+    int i{0};
+    for (std::size_t k = 0; k < s.size(); ++k) {
+      const double s_k = maliput::math::saturate(s[k], table->s.front(), table->s.back());
+      if (s_k < table->s[i] || s_k > table->s[i + 1]) {
+        i = FindInterval(table->s, s_k);
+      }
+      (*p)[k] = EvalHermite(table->s[i], table->s[i + 1], table->p[i], table->p[i + 1], 1. / table->s_dot[i],
+                            1. / table->s_dot[i + 1], s_k);
+    }
+  };
+}
+
+}  // namespace road_curve
+}  // namespace malidrive
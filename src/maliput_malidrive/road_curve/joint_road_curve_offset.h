@@ -0,0 +1,217 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "maliput_malidrive/common/macros.h"
+#include "maliput_malidrive/road_curve/function.h"
+#include "maliput_malidrive/road_curve/road_curve.h"
+
+namespace malidrive {
+namespace road_curve {
+
+/// Creates functors to compute the arc length of several offsets of the same
+/// RoadCurve, and their inverse functions, in a single pass.
+///
+/// RoadCurveOffset integrates each offset on its own and thus evaluates the
+/// GroundCurve, elevation and superelevation of the RoadCurve once per offset
+/// and per integration step. Lanes of the same Segment share the RoadCurve and
+/// the @f$ [p0, p1] @f$ range, so this class evaluates the RoadCurve::Frame and
+/// RoadCurve::FrameDot once per @f$ p @f$ node and derives
+/// @f$ |W'(p, r_i(p), 0)| @f$ for every offset @f$ r_i(p) @f$ from them.
+///
+/// The arc length is integrated with an adaptive Simpson quadrature that
+/// refines the nodes shared by all the offsets until the worst offset meets
+/// the tolerance. Each resulting @f$ s_i(p) @f$ and @f$ p_i(s) @f$ mapping is
+/// a piecewise cubic Hermite interpolant of the integrated nodes, whose
+/// derivatives are exactly @f$ |W'| @f$ and @f$ 1 / |W'| @f$ respectively.
+///
+/// The @f$ [p0, p1] @f$ range is split into chunks at the
+/// GroundCurve::Breakpoints() of the RoadCurve, so integration nodes never
+/// straddle a geometry change. Chunks are integrated independently, optionally
+/// in several threads, and stitched together by accumulating the arc length of
+/// the preceding chunks. This keeps very long roads, made of many geometries,
+/// off the critical path of a parallel build.
+///
+/// Tolerances follow the same heuristic as RoadCurveOffset.
+class JointRoadCurveOffset {
+ public:
+  MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(JointRoadCurveOffset);
+
+  /// Constructs a JointRoadCurveOffset and integrates all the offsets.
+  ///
+  /// @param road_curve The RoadCurve to compute offsets. It must not be
+  ///        nullptr.
+  /// @param lane_offsets The lateral offset functions. None of them can be
+  ///        nullptr and all of them must be defined in [ @p p0, @p p1 ].
+  /// @param p0 Initial @f$ p @f$ parameter value of the curve.
+  /// @param p1 Final @f$ p @f$ parameter value of the curve.
+  /// @param num_threads Maximum number of threads used to integrate the
+  ///        chunks. When it is one, the chunks are integrated in the calling
+  ///        thread. It must be positive.
+  /// @throws maliput::common::assertion_error When @p road_curve is nullptr.
+  /// @throws maliput::common::assertion_error When any of @p lane_offsets is
+  ///         nullptr.
+  /// @throws maliput::common::assertion_error When @p p0 is negative.
+  /// @throws maliput::common::assertion_error When @p p0 is not less than @p p1.
+  /// @throws maliput::common::assertion_error When @p num_threads is zero.
+  JointRoadCurveOffset(const RoadCurve* road_curve, const std::vector<const Function*>& lane_offsets, double p0,
+                       double p1, std::size_t num_threads = 1);
+
+  /// Returns the constructor RoadCurve argument.
+  const RoadCurve* road_curve() const { return road_curve_; }
+
+  /// @returns The number of offsets.
+  int num_offsets() const { return static_cast<int>(arc_length_tables_.size()); }
+
+  /// @returns The relative tolerance. See RoadCurveOffset::relative_tolerance().
+  double relative_tolerance() const { return relative_tolerance_; }
+
+  /// @returns The number of @f$ p @f$ nodes at which the RoadCurve was
+  ///          evaluated.
+  int num_evaluations() const { return num_evaluations_; }
+
+  /// @returns The number of chunks the @f$ [p0, p1] @f$ range was split into.
+  int num_chunks() const { return num_chunks_; }
+
+  /// Builds a functor that represents the relation @f$ S(p, r_i) -> s @f$.
+  ///
+  /// The functor owns its data, so it outlives this object.
+  ///
+  /// @param index The index of the offset in the constructor's `lane_offsets`.
+  /// @return A functor that returns @f$ s @f$ given @f$ p @f$.
+  /// @throws maliput::common::assertion_error When @p index is not in [0, num_offsets()).
+  std::function<double(double)> SFromP(int index) const;
+
+  /// Builds a functor that represents the relation @f$ P(s, r_i) -> p @f$.
+  ///
+  /// The functor owns its data, so it outlives this object.
+  ///
+  /// @param index The index of the offset in the constructor's `lane_offsets`.
+  /// @return A functor that returns @f$ p @f$ given @f$ s @f$.
+  /// @throws maliput::common::assertion_error When @p index is not in [0, num_offsets()).
+  std::function<double(double)> PFromS(int index) const;
+
+  /// Builds a functor that evaluates PFromS() for each element of a batch of
+  /// @f$ s @f$ values. Consecutive values are usually close, so the search of
+  /// the integration node interval starts at the previous element's.
+  ///
+  /// The functor owns its data, so it outlives this object.
+  ///
+  /// @param index The index of the offset in the constructor's `lane_offsets`.
+  /// @return A functor that fills its second argument, resized to the size of
+  ///         the first one, with the @f$ p @f$ values of its first argument.
+  /// @throws maliput::common::assertion_error When @p index is not in [0, num_offsets()).
+  std::function<void(const std::vector<double>&, std::vector<double>*)> PFromSBatch(int index) const;
+
+  /// @returns The lower bound range of @f$ p @f$.
+  double p0() const { return p0_; }
+
+  /// @returns The upper bound range of @f$ p @f$.
+  double p1() const { return p1_; }
+
+ private:
+  // Holds the integrated nodes of one offset. All vectors have the same size.
+  struct ArcLengthTable {
+    // The p value of the nodes, in increasing order.
+    std::vector<double> p;
+    // The arc length at each node, in increasing order.
+    std::vector<double> s;
+    // The derivative of the arc length with respect to p at each node.
+    std::vector<double> s_dot;
+  };
+
+  // Holds ds/dp of every offset at a p value.
+  struct Sample {
+    double p{};
+    std::vector<double> s_dot;
+  };
+
+  // Holds the result of integrating a range of p.
+  struct IntegrationResult {
+    // One table per offset.
+    std::vector<ArcLengthTable> tables;
+    // Number of times the RoadCurve was evaluated.
+    int num_evaluations{};
+  };
+
+  // See RoadCurveOffset::kMinRelativeTolerance.
+  static constexpr double kMinRelativeTolerance{1e-8};
+
+  // The proportion of the absolute tolerance that the quadrature error of the
+  // whole range may accumulate.
+  static constexpr double kQuadratureToleranceMultiplier{1e-2};
+
+  // The proportion of the absolute tolerance that the Hermite interpolation
+  // may deviate from the integrated values.
+  static constexpr double kInterpolationToleranceMultiplier{1e-1};
+
+  // Maximum number of bisections of a node interval.
+  static constexpr int kMaxDepth{30};
+
+  // Evaluates ds/dp of all the offsets at `p`.
+  Sample Evaluate(double p) const;
+
+  // Integrates all the offsets in [`p_start`, `p_end`]. The arc length of
+  // every table is zero at `p_start`.
+  IntegrationResult Integrate(double p_start, double p_end) const;
+
+  // @returns The p values that split [p0_, p1_] into chunks, including p0_ and
+  //          p1_. Breakpoints closer than the linear tolerance to another
+  //          split are dropped.
+  std::vector<double> ComputeChunkBounds() const;
+
+  // Integrates every chunk delimited by `chunk_bounds` using at most
+  // `num_threads` threads and returns the results in the same order.
+  std::vector<IntegrationResult> IntegrateChunks(const std::vector<double>& chunk_bounds,
+                                                 std::size_t num_threads) const;
+
+  const RoadCurve* road_curve_{};
+  const std::vector<const Function*> lane_offsets_;
+  const double p0_{};
+  const double p1_{};
+  double relative_tolerance_{};
+  // Maximum length of a node interval in the p domain.
+  double max_step_{};
+  // Tolerance per unit of p for the quadrature error.
+  double quadrature_tolerance_rate_{};
+  // Tolerance for the Hermite interpolation error.
+  double interpolation_tolerance_{};
+  int num_evaluations_{};
+  int num_chunks_{};
+  std::vector<std::shared_ptr<const ArcLengthTable>> arc_length_tables_;
+};
+
+}  // namespace road_curve
+}  // namespace malidrive
@@ -98,5 +98,43 @@ double LaneOffset::do_f_dot_dot(double p) const {
          LaneSign(at_right_) * lane_width_->f_dot_dot(p) / 2;
 }
 
+void LaneOffset::EvalBatch(
+    const std::vector<double>& p, std::vector<double>* images,
+    const std::function<void(const Function&, const std::vector<double>&, std::vector<double>*)>& evaluate) const {
+  std::vector<double> validated_p(p.size());
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    validated_p[i] = validate_p_(p[i]);
+  }
+  const double half_sign = LaneSign(at_right_) / 2.;
+  evaluate(adjacent_lane_functions_.has_value() ? *adjacent_lane_functions_->offset : *reference_line_offset_,
+           validated_p, images);
+  std::vector<double> widths;
+  if (adjacent_lane_functions_.has_value()) {
+    evaluate(*adjacent_lane_functions_->width, validated_p, &widths);
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      (*images)[i] += half_sign * widths[i];
+    }
+  }
+  evaluate(*lane_width_, validated_p, &widths);
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    (*images)[i] += half_sign * widths[i];
+  }
+}
+
+void LaneOffset::do_f_batch(const std::vector<double>& p, std::vector<double>* images) const {
+  EvalBatch(p, images, [](const Function& function, const std::vector<double>& function_p,
+                          std::vector<double>* function_images) { function.f(function_p, function_images); });
+}
+
+void LaneOffset::do_f_dot_batch(const std::vector<double>& p, std::vector<double>* images) const {
+  EvalBatch(p, images, [](const Function& function, const std::vector<double>& function_p,
+                          std::vector<double>* function_images) { function.f_dot(function_p, function_images); });
+}
+
+void LaneOffset::do_f_dot_dot_batch(const std::vector<double>& p, std::vector<double>* images) const {
+  EvalBatch(p, images, [](const Function& function, const std::vector<double>& function_p,
+                          std::vector<double>* function_images) { function.f_dot_dot(function_p, function_images); });
+}
+
 }  // namespace road_curve
 }  // namespace malidrive
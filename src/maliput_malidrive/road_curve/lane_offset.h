@@ -29,7 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <functional>
 #include <optional>
+#include <vector>
 
 #include <maliput/common/range_validator.h>
 
@@ -97,6 +99,18 @@ class LaneOffset : public Function {
 
   double do_f_dot_dot(double p) const override;
 
+  // Validates @p p in a first pass and then evaluates each of the composed Functions with a single batched call
+  // through `evaluate`, e.g. a call to Function::f().
+  void EvalBatch(const std::vector<double>& p, std::vector<double>* images,
+                 const std::function<void(const Function&, const std::vector<double>&, std::vector<double>*)>&
+                     evaluate) const;
+
+  void do_f_batch(const std::vector<double>& p, std::vector<double>* images) const override;
+
+  void do_f_dot_batch(const std::vector<double>& p, std::vector<double>* images) const override;
+
+  void do_f_dot_dot_batch(const std::vector<double>& p, std::vector<double>* images) const override;
+
   double do_p0() const override { return p0_; }
   double do_p1() const override { return p1_; }
   bool DoIsG1Contiguous() const override { return true; }
@@ -29,6 +29,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/road_curve/line_ground_curve.h"
 
+#include <algorithm>
+
 #include <maliput/math/saturate.h>
 
 namespace malidrive {
@@ -44,6 +46,44 @@ maliput::math::Vector2 LineGroundCurve::DoGDot(double p) const {
   return dxy_ / (p1_ - p0_);
 }
 
+void LineGroundCurve::DoGBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const {
+  // Saturation may throw, so it is done in a first pass that keeps the
+  // evaluation loop free of branches.
+  double* x_data = x->data();
+  double* y_data = y->data();
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    x_data[i] = (validate_p_(p[i]) - p0_) / (p1_ - p0_);
+  }
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    const double t = x_data[i];
+    x_data[i] = xy0_.x() + t * dxy_.x();
+    y_data[i] = xy0_.y() + t * dxy_.y();
+  }
+}
+
+void LineGroundCurve::DoGDotBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const {
+  for (const double p_i : p) {
+    validate_p_(p_i);
+  }
+  const maliput::math::Vector2 g_dot = dxy_ / (p1_ - p0_);
+  std::fill(x->begin(), x->end(), g_dot.x());
+  std::fill(y->begin(), y->end(), g_dot.y());
+}
+
+void LineGroundCurve::DoHeadingBatch(const std::vector<double>& p, std::vector<double>* headings) const {
+  for (const double p_i : p) {
+    validate_p_(p_i);
+  }
+  std::fill(headings->begin(), headings->end(), heading_);
+}
+
+void LineGroundCurve::DoHeadingDotBatch(const std::vector<double>& p, std::vector<double>* heading_dots) const {
+  for (const double p_i : p) {
+    validate_p_(p_i);
+  }
+  std::fill(heading_dots->begin(), heading_dots->end(), 0.);
+}
+
 double LineGroundCurve::DoGInverse(const maliput::math::Vector2& xy) const {
   // unit vector pointing along line from p0 -> p1
   const maliput::math::Vector2& unit_vector = dxy_ / arc_length_;
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <cmath>
+#include <vector>
 
 #include <maliput/common/range_validator.h>
 
@@ -92,6 +93,11 @@ class LineGroundCurve : public GroundCurve {
     return heading_;
   }
 
+  void DoGBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const override;
+  void DoGDotBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const override;
+  void DoHeadingBatch(const std::vector<double>& p, std::vector<double>* headings) const override;
+  void DoHeadingDotBatch(const std::vector<double>& p, std::vector<double>* heading_dots) const override;
+
   double DoHeadingDot(double p) const override {
     validate_p_(p);
     return 0.;
@@ -154,6 +154,49 @@ double PiecewiseFunction::do_f_dot_dot(double p) const {
   return function_p.first->f_dot_dot(function_p.second);
 }
 
+std::vector<PiecewiseFunction::PieceBatch> PiecewiseFunction::GroupByPiece(const std::vector<double>& p) const {
+  std::vector<PieceBatch> piece_batches;
+  // Maps each piece to its index in `piece_batches`.
+  std::map<const Function*, std::size_t> piece_batch_indices;
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    const std::pair<const Function*, double> function_p = GetFunctionAndPAt(p[i]);
+    const auto it = piece_batch_indices.emplace(function_p.first, piece_batches.size()).first;
+    if (it->second == piece_batches.size()) {
+      piece_batches.push_back({function_p.first, {}, {}});
+    }
+    piece_batches[it->second].indices.push_back(i);
+    piece_batches[it->second].p.push_back(function_p.second);
+  }
+  return piece_batches;
+}
+
+void PiecewiseFunction::EvalByPiece(
+    const std::vector<double>& p, std::vector<double>* images,
+    const std::function<void(const Function&, const std::vector<double>&, std::vector<double>*)>& evaluate) const {
+  std::vector<double> piece_images;
+  for (const PieceBatch& piece_batch : GroupByPiece(p)) {
+    evaluate(*piece_batch.function, piece_batch.p, &piece_images);
+    for (std::size_t i = 0; i < piece_batch.indices.size(); ++i) {
+      (*images)[piece_batch.indices[i]] = piece_images[i];
+    }
+  }
+}
+
+void PiecewiseFunction::do_f_batch(const std::vector<double>& p, std::vector<double>* images) const {
+  EvalByPiece(p, images, [](const Function& function, const std::vector<double>& piece_p,
+                            std::vector<double>* piece_images) { function.f(piece_p, piece_images); });
+}
+
+void PiecewiseFunction::do_f_dot_batch(const std::vector<double>& p, std::vector<double>* images) const {
+  EvalByPiece(p, images, [](const Function& function, const std::vector<double>& piece_p,
+                            std::vector<double>* piece_images) { function.f_dot(piece_p, piece_images); });
+}
+
+void PiecewiseFunction::do_f_dot_dot_batch(const std::vector<double>& p, std::vector<double>* images) const {
+  EvalByPiece(p, images, [](const Function& function, const std::vector<double>& piece_p,
+                            std::vector<double>* piece_images) { function.f_dot_dot(piece_p, piece_images); });
+}
+
 bool PiecewiseFunction::FunctionInterval::operator<(const FunctionInterval& rhs) const {
   if (min < rhs.min) {
     return max <= rhs.max ? true : false;
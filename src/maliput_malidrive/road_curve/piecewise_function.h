@@ -29,6 +29,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
 #include <utility>
@@ -105,9 +107,31 @@ class PiecewiseFunction : public Function {
   // @throws maliput::common::assertion_error When p is not in [`p0()`, `p1()`].
   std::pair<const Function*, double> GetFunctionAndPAt(double p) const;
 
+  // Holds the elements of a batch of p values that map to the same piece.
+  struct PieceBatch {
+    const Function* function{};
+    // Indices of the elements within the batch.
+    std::vector<std::size_t> indices;
+    // The p parameters in `function`'s domain.
+    std::vector<double> p;
+  };
+
+  // Groups @p p by the piece each element maps to.
+  // @throws maliput::common::assertion_error When any of @p p is not in [`p0()`, `p1()`].
+  std::vector<PieceBatch> GroupByPiece(const std::vector<double>& p) const;
+
+  // Calls `evaluate` once per piece with the elements of @p p that map to it and scatters the results into
+  // @p images.
+  void EvalByPiece(const std::vector<double>& p, std::vector<double>* images,
+                   const std::function<void(const Function&, const std::vector<double>&, std::vector<double>*)>&
+                       evaluate) const;
+
   double do_f(double p) const override;
   double do_f_dot(double p) const override;
   double do_f_dot_dot(double p) const override;
+  void do_f_batch(const std::vector<double>& p, std::vector<double>* images) const override;
+  void do_f_dot_batch(const std::vector<double>& p, std::vector<double>* images) const override;
+  void do_f_dot_dot_batch(const std::vector<double>& p, std::vector<double>* images) const override;
   double do_p0() const override { return p0_; }
   double do_p1() const override { return p1_; }
   bool DoIsG1Contiguous() const override { return is_g1_contiguous; }
@@ -31,6 +31,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
+#include <map>
 
 #include <maliput/common/assertion_error.h>
 #include <maliput/common/logger.h>
@@ -132,6 +134,15 @@ double PiecewiseGroundCurve::GetPiecewiseP(const GroundCurve* ground_curve, doub
   return range_gc->first.min + p_i - ground_curve->p0();
 }
 
+std::vector<double> PiecewiseGroundCurve::DoBreakpoints() const {
+  std::vector<double> breakpoints;
+  // The last interval ends at p1, which is not a breakpoint.
+  for (auto it = interval_ground_curve_.begin(); std::next(it) != interval_ground_curve_.end(); ++it) {
+    breakpoints.push_back(it->first.max);
+  }
+  return breakpoints;
+}
+
 double PiecewiseGroundCurve::DoPFromP(double xodr_p) const {
   // The RoadCurveInterval map can't be used because those intervals are processed in the PiecewiseGroundCurve domain.
   const auto ground_curve_it = std::find_if(ground_curves_.begin(), ground_curves_.end(),
@@ -183,6 +194,75 @@ double PiecewiseGroundCurve::DoHeadingDot(double p) const {
   return ground_curve_p.first->HeadingDot(ground_curve_p.second);
 }
 
+std::vector<PiecewiseGroundCurve::PieceBatch> PiecewiseGroundCurve::GroupByPiece(const std::vector<double>& p) const {
+  std::vector<PieceBatch> piece_batches;
+  // Maps each GroundCurve to its index in `piece_batches`.
+  std::map<const GroundCurve*, std::size_t> piece_batch_indices;
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    const std::pair<const GroundCurve*, double> ground_curve_p = GetGroundCurveFromP(p[i]);
+    const auto it = piece_batch_indices.emplace(ground_curve_p.first, piece_batches.size()).first;
+    if (it->second == piece_batches.size()) {
+      piece_batches.push_back({ground_curve_p.first, {}, {}});
+    }
+    piece_batches[it->second].indices.push_back(i);
+    piece_batches[it->second].p.push_back(ground_curve_p.second);
+  }
+  return piece_batches;
+}
+
+void PiecewiseGroundCurve::EvalByPiece(
+    const std::vector<double>& p, std::vector<double>* values,
+    const std::function<void(const GroundCurve&, const std::vector<double>&, std::vector<double>*)>& evaluate) const {
+  std::vector<double> piece_values;
+  for (const PieceBatch& piece_batch : GroupByPiece(p)) {
+    evaluate(*piece_batch.ground_curve, piece_batch.p, &piece_values);
+    for (std::size_t i = 0; i < piece_batch.indices.size(); ++i) {
+      (*values)[piece_batch.indices[i]] = piece_values[i];
+    }
+  }
+}
+
+void PiecewiseGroundCurve::EvalByPiece(
+    const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y,
+    const std::function<void(const GroundCurve&, const std::vector<double>&, std::vector<double>*,
+                             std::vector<double>*)>& evaluate) const {
+  std::vector<double> piece_x;
+  std::vector<double> piece_y;
+  for (const PieceBatch& piece_batch : GroupByPiece(p)) {
+    evaluate(*piece_batch.ground_curve, piece_batch.p, &piece_x, &piece_y);
+    for (std::size_t i = 0; i < piece_batch.indices.size(); ++i) {
+      (*x)[piece_batch.indices[i]] = piece_x[i];
+      (*y)[piece_batch.indices[i]] = piece_y[i];
+    }
+  }
+}
+
+void PiecewiseGroundCurve::DoGBatch(const std::vector<double>& p, std::vector<double>* x,
+                                    std::vector<double>* y) const {
+  EvalByPiece(p, x, y,
+              [](const GroundCurve& ground_curve, const std::vector<double>& piece_p, std::vector<double>* piece_x,
+                 std::vector<double>* piece_y) { ground_curve.G(piece_p, piece_x, piece_y); });
+}
+
+void PiecewiseGroundCurve::DoGDotBatch(const std::vector<double>& p, std::vector<double>* x,
+                                       std::vector<double>* y) const {
+  EvalByPiece(p, x, y,
+              [](const GroundCurve& ground_curve, const std::vector<double>& piece_p, std::vector<double>* piece_x,
+                 std::vector<double>* piece_y) { ground_curve.GDot(piece_p, piece_x, piece_y); });
+}
+
+void PiecewiseGroundCurve::DoHeadingBatch(const std::vector<double>& p, std::vector<double>* headings) const {
+  EvalByPiece(p, headings,
+              [](const GroundCurve& ground_curve, const std::vector<double>& piece_p,
+                 std::vector<double>* piece_headings) { ground_curve.Heading(piece_p, piece_headings); });
+}
+
+void PiecewiseGroundCurve::DoHeadingDotBatch(const std::vector<double>& p, std::vector<double>* heading_dots) const {
+  EvalByPiece(p, heading_dots,
+              [](const GroundCurve& ground_curve, const std::vector<double>& piece_p,
+                 std::vector<double>* piece_heading_dots) { ground_curve.HeadingDot(piece_p, piece_heading_dots); });
+}
+
 bool PiecewiseGroundCurve::RoadCurveInterval::operator<(const RoadCurveInterval& rhs) const {
   if (min < rhs.min) {
     return max <= rhs.max ? true : false;
@@ -29,6 +29,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <memory>
@@ -108,6 +109,31 @@ class PiecewiseGroundCurve : public GroundCurve {
   //         @f$ [ground_curve->p0(); ground_curve->p1()] @f$.
   double GetPiecewiseP(const GroundCurve* ground_curve, double p_i) const;
 
+  // Holds the elements of a batch of p values that map to the same GroundCurve.
+  struct PieceBatch {
+    const GroundCurve* ground_curve{};
+    // Indices of the elements within the batch.
+    std::vector<std::size_t> indices;
+    // The p parameters in `ground_curve`'s domain.
+    std::vector<double> p;
+  };
+
+  // Groups @p p by the GroundCurve each element maps to.
+  // @throws maliput::common::assertion_error When any of @p p is not in
+  //         @f$ [`p0()`; `p1()`] @f$.
+  std::vector<PieceBatch> GroupByPiece(const std::vector<double>& p) const;
+
+  // Calls `evaluate` once per GroundCurve with the elements of @p p that map to it and scatters the results into
+  // @p values.
+  void EvalByPiece(const std::vector<double>& p, std::vector<double>* values,
+                   const std::function<void(const GroundCurve&, const std::vector<double>&, std::vector<double>*)>&
+                       evaluate) const;
+
+  // Same as the other EvalByPiece() but for two dimensional results.
+  void EvalByPiece(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y,
+                   const std::function<void(const GroundCurve&, const std::vector<double>&, std::vector<double>*,
+                                            std::vector<double>*)>& evaluate) const;
+
   double DoPFromP(double xodr_p) const override;
 
   maliput::math::Vector2 DoG(double p) const override;
@@ -120,11 +146,20 @@ class PiecewiseGroundCurve : public GroundCurve {
 
   double DoHeadingDot(double p) const override;
 
+  void DoGBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const override;
+
+  void DoGDotBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const override;
+
+  void DoHeadingBatch(const std::vector<double>& p, std::vector<double>* headings) const override;
+
+  void DoHeadingDotBatch(const std::vector<double>& p, std::vector<double>* heading_dots) const override;
+
   double DoArcLength() const override { return arc_length_; }
   double do_linear_tolerance() const override { return linear_tolerance_; }
   double do_p0() const override { return p0_; }
   double do_p1() const override { return p1_; }
   bool DoIsG1Contiguous() const override { return true; }
+  std::vector<double> DoBreakpoints() const override;
 
   // Contains all the ground curves of the PiecewiseGroundCurve.
   const std::vector<std::unique_ptr<GroundCurve>> ground_curves_{};
@@ -31,6 +31,7 @@
 
 #include <cmath>
 #include <utility>
+#include <vector>
 
 #include <maliput/math/matrix.h>
 #include <maliput/math/saturate.h>
@@ -84,6 +85,153 @@ maliput::math::Vector3 RoadCurve::W(const maliput::math::Vector3& prh) const {
   return rpy.ToMatrix() * maliput::math::Vector3(0., prh.y(), prh.z()) + maliput::math::Vector3(xy.x(), xy.y(), z);
 }
 
+void RoadCurve::W(const Vector3Batch& prh, Vector3Batch* xyz) const {
+  MALIDRIVE_THROW_UNLESS(prh.is_consistent());
+  MALIDRIVE_THROW_UNLESS(xyz != nullptr);
+  const std::size_t size = prh.size();
+  const std::vector<double> p = ValidateP(prh.x);
+  // (G(p), Z(p)) is written straight into the output.
+  xyz->resize(size);
+  ground_curve_->G(p, &xyz->x, &xyz->y);
+  elevation_->f(p, &xyz->z);
+  std::vector<double> g_dot_x;
+  std::vector<double> g_dot_y;
+  std::vector<double> headings;
+  std::vector<double> elevation_dots;
+  std::vector<double> superelevations;
+  ground_curve_->GDot(p, &g_dot_x, &g_dot_y);
+  ground_curve_->Heading(p, &headings);
+  elevation_->f_dot(p, &elevation_dots);
+  superelevation_->f(p, &superelevations);
+  for (std::size_t i = 0; i < size; ++i) {
+    // Same angles as Orientation(p).
+    const double alpha = superelevations[i];
+    const double beta = -std::atan2(elevation_dots[i], std::sqrt(g_dot_x[i] * g_dot_x[i] + g_dot_y[i] * g_dot_y[i]));
+    const double gamma = headings[i];
+    const double sa = std::sin(alpha);
+    const double ca = std::cos(alpha);
+    const double sb = std::sin(beta);
+    const double cb = std::cos(beta);
+    const double sg = std::sin(gamma);
+    const double cg = std::cos(gamma);
+    const double r = prh.y[i];
+    const double h = prh.z[i];
+    // R_αβγ * (0, r, h), i.e. r times the second column plus h times the third
+    // column of maliput::math::RollPitchYaw::ToMatrix().
+    xyz->x[i] += r * (sa * sb * cg - ca * sg) + h * (ca * sb * cg + sa * sg);
+    xyz->y[i] += r * (sa * sb * sg + ca * cg) + h * (ca * sb * sg - sa * cg);
+    xyz->z[i] += r * sa * cb + h * ca * cb;
+  }
+}
+
+void RoadCurve::ProjectOnSAxis(const Vector3Batch& xyz, const std::vector<double>& p, std::vector<double>* projections,
+                               std::vector<double>* projection_dots) const {
+  MALIDRIVE_THROW_UNLESS(xyz.is_consistent());
+  MALIDRIVE_THROW_UNLESS(xyz.size() == p.size());
+  MALIDRIVE_THROW_UNLESS(projections != nullptr);
+  MALIDRIVE_THROW_UNLESS(projection_dots != nullptr);
+  const std::size_t size = p.size();
+  const std::vector<double> saturated_p = ValidateP(p);
+  Vector3Batch origins;
+  Vector3Batch origin_dots;
+  std::vector<double> elevation_dot_dots;
+  std::vector<double> headings;
+  std::vector<double> heading_dots;
+  ground_curve_->G(saturated_p, &origins.x, &origins.y);
+  elevation_->f(saturated_p, &origins.z);
+  ground_curve_->GDot(saturated_p, &origin_dots.x, &origin_dots.y);
+  elevation_->f_dot(saturated_p, &origin_dots.z);
+  elevation_->f_dot_dot(saturated_p, &elevation_dot_dots);
+  ground_curve_->Heading(saturated_p, &headings);
+  ground_curve_->HeadingDot(saturated_p, &heading_dots);
+  projections->resize(size);
+  projection_dots->resize(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const double g_dot_norm = std::sqrt(origin_dots.x[i] * origin_dots.x[i] + origin_dots.y[i] * origin_dots.y[i]);
+    // Same angles and rates as Orientation(p) and EvalFrameDot(p). The
+    // superelevation does not change the s-axis.
+    const double beta = -std::atan2(origin_dots.z[i], g_dot_norm);
+    const double sb = std::sin(beta);
+    const double cb = std::cos(beta);
+    const double sg = std::sin(headings[i]);
+    const double cg = std::cos(headings[i]);
+    const double d_beta = -cb * cb * elevation_dot_dots[i] / g_dot_norm;
+    const double d_gamma = heading_dots[i];
+    // s_hat is the first column of maliput::math::RollPitchYaw::ToMatrix().
+    const double s_hat_x = cb * cg;
+    const double s_hat_y = cb * sg;
+    const double s_hat_z = -sb;
+    const double s_hat_dot_x = -sb * d_beta * cg - cb * sg * d_gamma;
+    const double s_hat_dot_y = -sb * d_beta * sg + cb * cg * d_gamma;
+    const double s_hat_dot_z = -cb * d_beta;
+    const double delta_x = xyz.x[i] - origins.x[i];
+    const double delta_y = xyz.y[i] - origins.y[i];
+    const double delta_z = xyz.z[i] - origins.z[i];
+    (*projections)[i] = delta_x * s_hat_x + delta_y * s_hat_y + delta_z * s_hat_z;
+    (*projection_dots)[i] = -(origin_dots.x[i] * s_hat_x + origin_dots.y[i] * s_hat_y + origin_dots.z[i] * s_hat_z) +
+                            delta_x * s_hat_dot_x + delta_y * s_hat_dot_y + delta_z * s_hat_dot_z;
+  }
+}
+
+void RoadCurve::ProjectOnRHPlane(const Vector3Batch& xyz, const std::vector<double>& p, Vector3Batch* prh) const {
+  MALIDRIVE_THROW_UNLESS(xyz.is_consistent());
+  MALIDRIVE_THROW_UNLESS(xyz.size() == p.size());
+  MALIDRIVE_THROW_UNLESS(prh != nullptr);
+  const std::size_t size = p.size();
+  const std::vector<double> saturated_p = ValidateP(p);
+  Vector3Batch origins;
+  std::vector<double> g_dot_x;
+  std::vector<double> g_dot_y;
+  std::vector<double> elevation_dots;
+  std::vector<double> headings;
+  std::vector<double> superelevations;
+  ground_curve_->G(saturated_p, &origins.x, &origins.y);
+  elevation_->f(saturated_p, &origins.z);
+  ground_curve_->GDot(saturated_p, &g_dot_x, &g_dot_y);
+  elevation_->f_dot(saturated_p, &elevation_dots);
+  ground_curve_->Heading(saturated_p, &headings);
+  superelevation_->f(saturated_p, &superelevations);
+  prh->resize(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    // Same angles as Orientation(p).
+    const double alpha = superelevations[i];
+    const double beta = -std::atan2(elevation_dots[i], std::sqrt(g_dot_x[i] * g_dot_x[i] + g_dot_y[i] * g_dot_y[i]));
+    const double gamma = headings[i];
+    const double sa = std::sin(alpha);
+    const double ca = std::cos(alpha);
+    const double sb = std::sin(beta);
+    const double cb = std::cos(beta);
+    const double sg = std::sin(gamma);
+    const double cg = std::cos(gamma);
+    const double delta_x = xyz.x[i] - origins.x[i];
+    const double delta_y = xyz.y[i] - origins.y[i];
+    const double delta_z = xyz.z[i] - origins.z[i];
+    // r_hat and h_hat are the second and third columns of
+    // maliput::math::RollPitchYaw::ToMatrix().
+    prh->x[i] = saturated_p[i];
+    prh->y[i] = delta_x * (sa * sb * cg - ca * sg) + delta_y * (sa * sb * sg + ca * cg) + delta_z * sa * cb;
+    prh->z[i] = delta_x * (ca * sb * cg + sa * sg) + delta_y * (ca * sb * sg - sa * cg) + delta_z * ca * cb;
+  }
+}
+
+std::vector<double> RoadCurve::ValidateP(const std::vector<double>& p) const {
+  std::vector<double> saturated_p(p.size());
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    MALIDRIVE_IS_IN_RANGE(p[i], ground_curve_->p0() - ground_curve_->linear_tolerance(),
+                          ground_curve_->p1() + ground_curve_->linear_tolerance());
+    saturated_p[i] = maliput::math::saturate(p[i], ground_curve_->p0(), ground_curve_->p1());
+  }
+  return saturated_p;
+}
+
+RoadCurve::Frame RoadCurve::EvalFrame(double p) const {
+  MALIDRIVE_IS_IN_RANGE(p, ground_curve_->p0() - ground_curve_->linear_tolerance(),
+                        ground_curve_->p1() + ground_curve_->linear_tolerance());
+  p = maliput::math::saturate(p, ground_curve_->p0(), ground_curve_->p1());
+  const maliput::math::Vector2 xy = ground_curve_->G(p);
+  return {maliput::math::Vector3(xy.x(), xy.y(), elevation_->f(p)), Orientation(p).ToMatrix()};
+}
+
 maliput::math::Vector3 RoadCurve::WDot(const maliput::math::Vector3& prh) const {
   const road_curve::CubicPolynomial zero_function{0., 0., 0., 0., p0(), p1(), linear_tolerance_};
   return WDot(prh, &zero_function);
@@ -101,9 +249,23 @@ maliput::math::Vector3 RoadCurve::WDot(const maliput::math::Vector3& prh, const
   const double r = prh.y();
   const double h = prh.z();
   const double r_dot = lane_offset->f_dot(p);
-  const maliput::math::Vector2 g_prime = ground_curve_->GDot(p);
-
   const maliput::math::RollPitchYaw rpy_at_centerline = Orientation(p);
+  const FrameDot frame_dot = EvalFrameDot(p, rpy_at_centerline);
+  // compute rotation matrix at centerline (R)
+  const maliput::math::Matrix3 R = rpy_at_centerline.ToMatrix();
+  return frame_dot.origin_dot + frame_dot.rotation_dot * maliput::math::Vector3(0, r, h) +
+         R * maliput::math::Vector3{0., r_dot, 0.};
+}
+
+RoadCurve::FrameDot RoadCurve::EvalFrameDot(double p) const {
+  MALIDRIVE_IS_IN_RANGE(p, ground_curve_->p0() - ground_curve_->linear_tolerance(),
+                        ground_curve_->p1() + ground_curve_->linear_tolerance());
+  p = maliput::math::saturate(p, ground_curve_->p0(), ground_curve_->p1());
+  return EvalFrameDot(p, Orientation(p));
+}
+
+RoadCurve::FrameDot RoadCurve::EvalFrameDot(double p, const maliput::math::RollPitchYaw& rpy_at_centerline) const {
+  const maliput::math::Vector2 g_prime = ground_curve_->GDot(p);
   const double beta = rpy_at_centerline.pitch_angle();
   const double cb = std::cos(beta);
 
@@ -113,12 +275,9 @@ maliput::math::Vector3 RoadCurve::WDot(const maliput::math::Vector3& prh, const
   const double d_beta = -cb * cb * elevation_->f_dot_dot(p) / g_prime.norm();
   const double d_gamma = ground_curve_->HeadingDot(p);
 
-  // compute rotation matrix at centerline (R) and its time derivative (dR_dt)
-  const maliput::math::Matrix3 R = rpy_at_centerline.ToMatrix();
-  const maliput::math::Matrix3 dR_dt = rpy_at_centerline.CalcRotationMatrixDt({d_alpha, d_beta, d_gamma});
-
-  return maliput::math::Vector3(g_prime.x(), g_prime.y(), elevation_->f_dot(p)) +
-         dR_dt * maliput::math::Vector3(0, r, h) + R * maliput::math::Vector3{0., r_dot, 0.};
+  // compute the time derivative of the rotation matrix at centerline (dR_dt)
+  return {maliput::math::Vector3(g_prime.x(), g_prime.y(), elevation_->f_dot(p)),
+          rpy_at_centerline.CalcRotationMatrixDt({d_alpha, d_beta, d_gamma})};
 }
 
 maliput::math::RollPitchYaw RoadCurve::Orientation(double p) const {
@@ -30,7 +30,9 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
+#include <maliput/math/matrix.h>
 #include <maliput/math/roll_pitch_yaw.h>
 #include <maliput/math/vector.h>
 
@@ -38,6 +40,7 @@
 #include "maliput_malidrive/road_curve/function.h"
 #include "maliput_malidrive/road_curve/ground_curve.h"
 #include "maliput_malidrive/road_curve/lane_offset.h"
+#include "maliput_malidrive/road_curve/vector3_batch.h"
 
 namespace malidrive {
 namespace road_curve {
@@ -95,6 +98,31 @@ class RoadCurve {
  public:
   MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(RoadCurve);
 
+  /// Holds the (s, r, h) basis of the RoadCurve at @f$ (p, 0, 0) @f$.
+  ///
+  /// It allows to evaluate @f$ W(p, r, h) = origin + rotation * (0, r, h) @f$
+  /// for many @f$ (r, h) @f$ pairs at the same @f$ p @f$ without evaluating
+  /// the GroundCurve, the elevation and the superelevation again.
+  struct Frame {
+    /// @f$ W(p, 0, 0) @f$ in the INERTIAL Frame.
+    maliput::math::Vector3 origin;
+    /// @f$ R_{αβγ} @f$ at @f$ p @f$. Its columns are @f$ \hat{s} @f$, @f$ \hat{r} @f$ and
+    /// @f$ \hat{h} @f$ at @f$ (p, 0, 0) @f$.
+    maliput::math::Matrix3 rotation;
+  };
+
+  /// Holds the derivatives with respect to @f$ p @f$ of the Frame members.
+  ///
+  /// Together with a Frame, it allows to evaluate
+  /// @f$ W'(p, r(p), h) = origin_dot + rotation_dot * (0, r(p), h) + rotation * (0, r'(p), 0) @f$
+  /// for many lateral offset functions at the same @f$ p @f$.
+  struct FrameDot {
+    /// @f$ (G'(p), Z'(p)) @f$.
+    maliput::math::Vector3 origin_dot;
+    /// @f$ ∂R_{αβγ}/∂p @f$ at @f$ p @f$.
+    maliput::math::Matrix3 rotation_dot;
+  };
+
   /// Constructs a RoadCurve.
   ///
   /// @param linear_tolerance It is expected to be the same as
@@ -132,6 +160,9 @@ class RoadCurve {
   double p1() const { return ground_curve_->p1(); }
   double LMax() const { return ground_curve_->ArcLength(); }
 
+  /// @return The reference GroundCurve.
+  const GroundCurve* ground_curve() const { return ground_curve_.get(); }
+
   /// @return The linear tolerance used to compute all the methods.
   /// @see maliput::api::RoadGeometry::linear_tolerance().
   double linear_tolerance() const { return linear_tolerance_; }
@@ -146,6 +177,75 @@ class RoadCurve {
   /// @return A vector in the INERTIAL Frame which is the image of the RoadCurve.
   maliput::math::Vector3 W(const maliput::math::Vector3& prh) const;
 
+  /// Evaluates @f$ W(p, r, h) @f$ for each element of @p prh.
+  ///
+  /// It is equivalent to calling W() once per element, but the GroundCurve,
+  /// the elevation and the superelevation are evaluated with their batched
+  /// kernels and @f$ R_{αβγ} @f$ is applied without building a matrix.
+  ///
+  /// @param prh Vectors in the RoadCurve domain. It must be consistent.
+  /// @param xyz The images in the INERTIAL Frame. It is resized to `prh.size()`.
+  /// @throw maliput::common::assertion_error When @p prh is not consistent.
+  /// @throw maliput::common::assertion_error When @p xyz is nullptr.
+  /// @throw maliput::common::assertion_error When any of @p prh .x is not in
+  ///        range [p0, p1].
+  void W(const Vector3Batch& prh, Vector3Batch* xyz) const;
+
+  /// Projects each of @p xyz onto the s-axis of the Frame at the matching
+  /// element of @p p.
+  ///
+  /// For each pair it evaluates @f$ g(p) = (xyz - W(p, 0, 0)) \cdot \hat{s}(p) @f$
+  /// and @f$ g'(p) @f$. The root of @f$ g @f$ is the @f$ p @f$ coordinate of
+  /// @f$ W⁻¹(xyz) @f$, so they are the residual and the derivative of a
+  /// Newton iteration that solves many inverses in lockstep.
+  ///
+  /// @param xyz Points in the INERTIAL Frame. It must be consistent.
+  /// @param p The GroundCurve parameters. It must have the same size as
+  ///        @p xyz.
+  /// @param projections The values of @f$ g(p) @f$. It is resized to `p.size()`.
+  /// @param projection_dots The values of @f$ g'(p) @f$. It is resized to
+  ///        `p.size()`.
+  /// @throw maliput::common::assertion_error When @p xyz is not consistent or
+  ///        its size differs from @p p's.
+  /// @throw maliput::common::assertion_error When @p projections or
+  ///        @p projection_dots are nullptr.
+  /// @throw maliput::common::assertion_error When any of @p p is not in range
+  ///        [p0, p1].
+  void ProjectOnSAxis(const Vector3Batch& xyz, const std::vector<double>& p, std::vector<double>* projections,
+                      std::vector<double>* projection_dots) const;
+
+  /// Evaluates @f$ W⁻¹(xyz) @f$ for each of @p xyz when its @f$ p @f$
+  /// coordinate is already known.
+  ///
+  /// For each pair it projects @f$ xyz - W(p, 0, 0) @f$ onto the r-axis and
+  /// the h-axis of the Frame at @f$ p @f$.
+  ///
+  /// @param xyz Points in the INERTIAL Frame. It must be consistent.
+  /// @param p The GroundCurve parameters. It must have the same size as
+  ///        @p xyz.
+  /// @param prh The @f$ (p, r, h) @f$ vectors in the RoadCurve domain. It is
+  ///        resized to `p.size()`.
+  /// @throw maliput::common::assertion_error When @p xyz is not consistent or
+  ///        its size differs from @p p's.
+  /// @throw maliput::common::assertion_error When @p prh is nullptr.
+  /// @throw maliput::common::assertion_error When any of @p p is not in range
+  ///        [p0, p1].
+  void ProjectOnRHPlane(const Vector3Batch& xyz, const std::vector<double>& p, Vector3Batch* prh) const;
+
+  /// Evaluates the Frame of the RoadCurve at @p p.
+  ///
+  /// @param p The GroundCurve parameter.
+  /// @return The Frame at @f$ (p, 0, 0) @f$.
+  /// @throw maliput::common::assertion_error When @p p is not in range [p0, p1].
+  Frame EvalFrame(double p) const;
+
+  /// Evaluates the FrameDot of the RoadCurve at @p p.
+  ///
+  /// @param p The GroundCurve parameter.
+  /// @return The FrameDot at @f$ (p, 0, 0) @f$.
+  /// @throw maliput::common::assertion_error When @p p is not in range [p0, p1].
+  FrameDot EvalFrameDot(double p) const;
+
   /// Evaluates @f$ W'(p, r, h) @f$ with respect to @f$ p @f$.
   ///
   /// @param prh A vector in the RoadCurve domain.
@@ -260,6 +360,15 @@ class RoadCurve {
   double PFromP(double xodr_p) const { return ground_curve_->PFromP(xodr_p); }
 
  private:
+  // Evaluates the FrameDot at `p` reusing `rpy_at_centerline`, which must be
+  // the result of Orientation(p).
+  FrameDot EvalFrameDot(double p, const maliput::math::RollPitchYaw& rpy_at_centerline) const;
+
+  // @returns The saturation of each of `p` to [p0, p1].
+  // @throw maliput::common::assertion_error When any of `p` is not in range
+  //        [p0, p1] within linear_tolerance.
+  std::vector<double> ValidateP(const std::vector<double>& p) const;
+
   // Maximum number of iterations to use in DoWInverse.
   static constexpr int kMaxIterations{16};
   const double linear_tolerance_{};
@@ -29,7 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 #include <maliput/common/range_validator.h>
 
@@ -96,6 +98,33 @@ class ScaledDomainFunction : public Function {
     return function_->f_dot_dot(p_of_p(p)) * alpha_ * alpha_;
   }
 
+  // Maps @p p to `function_`'s domain in a first pass, so `function_` is evaluated with a single batched call.
+  std::vector<double> p_of_p(const std::vector<double>& p) const {
+    std::vector<double> function_p(p.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      function_p[i] = p_of_p(p[i]);
+    }
+    return function_p;
+  }
+
+  void do_f_batch(const std::vector<double>& p, std::vector<double>* images) const override {
+    function_->f(p_of_p(p), images);
+  }
+
+  void do_f_dot_batch(const std::vector<double>& p, std::vector<double>* images) const override {
+    function_->f_dot(p_of_p(p), images);
+    for (double& image : *images) {
+      image *= alpha_;
+    }
+  }
+
+  void do_f_dot_dot_batch(const std::vector<double>& p, std::vector<double>* images) const override {
+    function_->f_dot_dot(p_of_p(p), images);
+    for (double& image : *images) {
+      image *= alpha_ * alpha_;
+    }
+  }
+
   double do_p0() const override { return p0_; }
   double do_p1() const override { return p1_; }
   bool DoIsG1Contiguous() const override { return true; }
@@ -0,0 +1,74 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace malidrive {
+namespace road_curve {
+
+/// Holds a sequence of three dimensional vectors as a structure of arrays.
+///
+/// Batched evaluations take and return Vector3Batch objects, so their kernels
+/// loop over a contiguous array per coordinate and the compiler is able to
+/// vectorize them. As it happens with maliput::math::Vector3, the meaning of
+/// each coordinate depends on the context, e.g. @f$ (p, r, h) @f$ in the
+/// RoadCurve domain or @f$ (x, y, z) @f$ in the INERTIAL Frame.
+struct Vector3Batch {
+  /// Constructs an empty batch.
+  Vector3Batch() = default;
+
+  /// Constructs a batch of @p size zero vectors.
+  explicit Vector3Batch(std::size_t size) : x(size), y(size), z(size) {}
+
+  /// @returns The number of vectors, i.e. the size of `x`.
+  std::size_t size() const { return x.size(); }
+
+  /// @returns True when `x`, `y` and `z` have the same size.
+  bool is_consistent() const { return y.size() == x.size() && z.size() == x.size(); }
+
+  /// Resizes the three coordinate arrays to @p size.
+  void resize(std::size_t size) {
+    x.resize(size);
+    y.resize(size);
+    z.resize(size);
+  }
+
+  /// First coordinates.
+  std::vector<double> x;
+  /// Second coordinates.
+  std::vector<double> y;
+  /// Third coordinates.
+  std::vector<double> z;
+};
+
+}  // namespace road_curve
+}  // namespace malidrive
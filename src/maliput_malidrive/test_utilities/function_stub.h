@@ -29,6 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "maliput_malidrive/common/macros.h"
 #include "maliput_malidrive/road_curve/function.h"
 
@@ -51,13 +54,40 @@ class FunctionStub : public Function {
         p1_result_(p1_result),
         is_g1_contiguous_(is_g1_contiguous) {}
 
+  /// @returns The number of single p evaluations of f(), f_dot() and f_dot_dot().
+  int num_evaluations() const { return num_evaluations_; }
+
+  /// @returns The number of batched evaluations of f(), f_dot() and f_dot_dot().
+  int num_batch_evaluations() const { return num_batch_evaluations_; }
+
  private:
   // Virtual private definitions of the public members. Public member
   // constraints apply the same.
   //@{
-  double do_f(double) const override { return f_result_; }
-  double do_f_dot(double) const override { return f_dot_result_; }
-  double do_f_dot_dot(double) const override { return f_dot_dot_result_; }
+  double do_f(double) const override {
+    ++num_evaluations_;
+    return f_result_;
+  }
+  double do_f_dot(double) const override {
+    ++num_evaluations_;
+    return f_dot_result_;
+  }
+  double do_f_dot_dot(double) const override {
+    ++num_evaluations_;
+    return f_dot_dot_result_;
+  }
+  void do_f_batch(const std::vector<double>&, std::vector<double>* images) const override {
+    ++num_batch_evaluations_;
+    std::fill(images->begin(), images->end(), f_result_);
+  }
+  void do_f_dot_batch(const std::vector<double>&, std::vector<double>* images) const override {
+    ++num_batch_evaluations_;
+    std::fill(images->begin(), images->end(), f_dot_result_);
+  }
+  void do_f_dot_dot_batch(const std::vector<double>&, std::vector<double>* images) const override {
+    ++num_batch_evaluations_;
+    std::fill(images->begin(), images->end(), f_dot_dot_result_);
+  }
   double do_p0() const override { return p0_result_; }
   double do_p1() const override { return p1_result_; }
   bool DoIsG1Contiguous() const override { return is_g1_contiguous_; }
@@ -69,6 +99,8 @@ class FunctionStub : public Function {
   const double p0_result_{};
   const double p1_result_{};
   const bool is_g1_contiguous_{};
+  mutable int num_evaluations_{0};
+  mutable int num_batch_evaluations_{0};
 };
 
 }  // namespace test
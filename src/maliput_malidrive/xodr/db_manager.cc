@@ -29,6 +29,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/xodr/db_manager.h"
 
+#include <mutex>
 #include <variant>
 
 #include <maliput/common/logger.h>
@@ -157,53 +158,41 @@ class DBManager::Impl {
 
   // @returns Data from the shortest gap between Geometries in the entire XODR description.
   const XodrGapBetweenGeometries& get_shortest_gap() const {
-    if (!shortest_gap_.has_value()) {
-      AnalyzeGapBetweenGeometries();
-    }
+    std::call_once(gaps_flag_, [this]() { AnalyzeGapBetweenGeometries(); });
     return shortest_gap_.value();
   }
 
   // @returns Data from the largest gap between Geometries in the entire XODR description.
   const XodrGapBetweenGeometries& get_largest_gap() const {
-    if (!largest_gap_.has_value()) {
-      AnalyzeGapBetweenGeometries();
-    }
+    std::call_once(gaps_flag_, [this]() { AnalyzeGapBetweenGeometries(); });
     return largest_gap_.value();
   }
 
   // @returns Data from the shortest gap between elevations in the entire XODR
   //          description.
   const XodrGapBetweenFunctions& get_shortest_elevation_gap() const {
-    if (!shortest_elevation_gap_.has_value()) {
-      AnalyzeGapBetweenElevationFunction();
-    }
+    std::call_once(elevation_gaps_flag_, [this]() { AnalyzeGapBetweenElevationFunction(); });
     return shortest_elevation_gap_.value();
   }
 
   // @returns Data from the largest gap between elevations in the entire XODR
   //          description.
   const XodrGapBetweenFunctions& get_largest_elevation_gap() const {
-    if (!largest_elevation_gap_.has_value()) {
-      AnalyzeGapBetweenElevationFunction();
-    }
+    std::call_once(elevation_gaps_flag_, [this]() { AnalyzeGapBetweenElevationFunction(); });
     return largest_elevation_gap_.value();
   }
 
   // @returns Data from the shortest gap between superelevations in the entire
   //          XODR description.
   const XodrGapBetweenFunctions& get_shortest_superelevation_gap() const {
-    if (!shortest_superelevation_gap_.has_value()) {
-      AnalyzeGapBetweenSuperelevationFunction();
-    }
+    std::call_once(superelevation_gaps_flag_, [this]() { AnalyzeGapBetweenSuperelevationFunction(); });
     return shortest_superelevation_gap_.value();
   }
 
   // @returns Data from the largest gap between superelevations in the entire
   //          XODR description.
   const XodrGapBetweenFunctions& get_largest_superelevation_gap() const {
-    if (!largest_superelevation_gap_.has_value()) {
-      AnalyzeGapBetweenSuperelevationFunction();
-    }
+    std::call_once(superelevation_gaps_flag_, [this]() { AnalyzeGapBetweenSuperelevationFunction(); });
     return largest_superelevation_gap_.value();
   }
 
@@ -884,6 +873,13 @@ class DBManager::Impl {
   XodrLaneSectionLengthData largest_lane_section_{RoadHeader::Id("none"), 0, 0.};
   // @}
 
+  // The gap analyses below are lazily computed from const getters. Each of them runs at most once, guarded by its
+  // std::once_flag, so concurrent readers of the same DBManager never race on the mutable caches. When an analysis
+  // throws, its flag is left unset and the next caller retries it.
+  mutable std::once_flag gaps_flag_;
+  mutable std::once_flag elevation_gaps_flag_;
+  mutable std::once_flag superelevation_gaps_flag_;
+
   // @{ Holds data of the shortest and largest gaps between geometries.
   mutable std::optional<XodrGapBetweenGeometries> shortest_gap_{std::nullopt};
   mutable std::optional<XodrGapBetweenGeometries> largest_gap_{std::nullopt};
@@ -56,6 +56,9 @@ namespace xodr {
 ///     @see LoadDataBaseFromFile LoadDataBaseFromStr.
 /// 2 - Query the data base, e.g.:
 ///     `manager->GetRoadHeaders();`
+///
+/// Once constructed, all the const queries are thread-safe: the lazily computed gap analyses are run exactly once even
+/// when several threads call their getters concurrently.
 class DBManager {
  public:
   MALIDRIVE_NO_COPY_NO_MOVE_NO_ASSIGN(DBManager);
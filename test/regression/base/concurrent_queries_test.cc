@@ -0,0 +1,272 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <cstddef>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/compare.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+
+#include "assert_compare.h"
+#include "maliput_malidrive/base/lane.h"
+#include "maliput_malidrive/base/road_geometry.h"
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/builder/road_network_builder.h"
+#include "maliput_malidrive/constants.h"
+#include "maliput_malidrive/test_utilities/road_geometry_configuration_for_xodrs.h"
+#include "maliput_malidrive/xodr/db_manager.h"
+#include "utility/resources.h"
+
+using malidrive::test::AssertCompare;
+using malidrive::test::GetRoadGeometryConfigurationFor;
+using maliput::api::IsInertialPositionClose;
+using maliput::api::IsLanePositionClose;
+using maliput::api::IsRotationClose;
+
+namespace malidrive {
+namespace tests {
+namespace {
+
+// Resource folder path defined via compile definition.
+static constexpr char kMalidriveResourceFolder[] = DEF_MALIDRIVE_RESOURCES;
+
+// Builds a RoadNetwork out of `xodr_file_name`, which must be listed in GetRoadGeometryConfigurationFor().
+std::unique_ptr<maliput::api::RoadNetwork> LoadRoadNetwork(const std::string& xodr_file_name) {
+  builder::RoadGeometryConfiguration road_geometry_configuration{
+      GetRoadGeometryConfigurationFor(xodr_file_name).value()};
+  road_geometry_configuration.opendrive_file =
+      utility::FindResourceInPath(road_geometry_configuration.opendrive_file, kMalidriveResourceFolder);
+  return builder::RoadNetworkBuilder(road_geometry_configuration.ToStringMap())();
+}
+
+// Holds the results of all the queries that are issued for a single LanePosition.
+struct QueryResults {
+  maliput::api::InertialPosition inertial_position;
+  maliput::api::Rotation orientation;
+  maliput::api::LanePositionResult lane_position_result;
+  maliput::api::RoadPositionResult road_position_result;
+};
+
+// Holds the results of the xodr::DBManager lazily computed analyses.
+struct GapResults {
+  double shortest_gap{};
+  double largest_gap{};
+  double shortest_elevation_gap{};
+  double largest_elevation_gap{};
+  double shortest_superelevation_gap{};
+  double largest_superelevation_gap{};
+};
+
+// Loads the same map twice: one RoadNetwork computes the expected results from a single thread and the other one is
+// shared by several threads. The shared RoadNetwork is not queried before the threads start, so they also race on
+// the lazily initialized caches.
+class ConcurrentQueriesTest : public ::testing::TestWithParam<std::string> {
+ protected:
+  // Number of threads that query the shared RoadNetwork at the same time.
+  static constexpr int kNumThreads{8};
+  // Number of times each thread runs the whole set of queries.
+  static constexpr int kNumRounds{3};
+  // Number of LanePositions sampled along each Lane.
+  static constexpr int kSamplesPerLane{5};
+
+  void SetUp() override {
+    reference_road_network_ = LoadRoadNetwork(GetParam());
+    shared_road_network_ = LoadRoadNetwork(GetParam());
+    ASSERT_NE(nullptr, dynamic_cast<const RoadGeometry*>(reference_road_network_->road_geometry()));
+    ASSERT_NE(nullptr, dynamic_cast<const RoadGeometry*>(shared_road_network_->road_geometry()));
+    for (const auto& lane_id_lane : reference_road_network_->road_geometry()->ById().GetLanes()) {
+      const maliput::api::Lane* lane = lane_id_lane.second;
+      for (int i = 0; i < kSamplesPerLane; ++i) {
+        const double s = lane->length() * static_cast<double>(i) / static_cast<double>(kSamplesPerLane - 1);
+        const double r = lane->lane_bounds(s).max() / 2.;
+        lane_ids_.push_back(lane->id());
+        lane_positions_.push_back(maliput::api::LanePosition(s, r, 0.));
+      }
+    }
+  }
+
+  // @returns The results of all the queries for the `index`-th sample against `road_network`.
+  QueryResults Query(const maliput::api::RoadNetwork& road_network, std::size_t index) const {
+    const maliput::api::RoadGeometry* road_geometry = road_network.road_geometry();
+    const maliput::api::Lane* lane = road_geometry->ById().GetLane(lane_ids_[index]);
+    const maliput::api::InertialPosition inertial_position = lane->ToInertialPosition(lane_positions_[index]);
+    return {inertial_position, lane->GetOrientation(lane_positions_[index]), lane->ToLanePosition(inertial_position),
+            road_geometry->ToRoadPosition(inertial_position)};
+  }
+
+  // @returns The results of the gap analyses of `road_network`'s xodr::DBManager.
+  static GapResults QueryGaps(const maliput::api::RoadNetwork& road_network) {
+    const xodr::DBManager* manager = dynamic_cast<const RoadGeometry*>(road_network.road_geometry())->get_manager();
+    return {manager->GetShortestGap().distance,
+            manager->GetLargestGap().distance,
+            manager->GetShortestElevationGap().distance,
+            manager->GetLargestElevationGap().distance,
+            manager->GetShortestSuperelevationGap().distance,
+            manager->GetLargestSuperelevationGap().distance};
+  }
+
+  std::unique_ptr<maliput::api::RoadNetwork> reference_road_network_;
+  std::unique_ptr<maliput::api::RoadNetwork> shared_road_network_;
+  std::vector<maliput::api::LaneId> lane_ids_;
+  std::vector<maliput::api::LanePosition> lane_positions_;
+};
+
+TEST_P(ConcurrentQueriesTest, MatchSingleThreadedResults) {
+  const double kTolerance{constants::kLinearTolerance};
+  const GapResults expected_gaps = QueryGaps(*reference_road_network_);
+  std::vector<QueryResults> expected_results;
+  std::vector<maliput::api::InertialPosition> inertial_positions;
+  for (std::size_t i = 0; i < lane_positions_.size(); ++i) {
+    expected_results.push_back(Query(*reference_road_network_, i));
+    inertial_positions.push_back(expected_results.back().inertial_position);
+  }
+
+  // Each thread collects its results, which are compared afterwards from the main thread.
+  struct ThreadResults {
+    GapResults gaps;
+    std::vector<QueryResults> results;
+    std::vector<maliput::api::RoadPositionResult> batch_results;
+  };
+  const auto* shared_road_geometry = dynamic_cast<const RoadGeometry*>(shared_road_network_->road_geometry());
+  std::vector<std::future<ThreadResults>> futures;
+  for (int thread = 0; thread < kNumThreads; ++thread) {
+    futures.push_back(std::async(std::launch::async, [&, thread]() {
+      ThreadResults thread_results;
+      thread_results.gaps = QueryGaps(*shared_road_network_);
+      thread_results.results.resize(lane_positions_.size());
+      thread_results.batch_results.resize(lane_positions_.size());
+      for (int round = 0; round < kNumRounds; ++round) {
+        // Every thread starts at a different sample to interleave the queries on each Lane.
+        for (std::size_t j = 0; j < lane_positions_.size(); ++j) {
+          const std::size_t i = (j + static_cast<std::size_t>(thread) * lane_positions_.size() / kNumThreads) %
+                                lane_positions_.size();
+          thread_results.results[i] = Query(*shared_road_network_, i);
+        }
+        shared_road_geometry->ToRoadPositions(inertial_positions, {}, 1, &thread_results.batch_results);
+      }
+      return thread_results;
+    }));
+  }
+
+  for (auto& future : futures) {
+    const ThreadResults thread_results = future.get();
+    EXPECT_EQ(expected_gaps.shortest_gap, thread_results.gaps.shortest_gap);
+    EXPECT_EQ(expected_gaps.largest_gap, thread_results.gaps.largest_gap);
+    EXPECT_EQ(expected_gaps.shortest_elevation_gap, thread_results.gaps.shortest_elevation_gap);
+    EXPECT_EQ(expected_gaps.largest_elevation_gap, thread_results.gaps.largest_elevation_gap);
+    EXPECT_EQ(expected_gaps.shortest_superelevation_gap, thread_results.gaps.shortest_superelevation_gap);
+    EXPECT_EQ(expected_gaps.largest_superelevation_gap, thread_results.gaps.largest_superelevation_gap);
+    for (std::size_t i = 0; i < expected_results.size(); ++i) {
+      const QueryResults& expected = expected_results[i];
+      const QueryResults& result = thread_results.results[i];
+      EXPECT_TRUE(AssertCompare(IsInertialPositionClose(expected.inertial_position, result.inertial_position,
+                                                        kTolerance)));
+      EXPECT_TRUE(AssertCompare(IsRotationClose(expected.orientation, result.orientation,
+                                                constants::kAngularTolerance)));
+      EXPECT_TRUE(AssertCompare(IsLanePositionClose(expected.lane_position_result.lane_position,
+                                                    result.lane_position_result.lane_position, kTolerance)));
+      EXPECT_NEAR(expected.lane_position_result.distance, result.lane_position_result.distance, kTolerance);
+      EXPECT_EQ(expected.road_position_result.road_position.lane->id(),
+                result.road_position_result.road_position.lane->id());
+      EXPECT_TRUE(AssertCompare(IsLanePositionClose(expected.road_position_result.road_position.pos,
+                                                    result.road_position_result.road_position.pos, kTolerance)));
+      EXPECT_NEAR(expected.road_position_result.distance, result.road_position_result.distance, kTolerance);
+      EXPECT_NEAR(expected.road_position_result.distance, thread_results.batch_results[i].distance, kTolerance);
+    }
+  }
+}
+
+// Threads query FindReachableLanes() with horizons that extend and shrink the cached ones, from every LaneEnd and in
+// a different order each, so they race on both the lookups and the stores of the cache.
+TEST_P(ConcurrentQueriesTest, FindReachableLanesMatchSingleThreadedResults) {
+  const std::vector<double> kHorizons{50., 200., 100., 400.};
+  const std::vector<maliput::api::LaneEnd::Which> kExitEnds{maliput::api::LaneEnd::kStart,
+                                                            maliput::api::LaneEnd::kFinish};
+  // Distance to each reachable Lane and entry LaneEnd.
+  using ReachableDistances = std::map<std::pair<maliput::api::LaneId, maliput::api::LaneEnd::Which>, double>;
+  // @returns The ReachableDistances of every sample, exit LaneEnd and horizon of `road_geometry`, queried in order
+  //          from the `offset`-th one.
+  const auto find_reachable_lanes = [&](const RoadGeometry& road_geometry, std::size_t offset) {
+    const std::size_t queries_per_sample = kExitEnds.size() * kHorizons.size();
+    std::vector<ReachableDistances> results(lane_ids_.size() * queries_per_sample);
+    std::vector<RoadGeometry::ReachableLane> reachable_lanes;
+    for (std::size_t j = 0; j < results.size(); ++j) {
+      const std::size_t i = (j + offset) % results.size();
+      const std::size_t sample = i / queries_per_sample;
+      road_geometry.FindReachableLanes(road_geometry.ById().GetLane(lane_ids_[sample]), lane_positions_[sample].s(),
+                                       kExitEnds[(i / kHorizons.size()) % kExitEnds.size()],
+                                       kHorizons[i % kHorizons.size()], &reachable_lanes);
+      for (const RoadGeometry::ReachableLane& reachable_lane : reachable_lanes) {
+        results[i][{reachable_lane.lane->id(), reachable_lane.entry_end}] = reachable_lane.distance;
+      }
+    }
+    return results;
+  };
+  const auto expected_results =
+      find_reachable_lanes(*dynamic_cast<const RoadGeometry*>(reference_road_network_->road_geometry()), 0);
+
+  const auto* shared_road_geometry = dynamic_cast<const RoadGeometry*>(shared_road_network_->road_geometry());
+  std::vector<std::future<std::vector<ReachableDistances>>> futures;
+  for (int thread = 0; thread < kNumThreads; ++thread) {
+    futures.push_back(std::async(std::launch::async, [&, thread]() {
+      return find_reachable_lanes(*shared_road_geometry,
+                                  static_cast<std::size_t>(thread) * expected_results.size() / kNumThreads);
+    }));
+  }
+
+  for (auto& future : futures) {
+    const auto results = future.get();
+    ASSERT_EQ(expected_results.size(), results.size());
+    for (std::size_t i = 0; i < expected_results.size(); ++i) {
+      ASSERT_EQ(expected_results[i].size(), results[i].size());
+      for (const auto& [key, expected_distance] : expected_results[i]) {
+        const auto it = results[i].find(key);
+        ASSERT_NE(results[i].end(), it);
+        EXPECT_NEAR(expected_distance, it->second, constants::kLinearTolerance);
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(ConcurrentQueriesTestGroup, ConcurrentQueriesTest,
+                        ::testing::Values("Figure8.xodr", "ParkingGarageRamp.xodr", "SShapeSuperelevatedRoad.xodr",
+                                          "TShapeRoad.xodr"));
+
+}  // namespace
+}  // namespace tests
+}  // namespace malidrive
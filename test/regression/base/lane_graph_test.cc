@@ -0,0 +1,178 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/base/lane_graph.h"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/branch_point.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+
+#include "maliput_malidrive/base/road_geometry.h"
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/builder/road_network_builder.h"
+#include "maliput_malidrive/constants.h"
+#include "maliput_malidrive/loader/loader.h"
+#include "utility/resources.h"
+
+namespace malidrive {
+namespace tests {
+namespace {
+
+// Resource folder path defined via compile definition.
+static constexpr char kMalidriveResourceFolder[] = DEF_MALIDRIVE_RESOURCES;
+
+class LaneGraphTest : public ::testing::Test {
+ protected:
+  const double kTolerance{constants::kLinearTolerance};
+
+  void SetUp() override {
+    builder::RoadGeometryConfiguration road_geometry_configuration;
+    road_geometry_configuration.id = maliput::api::RoadGeometryId("figure8_trafficlights");
+    road_geometry_configuration.opendrive_file =
+        utility::FindResourceInPath("figure8_trafficlights/figure8_trafficlights.xodr", kMalidriveResourceFolder);
+    road_network_ =
+        ::malidrive::loader::Load<::malidrive::builder::RoadNetworkBuilder>(road_geometry_configuration.ToStringMap());
+    const auto* road_geometry = dynamic_cast<const RoadGeometry*>(road_network_->road_geometry());
+    ASSERT_NE(nullptr, road_geometry);
+    dut_ = &road_geometry->lane_graph();
+  }
+
+  // @returns The index of the edge from `node` to `target` or -1 when there is none.
+  int FindEdge(int node, int target) const {
+    for (int edge_index = dut_->edges_begin(node); edge_index < dut_->edges_end(node); ++edge_index) {
+      if (dut_->edge_target(edge_index) == target) {
+        return edge_index;
+      }
+    }
+    return -1;
+  }
+
+  std::unique_ptr<maliput::api::RoadNetwork> road_network_;
+  const LaneGraph* dut_{};
+};
+
+TEST_F(LaneGraphTest, Topology) {
+  const maliput::api::RoadGeometry* road_geometry = road_network_->road_geometry();
+  ASSERT_EQ(static_cast<int>(road_geometry->ById().GetLanes().size()), dut_->num_lanes());
+  EXPECT_EQ(2 * dut_->num_lanes(), dut_->num_nodes());
+  EXPECT_THROW(dut_->LaneIndex(maliput::api::LaneId("non_existent")), maliput::common::assertion_error);
+  EXPECT_THROW(dut_->lane(dut_->num_lanes()), maliput::common::assertion_error);
+
+  for (int lane_index = 0; lane_index < dut_->num_lanes(); ++lane_index) {
+    const maliput::api::Lane* lane = dut_->lane(lane_index);
+    EXPECT_EQ(lane_index, dut_->LaneIndex(lane->id()));
+    EXPECT_DOUBLE_EQ(lane->length(), dut_->lane_length(lane_index));
+    for (const maliput::api::LaneEnd::Which entry_end :
+         {maliput::api::LaneEnd::kStart, maliput::api::LaneEnd::kFinish}) {
+      const int node = LaneGraph::NodeIndex(lane_index, entry_end);
+      EXPECT_EQ(lane_index, LaneGraph::LaneIndexOf(node));
+      EXPECT_EQ(entry_end, LaneGraph::EntryEndOf(node));
+
+      const maliput::api::LaneEndSet* ongoing_lanes = lane->GetOngoingBranches(
+          entry_end == maliput::api::LaneEnd::kStart ? maliput::api::LaneEnd::kFinish : maliput::api::LaneEnd::kStart);
+      const int num_ongoing_lanes = ongoing_lanes == nullptr ? 0 : ongoing_lanes->size();
+      const int num_adjacent_lanes = (lane->to_left() != nullptr ? 1 : 0) + (lane->to_right() != nullptr ? 1 : 0);
+      EXPECT_EQ(num_ongoing_lanes + num_adjacent_lanes, dut_->edges_end(node) - dut_->edges_begin(node));
+      for (int i = 0; i < num_ongoing_lanes; ++i) {
+        const maliput::api::LaneEnd& lane_end = ongoing_lanes->get(i);
+        const int edge_index = FindEdge(node, LaneGraph::NodeIndex(dut_->LaneIndex(lane_end.lane->id()), lane_end.end));
+        ASSERT_NE(-1, edge_index);
+        EXPECT_EQ(LaneGraph::EdgeType::kOngoing, dut_->edge_type(edge_index));
+        EXPECT_DOUBLE_EQ(lane->length(), dut_->edge_cost(edge_index));
+      }
+      if (lane->to_left() != nullptr) {
+        const int edge_index =
+            FindEdge(node, LaneGraph::NodeIndex(dut_->LaneIndex(lane->to_left()->id()), entry_end));
+        ASSERT_NE(-1, edge_index);
+        EXPECT_EQ(LaneGraph::EdgeType::kLaneChangeLeft, dut_->edge_type(edge_index));
+        EXPECT_GE(dut_->edge_cost(edge_index), LaneGraph::kDefaultLaneChangePenalty);
+      }
+    }
+  }
+}
+
+TEST_F(LaneGraphTest, FindRoute) {
+  LaneGraph::Workspace workspace(*dut_);
+  std::vector<int> route;
+  const int start_lane_index = dut_->LaneIndex(maliput::api::LaneId("1_0_-1"));
+  const int start_node = LaneGraph::NodeIndex(start_lane_index, maliput::api::LaneEnd::kStart);
+
+  // The start Lane is the goal.
+  std::optional<double> cost =
+      dut_->FindRoute(start_node, start_lane_index, LaneGraph::RouteAlgorithm::kAStar, &workspace, &route);
+  ASSERT_TRUE(cost.has_value());
+  EXPECT_EQ(0., cost.value());
+  EXPECT_EQ(std::vector<int>{start_node}, route);
+
+  // Both algorithms find routes of the same cost, and consecutive nodes are joined by an edge.
+  for (int goal_lane_index = 0; goal_lane_index < dut_->num_lanes(); ++goal_lane_index) {
+    const std::optional<double> dijkstra_cost =
+        dut_->FindRoute(start_node, goal_lane_index, LaneGraph::RouteAlgorithm::kDijkstra, &workspace, &route);
+    cost = dut_->FindRoute(start_node, goal_lane_index, LaneGraph::RouteAlgorithm::kAStar, &workspace, &route);
+    ASSERT_EQ(dijkstra_cost.has_value(), cost.has_value());
+    if (!cost.has_value()) {
+      EXPECT_TRUE(route.empty());
+      continue;
+    }
+    EXPECT_NEAR(dijkstra_cost.value(), cost.value(), kTolerance);
+    ASSERT_FALSE(route.empty());
+    EXPECT_EQ(start_node, route.front());
+    EXPECT_EQ(goal_lane_index, LaneGraph::LaneIndexOf(route.back()));
+    double route_cost{0.};
+    for (std::size_t i = 1; i < route.size(); ++i) {
+      const int edge_index = FindEdge(route[i - 1], route[i]);
+      ASSERT_NE(-1, edge_index);
+      route_cost += dut_->edge_cost(edge_index);
+    }
+    EXPECT_NEAR(cost.value(), route_cost, kTolerance);
+  }
+}
+
+TEST_F(LaneGraphTest, FindRouteThrows) {
+  LaneGraph::Workspace workspace(*dut_);
+  std::vector<int> route;
+  const LaneGraph::RouteAlgorithm kAlgorithm{LaneGraph::RouteAlgorithm::kAStar};
+  EXPECT_THROW(dut_->FindRoute(-1, 0, kAlgorithm, &workspace, &route), maliput::common::assertion_error);
+  EXPECT_THROW(dut_->FindRoute(dut_->num_nodes(), 0, kAlgorithm, &workspace, &route),
+               maliput::common::assertion_error);
+  EXPECT_THROW(dut_->FindRoute(0, dut_->num_lanes(), kAlgorithm, &workspace, &route),
+               maliput::common::assertion_error);
+  EXPECT_THROW(dut_->FindRoute(0, 0, kAlgorithm, nullptr, &route), maliput::common::assertion_error);
+  EXPECT_THROW(dut_->FindRoute(0, 0, kAlgorithm, &workspace, nullptr), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace tests
+}  // namespace malidrive
@@ -0,0 +1,130 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/base/lane_string_index.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+
+#include "maliput_malidrive/base/road_geometry.h"
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/builder/road_network_builder.h"
+#include "maliput_malidrive/test_utilities/road_geometry_configuration_for_xodrs.h"
+#include "utility/resources.h"
+
+using malidrive::test::GetRoadGeometryConfigurationFor;
+
+namespace malidrive {
+namespace tests {
+namespace {
+
+// Resource folder path defined via compile definition.
+static constexpr char kMalidriveResourceFolder[] = DEF_MALIDRIVE_RESOURCES;
+
+// LShapeRoad.xodr chains three Roads with a single Lane each and no Junctions, so there is one lane string per
+// direction that covers the three Lanes.
+class LaneStringIndexTest : public ::testing::Test {
+ protected:
+  const double kTolerance{1e-9};
+
+  void SetUp() override {
+    builder::RoadGeometryConfiguration road_geometry_configuration{
+        GetRoadGeometryConfigurationFor("LShapeRoad.xodr").value()};
+    road_geometry_configuration.opendrive_file =
+        utility::FindResourceInPath(road_geometry_configuration.opendrive_file, kMalidriveResourceFolder);
+    road_network_ = builder::RoadNetworkBuilder(road_geometry_configuration.ToStringMap())();
+    const auto* road_geometry = dynamic_cast<const RoadGeometry*>(road_network_->road_geometry());
+    ASSERT_NE(nullptr, road_geometry);
+    lane_graph_ = &road_geometry->lane_graph();
+    dut_ = &road_geometry->lane_string_index();
+  }
+
+  std::unique_ptr<maliput::api::RoadNetwork> road_network_;
+  const LaneGraph* lane_graph_{};
+  const LaneStringIndex* dut_{};
+};
+
+TEST_F(LaneStringIndexTest, LaneStrings) {
+  ASSERT_EQ(3, lane_graph_->num_lanes());
+  ASSERT_EQ(2, dut_->num_lane_strings());
+  const double kExpectedLength{lane_graph_->lane_length(0) + lane_graph_->lane_length(1) +
+                               lane_graph_->lane_length(2)};
+  for (int lane_string_index = 0; lane_string_index < dut_->num_lane_strings(); ++lane_string_index) {
+    EXPECT_EQ(3, dut_->nodes_end(lane_string_index) - dut_->nodes_begin(lane_string_index));
+    EXPECT_NEAR(kExpectedLength, dut_->lane_string_length(lane_string_index), kTolerance);
+    double s_offset{0.};
+    for (int position = dut_->nodes_begin(lane_string_index); position < dut_->nodes_end(lane_string_index);
+         ++position) {
+      const int node = dut_->node(position);
+      EXPECT_EQ(lane_string_index, dut_->LaneStringOf(node));
+      EXPECT_NEAR(s_offset, dut_->node_s_offset(position), kTolerance);
+      s_offset += lane_graph_->lane_length(LaneGraph::LaneIndexOf(node));
+    }
+  }
+  // Both lane strings run through the same Lanes in opposite directions.
+  const int forward_first_node = dut_->node(dut_->nodes_begin(0));
+  const int backward_last_node = dut_->node(dut_->nodes_end(1) - 1);
+  EXPECT_EQ(LaneGraph::LaneIndexOf(forward_first_node), LaneGraph::LaneIndexOf(backward_last_node));
+  EXPECT_NE(LaneGraph::EntryEndOf(forward_first_node), LaneGraph::EntryEndOf(backward_last_node));
+}
+
+TEST_F(LaneStringIndexTest, ToLaneSRoundTrip) {
+  const double kSStep{7.};
+  for (int lane_string_index = 0; lane_string_index < dut_->num_lane_strings(); ++lane_string_index) {
+    const double length = dut_->lane_string_length(lane_string_index);
+    for (double s = 0.; s <= length; s += kSStep) {
+      const LaneStringIndex::LaneS lane_s = dut_->ToLaneS(lane_string_index, s);
+      ASSERT_NE(nullptr, lane_s.lane);
+      EXPECT_EQ(lane_graph_->lane(LaneGraph::LaneIndexOf(lane_s.node)), lane_s.lane);
+      EXPECT_EQ(lane_string_index, dut_->LaneStringOf(lane_s.node));
+      EXPECT_GE(lane_s.s, 0.);
+      EXPECT_LE(lane_s.s, lane_s.lane->length());
+      EXPECT_NEAR(s, dut_->ToLaneStringS(lane_s.node, lane_s.s), kTolerance);
+    }
+    // The end of the lane string is the exit of its last node.
+    const LaneStringIndex::LaneS lane_s = dut_->ToLaneS(lane_string_index, length);
+    EXPECT_EQ(dut_->node(dut_->nodes_end(lane_string_index) - 1), lane_s.node);
+  }
+}
+
+TEST_F(LaneStringIndexTest, Throws) {
+  EXPECT_THROW(dut_->lane_string_length(dut_->num_lane_strings()), maliput::common::assertion_error);
+  EXPECT_THROW(dut_->ToLaneS(0, -1.), maliput::common::assertion_error);
+  EXPECT_THROW(dut_->ToLaneS(0, dut_->lane_string_length(0) + 1.), maliput::common::assertion_error);
+  EXPECT_THROW(dut_->LaneStringOf(lane_graph_->num_nodes()), maliput::common::assertion_error);
+  EXPECT_THROW(dut_->ToLaneStringS(-1, 0.), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace tests
+}  // namespace malidrive
@@ -29,9 +29,14 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/base/lane.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <maliput/api/compare.h>
@@ -41,6 +46,7 @@
 #include <maliput/geometry_base/junction.h>
 #include <maliput/geometry_base/road_geometry.h>
 #include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/saturate.h>
 
 #include "assert_compare.h"
 #include "maliput_malidrive/base/road_geometry.h"
@@ -53,6 +59,7 @@
 #include "maliput_malidrive/road_curve/line_ground_curve.h"
 #include "maliput_malidrive/road_curve/piecewise_ground_curve.h"
 #include "maliput_malidrive/road_curve/road_curve.h"
+#include "maliput_malidrive/road_curve/vector3_batch.h"
 #include "maliput_malidrive/xodr/db_manager.h"
 
 namespace malidrive {
@@ -216,6 +223,34 @@ TEST_F(LaneTest, ConstructorAssertions) {
                maliput::common::assertion_error);
 }
 
+TEST_F(LaneTest, GetArcLengthFunctions) {
+  const std::function<double(double)> kIdentity = [](double x) { return x; };
+
+  // The Lane integrates its own arc length mappings.
+  const Lane integrated_lane(kId, kXordTrack, kXodrLaneId, kElevationBounds, road_curve_.get(),
+                             MakeZeroCubicPolynomial(kP0, kP1, kLinearTolerance),
+                             MakeZeroCubicPolynomial(kP0, kP1, kLinearTolerance), kP0, kP1);
+  EXPECT_FALSE(integrated_lane.GetArcLengthFunctions().has_value());
+
+  // The arc length mappings are provided.
+  const Lane provided_lane(kId, kXordTrack, kXodrLaneId, kElevationBounds, road_curve_.get(),
+                           MakeZeroCubicPolynomial(kP0, kP1, kLinearTolerance),
+                           MakeZeroCubicPolynomial(kP0, kP1, kLinearTolerance), kP0, kP1, kIdentity, kIdentity);
+  const std::optional<Lane::ArcLengthFunctions> dut = provided_lane.GetArcLengthFunctions();
+  ASSERT_TRUE(dut.has_value());
+  EXPECT_DOUBLE_EQ(25., dut->s_from_p(25.));
+  EXPECT_DOUBLE_EQ(75., dut->p_from_s(75.));
+
+  // The arc length mappings are provided on the first geometric query.
+  const Lane lazy_lane(kId, kXordTrack, kXodrLaneId, kElevationBounds, road_curve_.get(),
+                       MakeZeroCubicPolynomial(kP0, kP1, kLinearTolerance),
+                       MakeZeroCubicPolynomial(kP0, kP1, kLinearTolerance), kP0, kP1,
+                       [kIdentity]() { return Lane::ArcLengthFunctions{kIdentity, kIdentity}; });
+  EXPECT_FALSE(lazy_lane.GetArcLengthFunctions().has_value());
+  EXPECT_NEAR(kP1 - kP0, lazy_lane.length(), kLinearTolerance);
+  EXPECT_TRUE(lazy_lane.GetArcLengthFunctions().has_value());
+}
+
 TEST_F(LaneTest, BasicLaneAccessors) {
   const Lane dut(kId, kXordTrack, kXodrLaneId, kElevationBounds, road_curve_.get(),
                  MakeZeroCubicPolynomial(kP0, kP1, kLinearTolerance),
@@ -496,6 +531,73 @@ TEST_F(MalidriveFlatLineLaneFullyInitializedTest, ToLanePosition) {
   //@}
 }
 
+TEST_F(MalidriveFlatLineLaneFullyInitializedTest, ToLanePositionStatus) {
+  const double kDistance{std::sqrt(2.)};
+  Lane::ProjectionStatus status{};
+  LanePositionResult expected_result;
+
+  expected_result.lane_position = LanePosition{kSHalf, kRLeft, kH};
+  expected_result.nearest_position = InertialPosition{37.577164466275356, 55.13351365237939, 0.};
+  expected_result.distance = 0.;
+  IsLanePositionResultClose(
+      expected_result,
+      dut_->ToLanePosition(expected_result.nearest_position, LanePosition{kSStart, kRCenterline, kH}, &status),
+      kLinearTolerance);
+  EXPECT_EQ(Lane::ProjectionStatus::kConverged, status);
+
+  // One meter before the start along both x and y axes, i.e. along the centerline.
+  expected_result.lane_position = LanePosition{kSStart, kRCenterline, kH};
+  expected_result.nearest_position = InertialPosition{2.9289321881345254, 19.071067811865476, 0.};
+  expected_result.distance = kDistance;
+  IsLanePositionResultClose(expected_result,
+                            dut_->ToLanePosition({1.9289321881345254, 18.071067811865476, 0.},
+                                                 LanePosition{kSHalf, kRCenterline, kH}, &status),
+                            kLinearTolerance);
+  EXPECT_EQ(Lane::ProjectionStatus::kSaturatedAtStart, status);
+
+  // One meter after the end along both x and y axes, i.e. along the centerline.
+  expected_result.lane_position = LanePosition{kSEnd, kRCenterline, kH};
+  expected_result.nearest_position = InertialPosition{73.63961030678928, 89.78174593052022, 0.};
+  expected_result.distance = kDistance;
+  IsLanePositionResultClose(expected_result,
+                            dut_->ToLanePosition({74.63961030678928, 90.78174593052022, 0.},
+                                                 LanePosition{kSHalf, kRCenterline, kH}, &status),
+                            kLinearTolerance);
+  EXPECT_EQ(Lane::ProjectionStatus::kSaturatedAtEnd, status);
+}
+
+TEST_F(MalidriveFlatLineLaneFullyInitializedTest, ToLanePositions) {
+  const road_curve::Vector3Batch kInertialPositions = []() {
+    road_curve::Vector3Batch inertial_positions;
+    inertial_positions.x = {37.577164466275356, 1.9289321881345254, 74.63961030678928};
+    inertial_positions.y = {55.13351365237939, 18.071067811865476, 90.78174593052022};
+    inertial_positions.z = {0., 0., 0.};
+    return inertial_positions;
+  }();
+  const std::vector<Lane::ProjectionStatus> kExpectedStatuses{Lane::ProjectionStatus::kConverged,
+                                                              Lane::ProjectionStatus::kSaturatedAtStart,
+                                                              Lane::ProjectionStatus::kSaturatedAtEnd};
+  road_curve::Vector3Batch lane_positions;
+  std::vector<double> distances;
+  std::vector<Lane::ProjectionStatus> statuses;
+  dut_->ToLanePositions(kInertialPositions, &lane_positions, &distances, &statuses);
+  ASSERT_EQ(kInertialPositions.size(), lane_positions.size());
+  ASSERT_EQ(kInertialPositions.size(), distances.size());
+  ASSERT_EQ(kInertialPositions.size(), statuses.size());
+  for (std::size_t i = 0; i < kInertialPositions.size(); ++i) {
+    const LanePositionResult expected_result = dut_->ToLanePosition(
+        InertialPosition(kInertialPositions.x[i], kInertialPositions.y[i], kInertialPositions.z[i]));
+    EXPECT_TRUE(AssertCompare(IsLanePositionClose(
+        expected_result.lane_position, LanePosition(lane_positions.x[i], lane_positions.y[i], lane_positions.z[i]),
+        kLinearTolerance)));
+    EXPECT_NEAR(expected_result.distance, distances[i], kLinearTolerance);
+    EXPECT_EQ(kExpectedStatuses[i], statuses[i]);
+  }
+
+  EXPECT_THROW(dut_->ToLanePositions(kInertialPositions, nullptr, &distances), maliput::common::assertion_error);
+  EXPECT_THROW(dut_->ToLanePositions(kInertialPositions, &lane_positions, nullptr), maliput::common::assertion_error);
+}
+
 TEST_F(MalidriveFlatLineLaneFullyInitializedTest, GetOrientation) {
   const Rotation kExpectedRotation = Rotation::FromRpy(/* roll */ 0., /* pitch */ 0., M_PI / 4.);
 
@@ -636,6 +738,18 @@ TEST_F(MalidriveFlatLineLaneFullyInitializedWithInertialToBackendFrameTranslatio
   //@}
 }
 
+TEST_F(MalidriveFlatLineLaneFullyInitializedWithInertialToBackendFrameTranslationTest, ToLanePositionWithHint) {
+  const double kDeltaS{0.1};
+  LanePositionResult expected_result;
+  expected_result.lane_position = LanePosition{kSEnd, kRCenterline, kH};
+  expected_result.nearest_position = InertialPosition{74.63961030678928, 91.78174593052022, 0.5};
+  expected_result.distance = 0.;
+  IsLanePositionResultClose(
+      expected_result,
+      dut_->ToLanePosition(expected_result.nearest_position, LanePosition{kSEnd - kDeltaS, kRCenterline, kH}),
+      kLinearTolerance);
+}
+
 // Initializes a single flat arc Lane in a single Junction - Segment environment.
 class MalidriveFlatArcLaneFullyInitializedTest : public LaneTest {
  protected:
@@ -806,6 +920,70 @@ TEST_F(MalidriveFlatArcLaneFullyInitializedTest, ToLanePosition) {
   //@}
 }
 
+// The hinted query must match the unhinted one when the hint is close to the
+// solution, as it happens when tracking an object.
+TEST_F(MalidriveFlatArcLaneFullyInitializedTest, ToLanePositionWithHint) {
+  const double kDeltaS{0.1};
+  LanePositionResult expected_result;
+
+  expected_result.lane_position = LanePosition{kSHalf, kRCenterline, kH};
+  expected_result.nearest_position = InertialPosition{54.711772824485934, 40.97529846801386, 0.};
+  expected_result.distance = 0.;
+  IsLanePositionResultClose(
+      expected_result,
+      dut_->ToLanePosition(expected_result.nearest_position, LanePosition{kSHalf + kDeltaS, kRCenterline, kH}),
+      kLinearTolerance);
+
+  expected_result.lane_position = LanePosition{kSHalf, kRLeft, kH};
+  expected_result.nearest_position = InertialPosition{54.913187957948104, 41.95480443737414, 0.};
+  IsLanePositionResultClose(
+      expected_result,
+      dut_->ToLanePosition(expected_result.nearest_position, LanePosition{kSHalf - kDeltaS, kRCenterline, kH}),
+      kLinearTolerance);
+
+  expected_result.lane_position = LanePosition{kSHalf, kRRight, kH};
+  expected_result.nearest_position = InertialPosition{54.3089425575616, 39.01628652929331, 0.};
+  IsLanePositionResultClose(
+      expected_result,
+      dut_->ToLanePosition(expected_result.nearest_position, LanePosition{kSHalf + kDeltaS, kRLeft, kH}),
+      kLinearTolerance);
+
+  // Hints out of the lane are saturated.
+  expected_result.lane_position = LanePosition{kSEnd, kRCenterline, kH};
+  expected_result.nearest_position = InertialPosition{94.29335591114437, -2.113986376104993, 0.};
+  IsLanePositionResultClose(
+      expected_result,
+      dut_->ToLanePosition(expected_result.nearest_position, LanePosition{kSEnd + kDeltaS, kRCenterline, kH}),
+      kLinearTolerance);
+}
+
+// Points scattered around the arc, some of them beyond its ends and its lane
+// bounds, must match the scalar projection.
+TEST_F(MalidriveFlatArcLaneFullyInitializedTest, ToLanePositions) {
+  road_curve::Vector3Batch inertial_positions;
+  for (double s = -10.; s <= kSEnd + 10.; s += 7.5) {
+    for (const double r : {2. * kRRight, kRCenterline, 2. * kRLeft}) {
+      const InertialPosition inertial_position =
+          dut_->ToInertialPosition({maliput::math::saturate(s, kSStart, kSEnd), r, kH});
+      inertial_positions.x.push_back(inertial_position.x() + (s < kSStart ? s : 0.));
+      inertial_positions.y.push_back(inertial_position.y());
+      inertial_positions.z.push_back(inertial_position.z() + 0.5);
+    }
+  }
+  road_curve::Vector3Batch lane_positions;
+  std::vector<double> distances;
+  dut_->ToLanePositions(inertial_positions, &lane_positions, &distances);
+  ASSERT_EQ(inertial_positions.size(), lane_positions.size());
+  for (std::size_t i = 0; i < inertial_positions.size(); ++i) {
+    const LanePositionResult expected_result = dut_->ToLanePosition(
+        InertialPosition(inertial_positions.x[i], inertial_positions.y[i], inertial_positions.z[i]));
+    EXPECT_TRUE(AssertCompare(IsLanePositionClose(
+        expected_result.lane_position, LanePosition(lane_positions.x[i], lane_positions.y[i], lane_positions.z[i]),
+        kLinearTolerance)));
+    EXPECT_NEAR(expected_result.distance, distances[i], kLinearTolerance);
+  }
+}
+
 TEST_F(MalidriveFlatArcLaneFullyInitializedTest, GetOrientation) {
   const Rotation kExpectedRotationSStart = Rotation::FromRpy(/* roll */ 0., /* pitch */ 0., kStartHeading);
   const Rotation kExpectedRotationSHalf =
@@ -995,6 +1173,30 @@ TEST_F(MalidriveFlatSLaneFullyInitializedTest, LaneSFromTrackS) {
   EXPECT_NEAR(kSEnd, dut_->LaneSFromTrackS(kP1), kLinearTolerance);
 }
 
+// Verifies that the estimates do not build the arc length mappings of a Lane
+// constructed with deferred mappings and that they match the built ones.
+TEST_F(MalidriveFlatSLaneFullyInitializedTest, EstimateLaneSFromTrackS) {
+  int num_builds{0};
+  const Lane dut(kId, kXordTrack, kXodrLaneId, kElevationBounds, road_curve_.get(),
+                 MakeConstantCubicPolynomial(kWidth, kP0, kP1, kLinearTolerance),
+                 MakeConstantCubicPolynomial(kLaneOffset, kP0, kP1, kLinearTolerance), kP0, kP1, [&num_builds]() {
+                   ++num_builds;
+                   return Lane::ArcLengthFunctions{};
+                 });
+
+  EXPECT_NEAR(kSStart, dut.EstimateLaneSFromTrackS(kP0), kLinearTolerance);
+  EXPECT_NEAR(kSHalf, dut.EstimateLaneSFromTrackS(kPForSHalf), kLinearTolerance);
+  EXPECT_NEAR(kSEnd, dut.EstimateLaneSFromTrackS(kP1), kLinearTolerance);
+  EXPECT_NEAR(kSEnd, dut.EstimateLength(), kLinearTolerance);
+  EXPECT_EQ(0, num_builds);
+
+  // Once built, the estimates are the arc length mappings.
+  const double length = dut.length();
+  EXPECT_EQ(1, num_builds);
+  EXPECT_EQ(length, dut.EstimateLength());
+  EXPECT_EQ(dut.LaneSFromTrackS(kPForSHalf), dut.EstimateLaneSFromTrackS(kPForSHalf));
+}
+
 TEST_F(MalidriveFlatSLaneFullyInitializedTest, Bounds) {
   // At the beginning of the lane.
   EXPECT_TRUE(AssertCompare(IsRBoundsClose({-kWidth / 2., kWidth / 2.}, dut_->lane_bounds(0.), kLinearTolerance)));
@@ -1184,6 +1386,214 @@ TEST_F(MalidriveFlatSLaneFullyInitializedTest, EvalMotionDerivatives) {
   //@}
 }
 
+// Holds the geometry of a Lane whose batched and safeguarded queries are checked against the scalar ones.
+struct LaneGeometryValues {
+  // Builds the GroundCurve of the Lane's RoadCurve.
+  std::function<std::unique_ptr<road_curve::GroundCurve>(double linear_tolerance, double angular_tolerance)>
+      make_ground_curve;
+  double linear_tolerance{1e-11};
+  // Elevation and superelevation are linear functions of p: @f$ F(p) = c p + d @f$.
+  // @{
+  double elevation_c{0.};
+  double elevation_d{0.};
+  double superelevation_c{0.};
+  double superelevation_d{0.};
+  // @}
+  Vector3 inertial_to_backend_frame_translation{0., 0., 0.};
+};
+
+// Returns a vector with the Lane geometries to evaluate the queries with.
+std::vector<LaneGeometryValues> InstantiateLaneGeometryParameters() {
+  const double kSqrt2Over2{std::sqrt(2.) / 2.};
+  return {
+      // Flat line Lane with a non-zero Inertial to Backend Frame translation.
+      {[=](double linear_tolerance, double) -> std::unique_ptr<road_curve::GroundCurve> {
+         const Vector2 kDXy{100. * kSqrt2Over2, 100. * kSqrt2Over2};
+         return std::make_unique<road_curve::LineGroundCurve>(linear_tolerance, Vector2{10., 12.}, kDXy, 0., 100.);
+       },
+       1e-11 /* linear_tolerance */, 0. /* elevation_c */, 0. /* elevation_d */, 0. /* superelevation_c */,
+       0. /* superelevation_d */, Vector3{1., 2., .5} /* inertial_to_backend_frame_translation */},
+
+      // Flat arc Lane.
+      {[](double linear_tolerance, double) -> std::unique_ptr<road_curve::GroundCurve> {
+         return std::make_unique<road_curve::ArcGroundCurve>(linear_tolerance, Vector2{10., 12.}, M_PI / 3., -0.025,
+                                                             100., 0., 100.);
+       }},
+
+      // Arc Lane with linear elevation and superelevation.
+      {[](double linear_tolerance, double) -> std::unique_ptr<road_curve::GroundCurve> {
+         return std::make_unique<road_curve::ArcGroundCurve>(linear_tolerance, Vector2{10., 12.}, M_PI / 3., -0.025,
+                                                             100., 0., 100.);
+       },
+       1e-11 /* linear_tolerance */, 0.05 /* elevation_c */, 1. /* elevation_d */, 0.002 /* superelevation_c */,
+       0.05 /* superelevation_d */},
+
+      // Flat 'S' shape Lane whose RoadCurve is a PiecewiseGroundCurve, so the batch is evaluated piece by piece.
+      {[](double linear_tolerance, double angular_tolerance) -> std::unique_ptr<road_curve::GroundCurve> {
+         std::vector<std::unique_ptr<road_curve::GroundCurve>> ground_curves;
+         ground_curves.push_back(std::make_unique<road_curve::ArcGroundCurve>(linear_tolerance, Vector2{5., -100.}, 0.,
+                                                                              1. / 50., 50. * M_PI, 20., 120.));
+         ground_curves.push_back(std::make_unique<road_curve::LineGroundCurve>(linear_tolerance, Vector2{5., 0.},
+                                                                               Vector2{-10., 0.}, 10., 20.));
+         ground_curves.push_back(std::make_unique<road_curve::ArcGroundCurve>(linear_tolerance, Vector2{-5., 0.}, M_PI,
+                                                                              -1. / 50., 50. * M_PI, 40., 140.));
+         return std::make_unique<road_curve::PiecewiseGroundCurve>(std::move(ground_curves), linear_tolerance,
+                                                                   angular_tolerance);
+       },
+       // TODO(#460): Error when increasing linear tolerance.
+       1e-6 /* linear_tolerance */},
+  };
+}
+
+// Initializes a single Lane in a single Junction - Segment environment out of LaneGeometryValues.
+class MalidriveLaneGeometryTest : public ::testing::TestWithParam<LaneGeometryValues> {
+ protected:
+  void SetUp() override {
+    const LaneGeometryValues& values = GetParam();
+    linear_tolerance_ = values.linear_tolerance;
+    auto manager = xodr::LoadDataBaseFromStr(kXODRHeaderTemplate, kParserConfiguration);
+    road_geometry_ = std::make_unique<RoadGeometry>(maliput::api::RoadGeometryId("sample_rg"), std::move(manager),
+                                                    linear_tolerance_, kAngularTolerance, kScaleLength,
+                                                    values.inertial_to_backend_frame_translation);
+    auto ground_curve = values.make_ground_curve(linear_tolerance_, kAngularTolerance);
+    const double p0 = ground_curve->p0();
+    const double p1 = ground_curve->p1();
+    road_curve_ = std::make_unique<road_curve::RoadCurve>(
+        linear_tolerance_, kScaleLength, std::move(ground_curve),
+        MakeCubicPolynomial(0., 0., values.elevation_c, values.elevation_d, p0, p1, linear_tolerance_),
+        MakeCubicPolynomial(0., 0., values.superelevation_c, values.superelevation_d, p0, p1, linear_tolerance_),
+        kAssertContiguity);
+    reference_line_offset_ = MakeZeroCubicPolynomial(p0, p1, linear_tolerance_);
+    const road_curve::RoadCurve* road_curve_ptr = road_curve_.get();
+    const road_curve::Function* reference_line_offset_ptr = reference_line_offset_.get();
+    auto junction = std::make_unique<Junction>(maliput::api::JunctionId{"dut"});
+    auto segment =
+        std::make_unique<Segment>(maliput::api::SegmentId{"dut"}, road_curve_ptr, reference_line_offset_ptr, p0, p1);
+    auto lane = std::make_unique<Lane>(kId, kXordTrack, kXodrLaneId, kElevationBounds, road_curve_ptr,
+                                       MakeConstantCubicPolynomial(kWidth, p0, p1, linear_tolerance_),
+                                       MakeConstantCubicPolynomial(kLaneOffset, p0, p1, linear_tolerance_), p0, p1);
+    constexpr bool kNotHideLane{false};
+    dut_ = segment->AddLane(std::move(lane), kNotHideLane);
+    junction->AddSegment(std::move(segment));
+    road_geometry_->AddJunction(std::move(junction));
+  }
+
+  const maliput::api::LaneId kId{"dut"};
+  const int kXordTrack{1};
+  const int kXodrLaneId{5};
+  const maliput::api::HBounds kElevationBounds{0., 5.};
+  const double kAngularTolerance{1e-6};
+  const double kScaleLength{1.};
+  const double kWidth{5.};
+  const double kLaneOffset{10.};
+  const std::optional<double> kParserSTolerance{std::nullopt};  // Disables the check because it is not needed.
+  const xodr::ParserConfiguration kParserConfiguration{kParserSTolerance};
+  const bool kAssertContiguity{true};
+  const double kRCenterline{0.};
+  const double kRLeft{1.};
+  const double kRRight{-2.};
+  const double kH{0.5};
+  double linear_tolerance_{};
+  std::unique_ptr<RoadGeometry> road_geometry_;
+  std::unique_ptr<road_curve::RoadCurve> road_curve_;
+  std::unique_ptr<road_curve::Function> reference_line_offset_;
+  const Lane* dut_{};
+};
+
+TEST_P(MalidriveLaneGeometryTest, ToInertialPositions) {
+  const double s_end = dut_->length();
+  road_curve::Vector3Batch lane_positions;
+  for (const double s : {0., s_end / 4., s_end / 2., 3. * s_end / 4., s_end}) {
+    for (const double r : {kRRight, kRCenterline, kRLeft}) {
+      lane_positions.x.push_back(s);
+      lane_positions.y.push_back(r);
+      lane_positions.z.push_back(kH);
+    }
+  }
+  road_curve::Vector3Batch inertial_positions;
+  dut_->ToInertialPositions(lane_positions, &inertial_positions);
+  ASSERT_EQ(lane_positions.size(), inertial_positions.size());
+  for (std::size_t i = 0; i < lane_positions.size(); ++i) {
+    const InertialPosition expected_position =
+        dut_->ToInertialPosition({lane_positions.x[i], lane_positions.y[i], lane_positions.z[i]});
+    EXPECT_TRUE(AssertCompare(IsInertialPositionClose(
+        expected_position, InertialPosition(inertial_positions.x[i], inertial_positions.y[i], inertial_positions.z[i]),
+        linear_tolerance_)));
+  }
+
+  lane_positions.x.front() = s_end + 1.;
+  EXPECT_THROW(dut_->ToInertialPositions(lane_positions, &inertial_positions), maliput::common::assertion_error);
+  EXPECT_THROW(dut_->ToInertialPositions(lane_positions, nullptr), maliput::common::assertion_error);
+}
+
+// The search of ToLanePosition() must find the same LanePosition as road_curve::RoadCurve::WInverse()'s Newton
+// iterations, which converge within the Lane.
+TEST_P(MalidriveLaneGeometryTest, ToLanePositionMatchesWInverse) {
+  // Both searches stop once a step is within the linear tolerance, but only WInverse() applies that last step.
+  const double kTolerance{std::max(linear_tolerance_, 1e-9)};
+  const Vector3 kInertialToBackendFrameTranslation = GetParam().inertial_to_backend_frame_translation;
+  const double s_end = dut_->length();
+  for (const double s : {s_end / 8., s_end / 4., s_end / 2., 3. * s_end / 4., 7. * s_end / 8.}) {
+    for (const double r : {kRRight, kRCenterline, kRLeft}) {
+      const InertialPosition inertial_position = dut_->ToInertialPosition({s, r, kH});
+      const Vector3 prh = road_curve_->WInverse(inertial_position.xyz() - kInertialToBackendFrameTranslation);
+      const LanePosition expected_lane_position{dut_->LaneSFromTrackS(prh.x()), prh.y() - kLaneOffset, prh.z()};
+
+      EXPECT_TRUE(AssertCompare(IsLanePositionClose(
+          expected_lane_position, dut_->ToLanePosition(inertial_position).lane_position, kTolerance)));
+      // The hint is near the solution, as in the query of a tracked position.
+      Lane::ProjectionStatus status{};
+      const LanePositionResult result =
+          dut_->ToLanePosition(inertial_position, LanePosition{s + s_end / 16., kRCenterline, 0.}, &status);
+      EXPECT_TRUE(AssertCompare(IsLanePositionClose(expected_lane_position, result.lane_position, kTolerance)));
+      EXPECT_NEAR(0., result.distance, kTolerance);
+      EXPECT_EQ(Lane::ProjectionStatus::kConverged, status);
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(MalidriveLaneGeometryGroup, MalidriveLaneGeometryTest,
+                        ::testing::ValuesIn(InstantiateLaneGeometryParameters()));
+
+// The RoadCurve turns 90 degrees at `kCornerP` without G1 contiguity. Outside of the corner, the projection onto the
+// s-axis jumps from positive to negative there, so ToLanePosition() bisects towards the corner until the bounds of its
+// bracket are consecutive doubles. The linear tolerance is smaller than the spacing of doubles around the corner, so
+// the search runs out of iterations and keeps its last iterate.
+GTEST_TEST(LaneProjectionTest, MaxIterationsReached) {
+  const double kLinearTolerance{1e-17};
+  const double kAngularTolerance{M_PI};
+  const double kScaleLength{1.};
+  const double kCornerP{100.};
+  const double kWidth{5.};
+  std::vector<std::unique_ptr<road_curve::GroundCurve>> ground_curves;
+  ground_curves.push_back(std::make_unique<road_curve::LineGroundCurve>(kLinearTolerance, Vector2{0., 0.},
+                                                                        Vector2{kCornerP, 0.}, 0., kCornerP));
+  ground_curves.push_back(std::make_unique<road_curve::LineGroundCurve>(kLinearTolerance, Vector2{kCornerP, 0.},
+                                                                        Vector2{0., kCornerP}, 0., kCornerP));
+  auto ground_curve = std::make_unique<road_curve::PiecewiseGroundCurve>(std::move(ground_curves), kLinearTolerance,
+                                                                         kAngularTolerance);
+  const double p1 = ground_curve->p1();
+  const road_curve::RoadCurve road_curve(kLinearTolerance, kScaleLength, std::move(ground_curve),
+                                         MakeZeroCubicPolynomial(0., p1, kLinearTolerance),
+                                         MakeZeroCubicPolynomial(0., p1, kLinearTolerance),
+                                         true /* assert_contiguity */);
+  // The GroundCurve is parameterized by arc length, so the Lane's `s` and `p` are the same and no integration with
+  // such a small tolerance is needed.
+  const std::function<double(double)> kIdentity = [](double x) { return x; };
+  const Lane dut(maliput::api::LaneId{"dut"}, 1 /* xodr_track */, -1 /* xodr_lane_id */,
+                 maliput::api::HBounds{0., 5.}, &road_curve,
+                 MakeConstantCubicPolynomial(kWidth, 0., p1, kLinearTolerance),
+                 MakeZeroCubicPolynomial(0., p1, kLinearTolerance), 0., p1, kIdentity, kIdentity);
+
+  Lane::ProjectionStatus status{};
+  const LanePositionResult result =
+      dut.ToLanePosition({kCornerP + 10., -10., 0.}, LanePosition{0., 0., 0.}, &status);
+  EXPECT_EQ(Lane::ProjectionStatus::kMaxIterationsReached, status);
+  // The bisection fallback leaves the last iterate at the corner, where the position is on the right of both lines.
+  EXPECT_NEAR(kCornerP, result.lane_position.s(), 1e-12);
+  EXPECT_DOUBLE_EQ(-kWidth / 2., result.lane_position.r());
+}
+
 // Hold elevation values and expected values.
 struct ElevationValues {
   // Elevation Cubic polynomial. @f$ F(p) = a p^3 + b p^2 + c p + d @f$.
@@ -0,0 +1,157 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/base/lane_tracker.h"
+
+#include <memory>
+#include <optional>
+
+#include <gtest/gtest.h>
+#include <maliput/api/branch_point.h>
+#include <maliput/api/compare.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+
+#include "assert_compare.h"
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/builder/road_network_builder.h"
+#include "maliput_malidrive/constants.h"
+#include "maliput_malidrive/loader/loader.h"
+#include "utility/resources.h"
+
+using malidrive::test::AssertCompare;
+using maliput::api::IsLanePositionClose;
+
+namespace malidrive {
+namespace tests {
+namespace {
+
+// Resource folder path defined via compile definition.
+static constexpr char kMalidriveResourceFolder[] = DEF_MALIDRIVE_RESOURCES;
+
+class LaneTrackerTest : public ::testing::Test {
+ protected:
+  const double kTolerance{constants::kLinearTolerance};
+  const maliput::api::LaneId kLaneId{"1_0_-1"};
+
+  void SetUp() override {
+    builder::RoadGeometryConfiguration road_geometry_configuration;
+    road_geometry_configuration.id = maliput::api::RoadGeometryId("figure8_trafficlights");
+    road_geometry_configuration.opendrive_file =
+        utility::FindResourceInPath("figure8_trafficlights/figure8_trafficlights.xodr", kMalidriveResourceFolder);
+    road_network_ =
+        ::malidrive::loader::Load<::malidrive::builder::RoadNetworkBuilder>(road_geometry_configuration.ToStringMap());
+    lane_ = dynamic_cast<const Lane*>(road_network_->road_geometry()->ById().GetLane(kLaneId));
+    ASSERT_NE(nullptr, lane_);
+  }
+
+  std::unique_ptr<maliput::api::RoadNetwork> road_network_;
+  const Lane* lane_{};
+};
+
+TEST_F(LaneTrackerTest, Constructor) {
+  EXPECT_THROW(LaneTracker(nullptr, maliput::api::LanePosition(0., 0., 0.)), maliput::common::assertion_error);
+
+  const LaneTracker dut(lane_, maliput::api::LanePosition(lane_->length() + 1., 0.5, 0.));
+  EXPECT_EQ(lane_, dut.lane());
+  EXPECT_TRUE(AssertCompare(IsLanePositionClose(maliput::api::LanePosition(lane_->length(), 0.5, 0.),
+                                                dut.lane_position(), kTolerance)));
+  EXPECT_DOUBLE_EQ(lane_->TrackSFromLaneS(lane_->length()), dut.track_s());
+}
+
+TEST_F(LaneTrackerTest, UpdateWithinLane) {
+  const double kSStep{0.5};
+  LaneTracker dut(lane_, maliput::api::LanePosition(10., 0., 0.));
+  for (double s = 10.; s < 20.; s += kSStep) {
+    const maliput::api::LanePosition expected_position(s, 0.3, 0.);
+    const maliput::api::RoadPositionResult result = dut.Update(lane_->ToInertialPosition(expected_position));
+    EXPECT_EQ(lane_, result.road_position.lane);
+    EXPECT_TRUE(AssertCompare(IsLanePositionClose(expected_position, result.road_position.pos, kTolerance)));
+    EXPECT_NEAR(0., result.distance, kTolerance);
+    EXPECT_NEAR(lane_->TrackSFromLaneS(s), dut.track_s(), kTolerance);
+  }
+}
+
+// Drives past the end of a Lane whose finish has a single ongoing Lane.
+TEST_F(LaneTrackerTest, UpdateIntoOngoingLane) {
+  const Lane* lane{};
+  std::optional<maliput::api::LaneEnd> ongoing_lane_end;
+  for (const auto& lane_id_lane : road_network_->road_geometry()->ById().GetLanes()) {
+    const maliput::api::LaneEndSet* ongoing_lanes =
+        lane_id_lane.second->GetOngoingBranches(maliput::api::LaneEnd::kFinish);
+    if (ongoing_lanes != nullptr && ongoing_lanes->size() == 1 && lane_id_lane.second->length() > 10. &&
+        ongoing_lanes->get(0).lane->length() > 10.) {
+      lane = dynamic_cast<const Lane*>(lane_id_lane.second);
+      ongoing_lane_end = ongoing_lanes->get(0);
+      break;
+    }
+  }
+  ASSERT_NE(nullptr, lane);
+  ASSERT_TRUE(ongoing_lane_end.has_value());
+  const maliput::api::Lane* ongoing_lane = ongoing_lane_end->lane;
+
+  LaneTracker dut(lane, maliput::api::LanePosition(lane->length() - 5., 0., 0.));
+  for (double ds = 1.; ds <= 5.; ds += 1.) {
+    const double s = ongoing_lane_end->end == maliput::api::LaneEnd::kStart ? ds : ongoing_lane->length() - ds;
+    const maliput::api::LanePosition expected_position(s, 0., 0.);
+    const maliput::api::RoadPositionResult result = dut.Update(ongoing_lane->ToInertialPosition(expected_position));
+    EXPECT_EQ(ongoing_lane->id(), result.road_position.lane->id());
+    EXPECT_EQ(ongoing_lane->id(), dut.lane()->id());
+    EXPECT_TRUE(AssertCompare(IsLanePositionClose(expected_position, dut.lane_position(), kTolerance)));
+    EXPECT_NEAR(0., result.distance, kTolerance);
+  }
+}
+
+TEST_F(LaneTrackerTest, UpdateIntoAdjacentLane) {
+  const maliput::api::Lane* left_lane = lane_->to_left();
+  ASSERT_NE(nullptr, left_lane);
+  const double kS{lane_->length() / 2.};
+  const maliput::api::LanePosition expected_position(
+      dynamic_cast<const Lane*>(left_lane)->LaneSFromTrackS(lane_->TrackSFromLaneS(kS)), 0., 0.);
+
+  LaneTracker dut(lane_, maliput::api::LanePosition(kS, 0., 0.));
+  const maliput::api::RoadPositionResult result = dut.Update(left_lane->ToInertialPosition(expected_position));
+  EXPECT_EQ(left_lane->id(), result.road_position.lane->id());
+  EXPECT_EQ(left_lane->id(), dut.lane()->id());
+  EXPECT_TRUE(AssertCompare(IsLanePositionClose(expected_position, dut.lane_position(), kTolerance)));
+  EXPECT_NEAR(0., result.distance, kTolerance);
+}
+
+TEST_F(LaneTrackerTest, UpdateOffRoad) {
+  LaneTracker dut(lane_, maliput::api::LanePosition(10., 0., 0.));
+  const maliput::api::RoadPositionResult result = dut.Update(maliput::api::InertialPosition(1000., 1000., 0.));
+  EXPECT_NE(nullptr, result.road_position.lane);
+  EXPECT_GT(result.distance, kTolerance);
+}
+
+}  // namespace
+}  // namespace tests
+}  // namespace malidrive
@@ -29,9 +29,15 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/base/road_geometry.h"
 
+#include <map>
 #include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
+#include <maliput/api/branch_point.h>
 #include <maliput/api/compare.h>
 #include <maliput/common/assertion_error.h>
 
@@ -111,6 +117,23 @@ TEST_F(RoadGeometryTest, CorrectRoadCharacteristics) {
   EXPECT_EQ(expected_reference_line_offset_ptr, rg->GetReferenceLineOffset(kRoadId));
 }
 
+TEST_F(RoadGeometryTest, SharedRoadCharacteristics) {
+  auto rg = std::make_unique<RoadGeometry>(RoadGeometryId("sample_rg"), std::move(manager), kLinearTolerance,
+                                           kAngularTolerance, kScaleLength, kInertialToBackendFrameTranslation);
+  const auto expected_road_curve_ptr = road_curve.get();
+  const auto expected_reference_line_offset_ptr = reference_line_offset.get();
+  rg->AddRoadCharacteristics(kRoadId, std::move(road_curve), std::move(reference_line_offset));
+  EXPECT_FALSE(rg->FindRoadCharacteristics(xodr::RoadHeader::Id("unknown")).has_value());
+  const std::optional<RoadGeometry::RoadCharacteristics> dut = rg->FindRoadCharacteristics(kRoadId);
+  ASSERT_TRUE(dut.has_value());
+  EXPECT_EQ(expected_road_curve_ptr, dut->road_curve.get());
+  EXPECT_EQ(expected_reference_line_offset_ptr, dut->reference_line_offset.get());
+  // The RoadCurve and the reference line offset outlive the RoadGeometry.
+  rg.reset();
+  EXPECT_EQ(1, dut->road_curve.use_count());
+  EXPECT_EQ(1, dut->reference_line_offset.use_count());
+}
+
 TEST_F(RoadGeometryTest, InvalidRoadCurve) {
   auto rg = std::make_unique<RoadGeometry>(RoadGeometryId("sample_rg"), std::move(manager), kLinearTolerance,
                                            kAngularTolerance, kScaleLength, kInertialToBackendFrameTranslation);
@@ -207,6 +230,137 @@ TEST_F(RoadGeometryFigure8Trafficlights, RoundTripPositionAtTheEnd) {
   EXPECT_TRUE(AssertCompare(IsLanePositionClose(position, result.road_position.pos, constants::kLinearTolerance)));
 }
 
+TEST_F(RoadGeometryFigure8Trafficlights, ToRoadPositionsMatchesToRoadPosition) {
+  const auto* rg = dynamic_cast<const RoadGeometry*>(road_network_->road_geometry());
+  ASSERT_NE(nullptr, rg);
+  const maliput::api::Lane* lane = rg->ById().GetLane(maliput::api::LaneId("1_0_-1"));
+  std::vector<maliput::api::InertialPosition> inertial_positions;
+  for (double s = 0.; s < lane->length(); s += 7.) {
+    inertial_positions.push_back(lane->ToInertialPosition({s, 0.5, 0.}));
+  }
+  // Off-road position, all Lanes must be compared.
+  inertial_positions.push_back(maliput::api::InertialPosition(1000., 1000., 0.));
+  std::vector<maliput::api::RoadPositionResult> expected_results;
+  for (const auto& inertial_position : inertial_positions) {
+    expected_results.push_back(rg->ToRoadPosition(inertial_position));
+  }
+
+  for (const std::size_t num_threads : {1u, 4u}) {
+    std::vector<maliput::api::RoadPositionResult> results(inertial_positions.size());
+    rg->ToRoadPositions(inertial_positions, {}, num_threads, &results);
+    for (std::size_t i = 0; i < inertial_positions.size(); ++i) {
+      EXPECT_EQ(expected_results[i].road_position.lane->id(), results[i].road_position.lane->id());
+      EXPECT_TRUE(AssertCompare(IsLanePositionClose(expected_results[i].road_position.pos,
+                                                    results[i].road_position.pos, constants::kLinearTolerance)));
+      EXPECT_NEAR(expected_results[i].distance, results[i].distance, constants::kLinearTolerance);
+    }
+  }
+}
+
+TEST_F(RoadGeometryFigure8Trafficlights, ToRoadPositionsWithHints) {
+  const auto* rg = dynamic_cast<const RoadGeometry*>(road_network_->road_geometry());
+  ASSERT_NE(nullptr, rg);
+  const maliput::api::Lane* lane = rg->ById().GetLane(maliput::api::LaneId("1_0_-1"));
+  const maliput::api::LanePosition position(80., 0., 0.);
+  const std::vector<maliput::api::InertialPosition> inertial_positions{lane->ToInertialPosition(position),
+                                                                       lane->ToInertialPosition(position)};
+  const std::vector<std::optional<maliput::api::RoadPosition>> hints{
+      maliput::api::RoadPosition(lane, maliput::api::LanePosition(79., 0., 0.)), std::nullopt};
+  std::vector<maliput::api::RoadPositionResult> results(inertial_positions.size());
+  rg->ToRoadPositions(inertial_positions, hints, 1, &results);
+  for (const auto& result : results) {
+    EXPECT_EQ(lane->id(), result.road_position.lane->id());
+    EXPECT_TRUE(AssertCompare(IsLanePositionClose(position, result.road_position.pos, constants::kLinearTolerance)));
+  }
+}
+
+TEST_F(RoadGeometryFigure8Trafficlights, ToRoadPositionsThrows) {
+  const auto* rg = dynamic_cast<const RoadGeometry*>(road_network_->road_geometry());
+  ASSERT_NE(nullptr, rg);
+  const std::vector<maliput::api::InertialPosition> inertial_positions(2);
+  std::vector<maliput::api::RoadPositionResult> results(inertial_positions.size());
+  std::vector<maliput::api::RoadPositionResult> wrong_size_results(1);
+  const std::vector<std::optional<maliput::api::RoadPosition>> wrong_size_hints(1);
+  EXPECT_THROW(rg->ToRoadPositions(inertial_positions, {}, 1, nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(rg->ToRoadPositions(inertial_positions, {}, 1, &wrong_size_results), maliput::common::assertion_error);
+  EXPECT_THROW(rg->ToRoadPositions(inertial_positions, wrong_size_hints, 1, &results),
+               maliput::common::assertion_error);
+  EXPECT_THROW(rg->ToRoadPositions(inertial_positions, {}, 0, &results), maliput::common::assertion_error);
+}
+
+// Computes the Lanes reachable within `horizon` from the `exit_end` of `lane` by relaxing the ongoing branches until
+// no distance improves.
+std::map<std::pair<maliput::api::LaneId, maliput::api::LaneEnd::Which>, double> BruteForceReachableLanes(
+    const maliput::api::Lane* lane, maliput::api::LaneEnd::Which exit_end, double distance_to_exit, double horizon) {
+  std::map<std::pair<maliput::api::LaneId, maliput::api::LaneEnd::Which>, double> distances;
+  std::vector<std::tuple<const maliput::api::Lane*, maliput::api::LaneEnd::Which, double>> pending{
+      {lane, exit_end, distance_to_exit}};
+  while (!pending.empty()) {
+    const auto [from_lane, from_exit_end, from_distance] = pending.back();
+    pending.pop_back();
+    const maliput::api::LaneEndSet* ongoing_lanes = from_lane->GetOngoingBranches(from_exit_end);
+    for (int i = 0; ongoing_lanes != nullptr && i < ongoing_lanes->size(); ++i) {
+      const maliput::api::LaneEnd& lane_end = ongoing_lanes->get(i);
+      const auto key = std::make_pair(lane_end.lane->id(), lane_end.end);
+      const auto it = distances.find(key);
+      if (from_distance > horizon || (it != distances.end() && it->second <= from_distance)) {
+        continue;
+      }
+      distances[key] = from_distance;
+      const maliput::api::LaneEnd::Which ongoing_exit_end = lane_end.end == maliput::api::LaneEnd::kStart
+                                                                ? maliput::api::LaneEnd::kFinish
+                                                                : maliput::api::LaneEnd::kStart;
+      pending.push_back({lane_end.lane, ongoing_exit_end, from_distance + lane_end.lane->length()});
+    }
+  }
+  return distances;
+}
+
+TEST_F(RoadGeometryFigure8Trafficlights, FindReachableLanes) {
+  const auto* rg = dynamic_cast<const RoadGeometry*>(road_network_->road_geometry());
+  ASSERT_NE(nullptr, rg);
+  const maliput::api::Lane* lane = rg->ById().GetLane(maliput::api::LaneId("1_0_-1"));
+  const double kS{lane->length() - 1.};
+  std::vector<RoadGeometry::ReachableLane> reachable_lanes;
+
+  for (const maliput::api::LaneEnd::Which exit_end : {maliput::api::LaneEnd::kStart, maliput::api::LaneEnd::kFinish}) {
+    const double distance_to_exit = exit_end == maliput::api::LaneEnd::kFinish ? lane->length() - kS : kS;
+    // Increasing horizons use the cache, extend it, and use it again with a shorter horizon.
+    for (const double horizon : {50., 200., 400., 100.}) {
+      rg->FindReachableLanes(lane, kS, exit_end, horizon, &reachable_lanes);
+      const auto expected_distances = BruteForceReachableLanes(lane, exit_end, distance_to_exit, horizon);
+      ASSERT_EQ(expected_distances.size(), reachable_lanes.size());
+      for (std::size_t i = 0; i < reachable_lanes.size(); ++i) {
+        const RoadGeometry::ReachableLane& reachable_lane = reachable_lanes[i];
+        const auto it = expected_distances.find(std::make_pair(reachable_lane.lane->id(), reachable_lane.entry_end));
+        ASSERT_NE(expected_distances.end(), it);
+        EXPECT_NEAR(it->second, reachable_lane.distance, constants::kLinearTolerance);
+        EXPECT_LE(reachable_lane.distance, horizon);
+        if (i > 0) {
+          EXPECT_LE(reachable_lanes[i - 1].distance, reachable_lane.distance);
+        }
+      }
+    }
+  }
+
+  // The horizon ends before the exit of the Lane.
+  rg->FindReachableLanes(lane, kS, maliput::api::LaneEnd::kFinish, 0.5, &reachable_lanes);
+  EXPECT_TRUE(reachable_lanes.empty());
+}
+
+TEST_F(RoadGeometryFigure8Trafficlights, FindReachableLanesThrows) {
+  const auto* rg = dynamic_cast<const RoadGeometry*>(road_network_->road_geometry());
+  ASSERT_NE(nullptr, rg);
+  const maliput::api::Lane* lane = rg->ById().GetLane(maliput::api::LaneId("1_0_-1"));
+  std::vector<RoadGeometry::ReachableLane> reachable_lanes;
+  EXPECT_THROW(rg->FindReachableLanes(nullptr, 0., maliput::api::LaneEnd::kFinish, 10., &reachable_lanes),
+               maliput::common::assertion_error);
+  EXPECT_THROW(rg->FindReachableLanes(lane, 0., maliput::api::LaneEnd::kFinish, 10., nullptr),
+               maliput::common::assertion_error);
+  EXPECT_THROW(rg->FindReachableLanes(lane, 0., maliput::api::LaneEnd::kFinish, -1., &reachable_lanes),
+               maliput::common::assertion_error);
+}
+
 // TODO(francocipollone): Adds tests for ToRoadPosition and FindRoadPosition methods
 //                        when MalidriveLoader, MalidriveBuilder and MalidriveLane classes are implemented.
 
@@ -31,11 +31,15 @@
 
 #include <cmath>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <maliput/common/assertion_error.h>
+#include <maliput/math/vector.h>
 
+#include "maliput_malidrive/base/lane.h"
 #include "maliput_malidrive/road_curve/cubic_polynomial.h"
 #include "maliput_malidrive/road_curve/function.h"
 #include "maliput_malidrive/road_curve/line_ground_curve.h"
@@ -46,11 +50,17 @@ namespace test {
 namespace {
 
 using maliput::math::Vector2;
+using maliput::math::Vector3;
 
 std::unique_ptr<road_curve::Function> MakeZeroCubicPolynomial(double p0, double p1, double linear_tolerance) {
   return std::make_unique<road_curve::CubicPolynomial>(0., 0., 0., 0., p0, p1, linear_tolerance);
 }
 
+std::unique_ptr<road_curve::Function> MakeConstantCubicPolynomial(double d, double p0, double p1,
+                                                                  double linear_tolerance) {
+  return std::make_unique<road_curve::CubicPolynomial>(0., 0., 0., d, p0, p1, linear_tolerance);
+}
+
 class SegmentTest : public ::testing::Test {
  protected:
   const maliput::api::SegmentId kId{"dut"};
@@ -96,6 +106,50 @@ TEST_F(SegmentTest, ReferenceLineOffset) {
   EXPECT_EQ(reference_line_offset_.get(), dut.reference_line_offset());
 }
 
+// Evaluates a Segment with three lanes (the middle one hidden) on a flat and
+// straight road whose reference line goes from (10, 10) with a 45° heading.
+TEST_F(SegmentTest, EvalCrossSection) {
+  const double kWidth{3.};
+  const maliput::api::HBounds kElevationBounds{0., 5.};
+  const double kTolerance{1e-12};
+  // Lane s values are obtained by numerical integration.
+  const double kSTolerance{1e-8};
+  Segment dut(kId, road_curve_.get(), reference_line_offset_.get(), kP0, kP1);
+  const std::vector<double> kLaneOffsets{-kWidth, 0., kWidth};
+  const std::vector<bool> kHideLane{false, true, false};
+  for (int i = 0; i < static_cast<int>(kLaneOffsets.size()); ++i) {
+    dut.AddLane(std::make_unique<Lane>(maliput::api::LaneId{"lane_" + std::to_string(i)}, 1 /* xodr_track */,
+                                       i - 1 /* xodr_lane_id */, kElevationBounds, road_curve_.get(),
+                                       MakeConstantCubicPolynomial(kWidth, kP0, kP1, kLinearTolerance),
+                                       MakeConstantCubicPolynomial(kLaneOffsets[i], kP0, kP1, kLinearTolerance),
+                                       kP0, kP1),
+                kHideLane[i]);
+  }
+
+  const double kP{25.};
+  const Segment::CrossSection cross_section = dut.EvalCrossSection(kP);
+  EXPECT_EQ(kP, cross_section.p);
+  ASSERT_EQ(2, static_cast<int>(cross_section.lanes.size()));
+
+  const Vector3 kRHat{-std::sqrt(2.) / 2., std::sqrt(2.) / 2., 0.};
+  const Vector3 kOrigin{kXy0.x() + kDXy.x() * kP / kP1, kXy0.y() + kDXy.y() * kP / kP1, 0.};
+  const std::vector<double> kVisibleLaneOffsets{kLaneOffsets[0], kLaneOffsets[2]};
+  for (int i = 0; i < static_cast<int>(cross_section.lanes.size()); ++i) {
+    const Segment::LaneCrossSection& lane_cross_section = cross_section.lanes[i];
+    EXPECT_EQ(dut.lane(i), lane_cross_section.lane);
+    EXPECT_NEAR(kP, lane_cross_section.s, kSTolerance);
+    EXPECT_NEAR(kVisibleLaneOffsets[i], lane_cross_section.r_offset, kTolerance);
+    EXPECT_NEAR(kWidth, lane_cross_section.width, kTolerance);
+    const Vector3 expected_position = kOrigin + kVisibleLaneOffsets[i] * kRHat;
+    EXPECT_NEAR(expected_position.x(), lane_cross_section.inertial_position.x(), kTolerance);
+    EXPECT_NEAR(expected_position.y(), lane_cross_section.inertial_position.y(), kTolerance);
+    EXPECT_NEAR(expected_position.z(), lane_cross_section.inertial_position.z(), kTolerance);
+  }
+
+  EXPECT_THROW(dut.EvalCrossSection(kP0 - 1.), maliput::common::assertion_error);
+  EXPECT_THROW(dut.EvalCrossSection(kP1 + 1.), maliput::common::assertion_error);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace malidrive
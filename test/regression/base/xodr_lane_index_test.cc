@@ -0,0 +1,208 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/base/xodr_lane_index.h"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+
+#include "maliput_malidrive/base/road_geometry.h"
+#include "maliput_malidrive/builder/road_geometry_builder.h"
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/builder/road_network_builder.h"
+#include "maliput_malidrive/test_utilities/road_geometry_configuration_for_xodrs.h"
+#include "maliput_malidrive/xodr/db_manager.h"
+#include "utility/resources.h"
+
+using malidrive::test::GetRoadGeometryConfigurationFor;
+
+namespace malidrive {
+namespace tests {
+namespace {
+
+// Resource folder path defined via compile definition.
+static constexpr char kMalidriveResourceFolder[] = DEF_MALIDRIVE_RESOURCES;
+
+// LineMultipleSections.xodr has a single Road split in several LaneSections.
+class XodrLaneIndexTest : public ::testing::Test {
+ protected:
+  const double kTolerance{1e-9};
+
+  void SetUp() override {
+    builder::RoadGeometryConfiguration road_geometry_configuration{
+        GetRoadGeometryConfigurationFor("LineMultipleSections.xodr").value()};
+    road_geometry_configuration.opendrive_file =
+        utility::FindResourceInPath(road_geometry_configuration.opendrive_file, kMalidriveResourceFolder);
+    road_network_ = builder::RoadNetworkBuilder(road_geometry_configuration.ToStringMap())();
+    road_geometry_ = dynamic_cast<const RoadGeometry*>(road_network_->road_geometry());
+    ASSERT_NE(nullptr, road_geometry_);
+    dut_ = &road_geometry_->xodr_lane_index();
+    for (const auto& id_lane : road_geometry_->ById().GetLanes()) {
+      const auto* lane = dynamic_cast<const Lane*>(id_lane.second);
+      ASSERT_NE(nullptr, lane);
+      lanes_.push_back(lane);
+    }
+    ASSERT_FALSE(lanes_.empty());
+  }
+
+  std::unique_ptr<maliput::api::RoadNetwork> road_network_;
+  const RoadGeometry* road_geometry_{};
+  const XodrLaneIndex* dut_{};
+  std::vector<const Lane*> lanes_;
+};
+
+TEST_F(XodrLaneIndexTest, FindLane) {
+  for (const Lane* lane : lanes_) {
+    const double track_s_mid = (lane->get_track_s_start() + lane->get_track_s_end()) / 2.;
+    EXPECT_EQ(lane, dut_->FindLane(lane->get_track(), track_s_mid, lane->get_lane_id()));
+    // At the boundary between two LaneSections the latter is used, so the start always maps to `lane`.
+    EXPECT_EQ(lane, dut_->FindLane(lane->get_track(), lane->get_track_s_start(), lane->get_lane_id()));
+  }
+}
+
+TEST_F(XodrLaneIndexTest, FindLaneMisses) {
+  const Lane* lane = lanes_.front();
+  double track_s_min{lane->get_track_s_start()};
+  double track_s_max{lane->get_track_s_end()};
+  for (const Lane* other_lane : lanes_) {
+    if (other_lane->get_track() == lane->get_track()) {
+      track_s_min = std::min(track_s_min, other_lane->get_track_s_start());
+      track_s_max = std::max(track_s_max, other_lane->get_track_s_end());
+    }
+  }
+  const double track_s_mid = (lane->get_track_s_start() + lane->get_track_s_end()) / 2.;
+  EXPECT_EQ(nullptr, dut_->FindLane(-1, track_s_mid, lane->get_lane_id()));
+  EXPECT_EQ(nullptr, dut_->FindLane(lane->get_track(), track_s_mid, 1000));
+  EXPECT_EQ(nullptr, dut_->FindLane(lane->get_track(), track_s_min - 1., lane->get_lane_id()));
+  EXPECT_EQ(nullptr, dut_->FindLane(lane->get_track(), track_s_max + 1., lane->get_lane_id()));
+  EXPECT_FALSE(dut_->ToRoadPosition({-1, track_s_mid, lane->get_lane_id(), 0.}).has_value());
+}
+
+// The LaneSection of LineMultipleSections.xodr that starts at track s 33.3 is edited so all its Lanes are
+// non-drivable. They are omitted, so that LaneSection has no Lanes in the XodrLaneIndex.
+TEST_F(XodrLaneIndexTest, FindLaneInLaneSectionWithoutLanes) {
+  builder::RoadGeometryConfiguration road_geometry_configuration{
+      GetRoadGeometryConfigurationFor("LineMultipleSections.xodr").value()};
+  road_geometry_configuration.omit_nondrivable_lanes = true;
+  std::ifstream file(utility::FindResourceInPath(road_geometry_configuration.opendrive_file, kMalidriveResourceFolder));
+  ASSERT_TRUE(file.is_open());
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  std::string xodr_description = buffer.str();
+  const std::size_t lane_section_begin = xodr_description.find("<laneSection s=\"33.3\">");
+  const std::size_t lane_section_end = xodr_description.find("</laneSection>", lane_section_begin);
+  ASSERT_NE(std::string::npos, lane_section_end);
+  for (const std::string& lane : {std::string("<lane id=\"1\" "), std::string("<lane id=\"-1\" ")}) {
+    const std::string kFrom{lane + "type=\"driving\""};
+    const std::size_t position = xodr_description.find(kFrom, lane_section_begin);
+    ASSERT_LT(position, lane_section_end);
+    xodr_description.replace(position, kFrom.size(), lane + "type=\"sidewalk\"");
+  }
+  const std::unique_ptr<const maliput::api::RoadGeometry> rg = builder::RoadGeometryBuilder(
+      xodr::LoadDataBaseFromStr(xodr_description, {road_geometry_configuration.tolerances.linear_tolerance.value()}),
+      road_geometry_configuration)();
+  const auto* road_geometry = dynamic_cast<const RoadGeometry*>(rg.get());
+  ASSERT_NE(nullptr, road_geometry);
+  const XodrLaneIndex& dut = road_geometry->xodr_lane_index();
+
+  const int kTrackId{1};
+  const int kLaneId{-1};
+  const Lane* first_lane = dut.FindLane(kTrackId, 10., kLaneId);
+  ASSERT_NE(nullptr, first_lane);
+  EXPECT_EQ(nullptr, dut.FindLane(kTrackId, 50., kLaneId));
+  EXPECT_FALSE(dut.ToRoadPosition({kTrackId, 50., kLaneId, 0.}).has_value());
+  // The end of the first LaneSection is still found within the linear tolerance.
+  EXPECT_EQ(first_lane, dut.FindLane(kTrackId, first_lane->get_track_s_end(), kLaneId));
+  const Lane* last_lane = dut.FindLane(kTrackId, 90., kLaneId);
+  ASSERT_NE(nullptr, last_lane);
+  EXPECT_NE(first_lane, last_lane);
+}
+
+TEST_F(XodrLaneIndexTest, RoundTrip) {
+  for (const Lane* lane : lanes_) {
+    const maliput::api::LanePosition lane_position(lane->length() / 3., 0.25, 0.);
+    const XodrLaneIndex::XodrLanePosition xodr_lane_position = XodrLaneIndex::ToXodrLanePosition(lane, lane_position);
+    EXPECT_EQ(lane->get_track(), xodr_lane_position.track_id);
+    EXPECT_EQ(lane->get_lane_id(), xodr_lane_position.lane_id);
+    EXPECT_NEAR(lane->TrackSFromLaneS(lane_position.s()), xodr_lane_position.track_s, kTolerance);
+    EXPECT_NEAR(lane_position.r(), xodr_lane_position.offset, kTolerance);
+
+    const std::optional<maliput::api::RoadPosition> road_position = dut_->ToRoadPosition(xodr_lane_position);
+    ASSERT_TRUE(road_position.has_value());
+    EXPECT_EQ(lane, road_position->lane);
+    EXPECT_NEAR(lane_position.s(), road_position->pos.s(), kTolerance);
+    EXPECT_NEAR(lane_position.r(), road_position->pos.r(), kTolerance);
+    EXPECT_NEAR(0., road_position->pos.h(), kTolerance);
+  }
+}
+
+TEST_F(XodrLaneIndexTest, Batches) {
+  std::vector<maliput::api::RoadPosition> road_positions;
+  for (const Lane* lane : lanes_) {
+    road_positions.push_back({lane, maliput::api::LanePosition(lane->length() / 2., -0.5, 0.)});
+  }
+  std::vector<XodrLaneIndex::XodrLanePosition> xodr_lane_positions;
+  XodrLaneIndex::ToXodrLanePositions(road_positions, &xodr_lane_positions);
+  ASSERT_EQ(road_positions.size(), xodr_lane_positions.size());
+  std::vector<std::optional<maliput::api::RoadPosition>> dut_road_positions;
+  dut_->ToRoadPositions(xodr_lane_positions, &dut_road_positions);
+  ASSERT_EQ(road_positions.size(), dut_road_positions.size());
+  for (std::size_t i = 0; i < road_positions.size(); ++i) {
+    const XodrLaneIndex::XodrLanePosition expected_xodr_lane_position = XodrLaneIndex::ToXodrLanePosition(
+        dynamic_cast<const Lane*>(road_positions[i].lane), road_positions[i].pos);
+    EXPECT_EQ(expected_xodr_lane_position.track_id, xodr_lane_positions[i].track_id);
+    EXPECT_EQ(expected_xodr_lane_position.lane_id, xodr_lane_positions[i].lane_id);
+    EXPECT_NEAR(expected_xodr_lane_position.track_s, xodr_lane_positions[i].track_s, kTolerance);
+    EXPECT_NEAR(expected_xodr_lane_position.offset, xodr_lane_positions[i].offset, kTolerance);
+    ASSERT_TRUE(dut_road_positions[i].has_value());
+    EXPECT_EQ(road_positions[i].lane, dut_road_positions[i]->lane);
+    EXPECT_NEAR(road_positions[i].pos.s(), dut_road_positions[i]->pos.s(), kTolerance);
+    EXPECT_NEAR(road_positions[i].pos.r(), dut_road_positions[i]->pos.r(), kTolerance);
+  }
+}
+
+TEST_F(XodrLaneIndexTest, Throws) {
+  EXPECT_THROW(XodrLaneIndex::ToXodrLanePosition(nullptr, {}), maliput::common::assertion_error);
+  EXPECT_THROW(dut_->ToRoadPositions({}, nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(XodrLaneIndex::ToXodrLanePositions({}, nullptr), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace tests
+}  // namespace malidrive
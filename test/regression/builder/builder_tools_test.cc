@@ -29,7 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/builder/builder_tools.h"
 
+#include <map>
 #include <memory>
+#include <set>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -187,6 +189,73 @@ TEST_F(SolveLaneEndsInnerLaneSectionTest, TestMethod) {
   }
 }
 
+// Creates two Roads, 1 and 2, with one Lane each. The end of Road 1 is linked to the start of Road 2.
+// The goal is to verify that SolveLaneEndsForConnectingRoad() skips the XODR Roads which are not being built.
+class SolveLaneEndsForConnectingRoadTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    lane_2 = std::make_unique<maliput::api::test::MockLane>(maliput::api::LaneId("2_0_1"));
+    auto mock_rg =
+        std::make_unique<maliput::api::test::MockRoadGeometry>(maliput::api::RoadGeometryId("RoadGeometryTest"));
+    mock_rg->GetIdIndex()->add_lane_to_map(lane_2->id(), lane_2.get());
+    rg = std::move(mock_rg);
+
+    const xodr::Geometry kGeometry{0., {0., 0.}, 0.0, 100., xodr::Geometry::Type::kLine, xodr::Geometry::Line{}};
+    const xodr::Lane kCenterLane{xodr::Lane::Id("0"), xodr::Lane::Type::kDriving, false, {}, {}};
+    const xodr::LaneLink kLaneLink1{
+        std::nullopt /* predecessor */,
+        xodr::LaneLink::LinkAttributes{xodr::LaneLink::LinkAttributes::Id{"1"}} /* successor */};
+    const xodr::Lane kLeftLane1{xodr::Lane::Id("1"), xodr::Lane::Type::kDriving, false, kLaneLink1, {}};
+    const xodr::Lane kLeftLane2{xodr::Lane::Id("1"), xodr::Lane::Type::kDriving, false, {}, {}};
+    const xodr::Lanes kLanes1{{{}}, {{xodr::LaneSection{0., std::nullopt, {kLeftLane1}, kCenterLane, {}}}}};
+    const xodr::Lanes kLanes2{{{}}, {{xodr::LaneSection{0., std::nullopt, {kLeftLane2}, kCenterLane, {}}}}};
+    const xodr::RoadLink kRoadLink1{
+        std::nullopt /* predecessor */,
+        xodr::RoadLink::LinkAttributes{xodr::RoadLink::ElementType::kRoad, xodr::RoadLink::LinkAttributes::Id("2"),
+                                       xodr::RoadLink::ContactPoint::kStart} /* successor */};
+    road_headers.emplace(
+        xodr::RoadHeader::Id("1"),
+        xodr::RoadHeader{"Road1", 100., xodr::RoadHeader::Id("1"), "-1", std::nullopt, kRoadLink1, {}, {{{kGeometry}}},
+                         kLanes1});
+    road_headers.emplace(xodr::RoadHeader::Id("2"),
+                         xodr::RoadHeader{"Road2", 100., xodr::RoadHeader::Id("2"), "-1", std::nullopt, {}, {},
+                                          {{{kGeometry}}}, kLanes2});
+  }
+
+  MalidriveXodrLaneProperties GetRoad1LaneProperties() const {
+    const xodr::RoadHeader& road_header = road_headers.at(xodr::RoadHeader::Id("1"));
+    const xodr::LaneSection* lane_section{&road_header.lanes.lanes_section[0]};
+    return MalidriveXodrLaneProperties(&road_header, lane_section, 0, &lane_section->left_lanes[0]);
+  }
+
+  std::unique_ptr<maliput::api::Lane> lane_2;
+  std::unique_ptr<maliput::api::RoadGeometry> rg;
+  std::map<xodr::RoadHeader::Id, xodr::RoadHeader> road_headers;
+};
+
+TEST_F(SolveLaneEndsForConnectingRoadTest, AllRoadsBuilt) {
+  const auto lane_ends =
+      SolveLaneEndsForConnectingRoad(rg.get(), GetRoad1LaneProperties(), road_headers, XodrConnectionType::kSuccessor);
+  ASSERT_EQ(1u, lane_ends.size());
+  EXPECT_TRUE(maliput::api::LaneEnd(lane_2.get(), maliput::api::LaneEnd::Which::kStart) == lane_ends[0]);
+}
+
+TEST_F(SolveLaneEndsForConnectingRoadTest, LinkedRoadNotBuilt) {
+  const std::set<xodr::RoadHeader::Id> kBuiltRoadIds{xodr::RoadHeader::Id("1")};
+  EXPECT_TRUE(SolveLaneEndsForConnectingRoad(rg.get(), GetRoad1LaneProperties(), road_headers,
+                                             XodrConnectionType::kSuccessor, kBuiltRoadIds)
+                  .empty());
+}
+
+TEST_F(SolveLaneEndsForConnectingRoadTest, MissingLinkedRoad) {
+  road_headers.erase(xodr::RoadHeader::Id("2"));
+  const std::set<xodr::RoadHeader::Id> kBuiltRoadIds{xodr::RoadHeader::Id("1")};
+  // Links to XODR Roads that are not in the XODR description are still errors.
+  EXPECT_THROW(SolveLaneEndsForConnectingRoad(rg.get(), GetRoad1LaneProperties(), road_headers,
+                                              XodrConnectionType::kSuccessor, kBuiltRoadIds),
+               maliput::common::assertion_error);
+}
+
 GTEST_TEST(LaneTravelDirection, NonCompleteXmlNode) {
   // Empty string.
   EXPECT_EQ(LaneTravelDirection("").GetXodrTravelDir(), LaneTravelDirection::Direction::kUndefined);
@@ -0,0 +1,271 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/builder/conflict_zones.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/branch_point.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/assertion_error.h>
+
+#include "maliput_malidrive/base/road_geometry.h"
+#include "maliput_malidrive/builder/road_geometry_builder.h"
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/constants.h"
+#include "maliput_malidrive/test_utilities/road_geometry_configuration_for_xodrs.h"
+#include "maliput_malidrive/xodr/db_manager.h"
+#include "utility/resources.h"
+
+namespace malidrive {
+namespace builder {
+namespace test {
+namespace {
+
+using malidrive::test::GetRoadGeometryConfigurationFor;
+
+// Resource folder path defined via compile definition.
+static constexpr char kMalidriveResourceFolder[] = DEF_MALIDRIVE_RESOURCES;
+
+class ConflictZonesTest : public ::testing::Test {
+ protected:
+  // Number of samples along each axis of a ConflictZone when looking for a point shared by both Lanes.
+  static constexpr int kNumSamples{11};
+
+  void SetUp() override {
+    auto manager = xodr::LoadDataBaseFromFile(
+        utility::FindResourceInPath(road_geometry_configuration_.opendrive_file, kMalidriveResourceFolder),
+        {road_geometry_configuration_.tolerances.linear_tolerance});
+    rg_ = RoadGeometryBuilder(std::move(manager), road_geometry_configuration_)();
+    ASSERT_NE(rg_, nullptr);
+    linear_tolerance_ = rg_->linear_tolerance();
+  }
+
+  // @returns True when a point of `lane_a` within `s_range_a` lies on `lane_b` within `s_range_b`.
+  bool HaveSharedPoint(const maliput::api::Lane* lane_a, const maliput::api::SRange& s_range_a,
+                       const maliput::api::Lane* lane_b, const maliput::api::SRange& s_range_b) const {
+    for (int i = 0; i < kNumSamples; ++i) {
+      const double s = s_range_a.s0() + (s_range_a.s1() - s_range_a.s0()) * i / (kNumSamples - 1);
+      const maliput::api::RBounds bounds = lane_a->lane_bounds(s);
+      for (int j = 0; j < kNumSamples; ++j) {
+        const double r = bounds.min() + (bounds.max() - bounds.min()) * j / (kNumSamples - 1);
+        const maliput::api::LanePositionResult result =
+            lane_b->ToLanePosition(lane_a->ToInertialPosition({s, r, 0.}));
+        if (result.distance <= linear_tolerance_ && result.lane_position.s() >= s_range_b.s0() - linear_tolerance_ &&
+            result.lane_position.s() <= s_range_b.s1() + linear_tolerance_) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  const RoadGeometryConfiguration road_geometry_configuration_{
+      GetRoadGeometryConfigurationFor("TShapeRoad.xodr").value()};
+  std::unique_ptr<const maliput::api::RoadGeometry> rg_;
+  double linear_tolerance_{};
+};
+
+TEST_F(ConflictZonesTest, Throws) {
+  EXPECT_THROW(FindConflictZones(nullptr, linear_tolerance_), maliput::common::assertion_error);
+  EXPECT_THROW(FindConflictZones(rg_->junction(0), 0.), maliput::common::assertion_error);
+  EXPECT_THROW(FindConflictZones(rg_->junction(0), -linear_tolerance_), maliput::common::assertion_error);
+}
+
+TEST_F(ConflictZonesTest, ConflictZonesOverlap) {
+  int num_conflict_zones{0};
+  for (int i = 0; i < rg_->num_junctions(); ++i) {
+    const maliput::api::Junction* junction = rg_->junction(i);
+    const std::vector<ConflictZone> dut = FindConflictZones(junction, linear_tolerance_);
+    for (const ConflictZone& conflict_zone : dut) {
+      ASSERT_NE(conflict_zone.lane_a, nullptr);
+      ASSERT_NE(conflict_zone.lane_b, nullptr);
+      EXPECT_EQ(conflict_zone.lane_a->segment()->junction(), junction);
+      EXPECT_EQ(conflict_zone.lane_b->segment()->junction(), junction);
+      EXPECT_NE(conflict_zone.lane_a->segment(), conflict_zone.lane_b->segment());
+      EXPECT_LE(0., conflict_zone.s_range_a.s0());
+      EXPECT_LE(conflict_zone.s_range_a.s0(), conflict_zone.s_range_a.s1());
+      EXPECT_LE(conflict_zone.s_range_a.s1(), conflict_zone.lane_a->length());
+      EXPECT_LE(0., conflict_zone.s_range_b.s0());
+      EXPECT_LE(conflict_zone.s_range_b.s0(), conflict_zone.s_range_b.s1());
+      EXPECT_LE(conflict_zone.s_range_b.s1(), conflict_zone.lane_b->length());
+      EXPECT_TRUE(HaveSharedPoint(conflict_zone.lane_a, conflict_zone.s_range_a, conflict_zone.lane_b,
+                                  conflict_zone.s_range_b));
+      EXPECT_TRUE(HaveSharedPoint(conflict_zone.lane_b, conflict_zone.s_range_b, conflict_zone.lane_a,
+                                  conflict_zone.s_range_a));
+    }
+    num_conflict_zones += static_cast<int>(dut.size());
+  }
+  // The TShapeRoad junction has crossing connecting roads.
+  EXPECT_GT(num_conflict_zones, 0);
+}
+
+TEST_F(ConflictZonesTest, ConflictZonesOfCrossingLanes) {
+  struct ExpectedConflictZone {
+    std::string lane_a;
+    maliput::api::SRange s_range_a;
+    std::string lane_b;
+    maliput::api::SRange s_range_b;
+  };
+  // Connecting Lanes of the TShapeRoad junction whose footprints overlap. Lanes that are side by side or only meet
+  // end to start, like 4_0_1 and 5_0_-1 or 7_0_-1 and 9_0_-1, do not conflict.
+  const std::vector<ExpectedConflictZone> kExpectedConflictZones{
+      {"4_0_1", {1.724, 7.95}, "6_0_-1", {0.05, 5.756}},  {"4_0_1", {0.05, 6.276}, "8_0_-1", {3.305, 9.011}},
+      {"5_0_-1", {0.57, 7.062}, "6_0_-1", {1.345, 8.622}}, {"5_0_-1", {4.104, 7.95}, "7_0_-1", {0.34, 3.514}},
+      {"5_0_-1", {0.938, 7.43}, "8_0_-1", {0.439, 7.717}}, {"5_0_-1", {0.05, 3.896}, "9_0_-1", {0.05, 3.224}},
+      {"6_0_-1", {2.225, 8.102}, "8_0_-1", {0.96, 6.836}}, {"6_0_-1", {6.068, 9.011}, "9_0_-1", {0.836, 3.514}},
+      {"7_0_-1", {0.05, 2.728}, "8_0_-1", {0.05, 2.994}},
+  };
+  // Extremes are refined up to the linear tolerance and lanes are shrunk by it on each end.
+  const double kSRangeTolerance{2. * linear_tolerance_};
+
+  const maliput::api::Junction* junction = rg_->ById().GetJunction(maliput::api::JunctionId("3"));
+  ASSERT_NE(junction, nullptr);
+  const std::vector<ConflictZone> dut = FindConflictZones(junction, linear_tolerance_);
+  ASSERT_EQ(dut.size(), kExpectedConflictZones.size());
+  for (const ExpectedConflictZone& expected : kExpectedConflictZones) {
+    const auto it = std::find_if(dut.begin(), dut.end(), [&expected](const ConflictZone& conflict_zone) {
+      return conflict_zone.lane_a->id().string() == expected.lane_a &&
+             conflict_zone.lane_b->id().string() == expected.lane_b;
+    });
+    ASSERT_NE(it, dut.end()) << "Missing ConflictZone between " << expected.lane_a << " and " << expected.lane_b;
+    EXPECT_NEAR(it->s_range_a.s0(), expected.s_range_a.s0(), kSRangeTolerance);
+    EXPECT_NEAR(it->s_range_a.s1(), expected.s_range_a.s1(), kSRangeTolerance);
+    EXPECT_NEAR(it->s_range_b.s0(), expected.s_range_b.s0(), kSRangeTolerance);
+    EXPECT_NEAR(it->s_range_b.s1(), expected.s_range_b.s1(), kSRangeTolerance);
+  }
+}
+
+// Lanes that only meet end to start through a BranchPoint do not conflict.
+GTEST_TEST(ConflictZonesEndToStartTest, ConsecutiveLanesDoNotConflict) {
+  // Road 12 belongs to a junction and has three LaneSections, so its Lanes meet end to start within the junction.
+  const RoadGeometryConfiguration road_geometry_configuration{GetRoadGeometryConfigurationFor("Figure8.xodr").value()};
+  auto manager = xodr::LoadDataBaseFromFile(
+      utility::FindResourceInPath(road_geometry_configuration.opendrive_file, kMalidriveResourceFolder),
+      {road_geometry_configuration.tolerances.linear_tolerance});
+  const std::unique_ptr<const maliput::api::RoadGeometry> rg =
+      RoadGeometryBuilder(std::move(manager), road_geometry_configuration)();
+  ASSERT_NE(rg, nullptr);
+
+  int num_consecutive_lanes{0};
+  for (int i = 0; i < rg->num_junctions(); ++i) {
+    const maliput::api::Junction* junction = rg->junction(i);
+    const std::vector<ConflictZone> dut = FindConflictZones(junction, rg->linear_tolerance());
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      for (int k = 0; k < junction->segment(j)->num_lanes(); ++k) {
+        const maliput::api::Lane* lane = junction->segment(j)->lane(k);
+        const maliput::api::LaneEndSet* ongoing_lanes = lane->GetOngoingBranches(maliput::api::LaneEnd::kFinish);
+        for (int l = 0; l < ongoing_lanes->size(); ++l) {
+          const maliput::api::Lane* ongoing_lane = ongoing_lanes->get(l).lane;
+          if (ongoing_lane->segment()->junction() != junction) {
+            continue;
+          }
+          ++num_consecutive_lanes;
+          for (const ConflictZone& conflict_zone : dut) {
+            EXPECT_FALSE((conflict_zone.lane_a == lane && conflict_zone.lane_b == ongoing_lane) ||
+                         (conflict_zone.lane_a == ongoing_lane && conflict_zone.lane_b == lane))
+                << "Lanes " << lane->id().string() << " and " << ongoing_lane->id().string() << " conflict.";
+          }
+        }
+      }
+    }
+  }
+  EXPECT_GT(num_consecutive_lanes, 0);
+}
+
+TEST_F(ConflictZonesTest, StoredInRoadGeometry) {
+  const auto* malidrive_rg = dynamic_cast<const RoadGeometry*>(rg_.get());
+  ASSERT_NE(malidrive_rg, nullptr);
+  for (int i = 0; i < rg_->num_junctions(); ++i) {
+    const maliput::api::Junction* junction = rg_->junction(i);
+    const std::vector<ConflictZone> expected_conflict_zones = FindConflictZones(junction, linear_tolerance_);
+    const std::vector<ConflictZone>& dut = malidrive_rg->GetConflictZones(junction->id());
+    ASSERT_EQ(dut.size(), expected_conflict_zones.size());
+    for (std::size_t j = 0; j < dut.size(); ++j) {
+      EXPECT_EQ(dut[j].lane_a, expected_conflict_zones[j].lane_a);
+      EXPECT_EQ(dut[j].lane_b, expected_conflict_zones[j].lane_b);
+      EXPECT_DOUBLE_EQ(dut[j].s_range_a.s0(), expected_conflict_zones[j].s_range_a.s0());
+      EXPECT_DOUBLE_EQ(dut[j].s_range_a.s1(), expected_conflict_zones[j].s_range_a.s1());
+      EXPECT_DOUBLE_EQ(dut[j].s_range_b.s0(), expected_conflict_zones[j].s_range_b.s0());
+      EXPECT_DOUBLE_EQ(dut[j].s_range_b.s1(), expected_conflict_zones[j].s_range_b.s1());
+    }
+  }
+  EXPECT_TRUE(malidrive_rg->GetConflictZones(maliput::api::JunctionId("UnknownJunction")).empty());
+}
+
+// With lazy Lane construction the ConflictZones are found on the first query of each Junction, which may come from
+// several threads at once.
+TEST_F(ConflictZonesTest, DeferredConcurrentQueries) {
+  RoadGeometryConfiguration road_geometry_configuration{road_geometry_configuration_};
+  road_geometry_configuration.build_policy.lazy_lane_construction = true;
+  auto manager = xodr::LoadDataBaseFromFile(
+      utility::FindResourceInPath(road_geometry_configuration.opendrive_file, kMalidriveResourceFolder),
+      {road_geometry_configuration.tolerances.linear_tolerance});
+  const std::unique_ptr<const maliput::api::RoadGeometry> lazy_rg =
+      RoadGeometryBuilder(std::move(manager), road_geometry_configuration)();
+  const auto* dut = dynamic_cast<const RoadGeometry*>(lazy_rg.get());
+  ASSERT_NE(dut, nullptr);
+
+  constexpr int kNumThreads{4};
+  std::vector<std::vector<std::size_t>> num_conflict_zones(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([dut, &num_conflict_zones, i]() {
+      for (int j = 0; j < dut->num_junctions(); ++j) {
+        num_conflict_zones[i].push_back(dut->GetConflictZones(dut->junction(j)->id()).size());
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  const auto* eager_rg = dynamic_cast<const RoadGeometry*>(rg_.get());
+  ASSERT_NE(eager_rg, nullptr);
+  for (int i = 0; i < kNumThreads; ++i) {
+    ASSERT_EQ(static_cast<std::size_t>(eager_rg->num_junctions()), num_conflict_zones[i].size());
+    for (int j = 0; j < eager_rg->num_junctions(); ++j) {
+      EXPECT_EQ(eager_rg->GetConflictZones(eager_rg->junction(j)->id()).size(), num_conflict_zones[i][j]);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace builder
+}  // namespace malidrive
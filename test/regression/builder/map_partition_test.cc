@@ -0,0 +1,162 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/builder/map_partition.h"
+
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/common/assertion_error.h>
+
+#include "maliput_malidrive/builder/road_geometry_builder.h"
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/test_utilities/road_geometry_configuration_for_xodrs.h"
+#include "maliput_malidrive/xodr/db_manager.h"
+#include "utility/resources.h"
+
+namespace malidrive {
+namespace builder {
+namespace test {
+namespace {
+
+using malidrive::test::GetRoadGeometryConfigurationFor;
+
+// Resource folder path defined via compile definition.
+static constexpr char kMalidriveResourceFolder[] = DEF_MALIDRIVE_RESOURCES;
+
+std::unique_ptr<xodr::DBManager> LoadDataBase(const std::string& xodr_file) {
+  return xodr::LoadDataBaseFromFile(utility::FindResourceInPath(xodr_file, kMalidriveResourceFolder), {std::nullopt});
+}
+
+std::set<xodr::RoadHeader::Id> ToIds(const std::set<std::string>& ids) {
+  std::set<xodr::RoadHeader::Id> road_ids;
+  for (const auto& id : ids) {
+    road_ids.insert(xodr::RoadHeader::Id(id));
+  }
+  return road_ids;
+}
+
+// TShapeRoad holds XODR Roads 0, 1 and 2 connected through XODR Junction 3, which holds XODR Roads 4 to 9. Each of
+// XODR Roads 0, 1 and 2 is linked to the six connecting XODR Roads.
+class MapPartitionTShapeRoadTest : public ::testing::Test {
+ protected:
+  const std::unique_ptr<xodr::DBManager> manager_{LoadDataBase("TShapeRoad.xodr")};
+};
+
+TEST_F(MapPartitionTShapeRoadTest, SingleRegion) {
+  const MapPartition dut = PartitionMap(*manager_, 1);
+
+  ASSERT_EQ(1u, dut.regions.size());
+  EXPECT_EQ(ToIds({"0", "1", "2", "4", "5", "6", "7", "8", "9"}), dut.regions[0].road_ids);
+  EXPECT_TRUE(dut.regions[0].halo_road_ids.empty());
+  EXPECT_GT(dut.regions[0].lane_length, 0.);
+  EXPECT_EQ(0, dut.num_cut_edges);
+}
+
+TEST_F(MapPartitionTShapeRoadTest, OneRegionPerUnit) {
+  const MapPartition dut = PartitionMap(*manager_, 4);
+
+  ASSERT_EQ(4u, dut.regions.size());
+  EXPECT_EQ(18, dut.num_cut_edges);
+  const std::set<xodr::RoadHeader::Id> kJunctionRoads{ToIds({"4", "5", "6", "7", "8", "9"})};
+  int num_junction_regions{0};
+  for (const MapRegion& region : dut.regions) {
+    if (region.road_ids == kJunctionRoads) {
+      ++num_junction_regions;
+      EXPECT_EQ(ToIds({"0", "1", "2"}), region.halo_road_ids);
+    } else {
+      EXPECT_EQ(1u, region.road_ids.size());
+      EXPECT_EQ(kJunctionRoads, region.halo_road_ids);
+    }
+  }
+  EXPECT_EQ(1, num_junction_regions);
+}
+
+TEST_F(MapPartitionTShapeRoadTest, InvalidNumberOfRegions) {
+  EXPECT_THROW(PartitionMap(*manager_, 0), maliput::common::assertion_error);
+  EXPECT_THROW(PartitionMap(*manager_, 5), maliput::common::assertion_error);
+}
+
+// Each region is loaded on its own and together they hold every Lane of the map exactly once.
+TEST_F(MapPartitionTShapeRoadTest, RegionsAreLoadableIndependently) {
+  const MapPartition dut = PartitionMap(*manager_, 2);
+
+  const auto build = [](const std::optional<BuildRegion>& build_region) {
+    RoadGeometryConfiguration rg_config{GetRoadGeometryConfigurationFor("TShapeRoad.xodr").value()};
+    rg_config.build_region = build_region;
+    return RoadGeometryBuilder(
+        xodr::LoadDataBaseFromFile(utility::FindResourceInPath(rg_config.opendrive_file, kMalidriveResourceFolder),
+                                   {rg_config.tolerances.linear_tolerance.value()}),
+        rg_config)();
+  };
+  std::set<maliput::api::LaneId> region_lane_ids;
+  for (const MapRegion& region : dut.regions) {
+    const std::unique_ptr<const maliput::api::RoadGeometry> rg = build(ToBuildRegion(region, false));
+    for (const auto& id_lane : rg->ById().GetLanes()) {
+      EXPECT_TRUE(region_lane_ids.insert(id_lane.first).second) << id_lane.first.string();
+    }
+  }
+  const std::unique_ptr<const maliput::api::RoadGeometry> whole_map = build(std::nullopt);
+  EXPECT_EQ(whole_map->ById().GetLanes().size(), region_lane_ids.size());
+}
+
+GTEST_TEST(MapPartitionTest, BalancedRegions) {
+  const std::unique_ptr<xodr::DBManager> manager = LoadDataBase("Town01.xodr");
+  const double total_lane_length = PartitionMap(*manager, 1).regions[0].lane_length;
+  constexpr int kNumRegions{4};
+
+  const MapPartition dut = PartitionMap(*manager, kNumRegions);
+
+  ASSERT_EQ(static_cast<std::size_t>(kNumRegions), dut.regions.size());
+  std::set<xodr::RoadHeader::Id> road_ids;
+  double lane_length{0.};
+  for (const MapRegion& region : dut.regions) {
+    for (const auto& road_id : region.road_ids) {
+      EXPECT_TRUE(road_ids.insert(road_id).second) << road_id.string();
+      EXPECT_EQ(region.halo_road_ids.end(), region.halo_road_ids.find(road_id)) << road_id.string();
+    }
+    lane_length += region.lane_length;
+    EXPECT_GT(region.lane_length, 0.75 * total_lane_length / kNumRegions);
+    EXPECT_LT(region.lane_length, 1.25 * total_lane_length / kNumRegions);
+    EXPECT_FALSE(region.halo_road_ids.empty());
+  }
+  EXPECT_EQ(manager->GetRoadHeaders().size(), road_ids.size());
+  EXPECT_NEAR(total_lane_length, lane_length, 1e-6 * total_lane_length);
+  EXPECT_GT(dut.num_cut_edges, 0);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace builder
+}  // namespace malidrive
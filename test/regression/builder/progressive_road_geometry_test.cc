@@ -0,0 +1,190 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/builder/progressive_road_geometry.h"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+
+#include "maliput_malidrive/builder/road_geometry_builder.h"
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/test_utilities/road_geometry_configuration_for_xodrs.h"
+#include "maliput_malidrive/xodr/db_manager.h"
+#include "utility/resources.h"
+
+namespace malidrive {
+namespace builder {
+namespace test {
+namespace {
+
+using malidrive::test::GetRoadGeometryConfigurationFor;
+
+// Resource folder path defined via compile definition.
+static constexpr char kMalidriveResourceFolder[] = DEF_MALIDRIVE_RESOURCES;
+
+class ProgressiveRoadGeometryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    road_geometry_configuration_.opendrive_file =
+        utility::FindResourceInPath(road_geometry_configuration_.opendrive_file, kMalidriveResourceFolder);
+  }
+
+  std::unique_ptr<xodr::DBManager> LoadDataBase() const {
+    return xodr::LoadDataBaseFromFile(road_geometry_configuration_.opendrive_file,
+                                      {road_geometry_configuration_.tolerances.linear_tolerance});
+  }
+
+  // TShapeRoad holds three XODR Roads connected through a XODR Junction of six XODR Roads.
+  static constexpr int kNumRoads{9};
+  RoadGeometryConfiguration road_geometry_configuration_{GetRoadGeometryConfigurationFor("TShapeRoad.xodr").value()};
+};
+
+TEST_F(ProgressiveRoadGeometryTest, RoadsInPriorityOrderFromRoadIds) {
+  const ProgressiveBuildSeed seed{{xodr::RoadHeader::Id("1")}, std::nullopt};
+  const auto [dut, num_seed_roads] = GetRoadsInPriorityOrder(*LoadDataBase(), seed, {0., 0., 0.});
+
+  EXPECT_EQ(1, num_seed_roads);
+  ASSERT_EQ(static_cast<std::size_t>(kNumRoads), dut.size());
+  EXPECT_EQ(xodr::RoadHeader::Id("1"), dut.front());
+  EXPECT_EQ(static_cast<std::size_t>(kNumRoads), std::set<xodr::RoadHeader::Id>(dut.begin(), dut.end()).size());
+  // Road 1 is linked to the XODR Junction, so its connecting XODR Roads come before Roads 0 and 2.
+  for (int i = 1; i < 7; ++i) {
+    EXPECT_NE(xodr::RoadHeader::Id("0"), dut[i]);
+    EXPECT_NE(xodr::RoadHeader::Id("2"), dut[i]);
+  }
+}
+
+TEST_F(ProgressiveRoadGeometryTest, RoadsInPriorityOrderFromRegion) {
+  // Only Road 0 overlaps the region once the translation is applied.
+  const ProgressiveBuildSeed seed{{}, ProgressiveBuildSeed::Region{{9., 9.}, {11., 11.}}};
+  const auto [dut, num_seed_roads] = GetRoadsInPriorityOrder(*LoadDataBase(), seed, {10., 10., 0.});
+
+  EXPECT_EQ(1, num_seed_roads);
+  ASSERT_EQ(static_cast<std::size_t>(kNumRoads), dut.size());
+  EXPECT_EQ(xodr::RoadHeader::Id("0"), dut.front());
+}
+
+TEST_F(ProgressiveRoadGeometryTest, RoadGeometryBuilderBuildsSelectedRoads) {
+  const std::unique_ptr<const maliput::api::RoadGeometry> dut =
+      RoadGeometryBuilder(LoadDataBase(), road_geometry_configuration_, {},
+                          std::set<xodr::RoadHeader::Id>{xodr::RoadHeader::Id("0")})();
+
+  const auto lanes = dut->ById().GetLanes();
+  ASSERT_FALSE(lanes.empty());
+  for (const auto& lane : lanes) {
+    EXPECT_EQ("0_", lane.first.string().substr(0, 2));
+    // Lanes reaching the XODR Junction are left unconnected at that end.
+    EXPECT_EQ(0, lane.second->GetOngoingBranches(maliput::api::LaneEnd::Which::kFinish)->size());
+  }
+}
+
+TEST_F(ProgressiveRoadGeometryTest, BuildsInStages) {
+  std::vector<BuildProgress> progress;
+  BuildControl build_control;
+  build_control.progress_callback = [&progress](const BuildProgress& p) { progress.push_back(p); };
+  const ProgressiveBuildSeed seed{{xodr::RoadHeader::Id("0")}, std::nullopt};
+
+  ProgressiveRoadGeometry dut(road_geometry_configuration_, seed, build_control);
+  const std::shared_ptr<const maliput::api::RoadGeometry> rg = dut.WaitUntilDone();
+
+  ASSERT_NE(rg, nullptr);
+  EXPECT_TRUE(dut.IsDone());
+  EXPECT_EQ(rg, dut.road_geometry());
+  // The number of built XODR Roads doubles with each stage.
+  const std::vector<int> kExpectedCompleted{0, 1, 2, 4, 8, 9};
+  ASSERT_EQ(kExpectedCompleted.size() + 1, progress.size());
+  for (std::size_t i = 0; i < kExpectedCompleted.size(); ++i) {
+    EXPECT_EQ(BuildPhase::kRoadGeometry, progress[i].phase);
+    EXPECT_EQ(kExpectedCompleted[i], progress[i].completed);
+    EXPECT_EQ(kNumRoads, progress[i].total);
+  }
+  EXPECT_EQ(BuildPhase::kDone, progress.back().phase);
+
+  for (const char* road_id : {"0", "1", "2", "4", "9"}) {
+    EXPECT_TRUE(dut.IsRoadAvailable(xodr::RoadHeader::Id(road_id)));
+  }
+  EXPECT_FALSE(dut.IsRoadAvailable(xodr::RoadHeader::Id("3")));
+  EXPECT_TRUE(dut.IsLaneAvailable(maliput::api::LaneId("1_0_-1")));
+  EXPECT_FALSE(dut.IsLaneAvailable(maliput::api::LaneId("3_0_-1")));
+
+  const maliput::api::Lane* lane = rg->ById().GetLane(maliput::api::LaneId("1_0_-1"));
+  ASSERT_NE(lane, nullptr);
+  const std::optional<maliput::api::RoadPositionResult> result =
+      dut.ToRoadPosition(lane->ToInertialPosition({1., 0., 0.}));
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(lane->id(), result->road_position.lane->id());
+}
+
+TEST_F(ProgressiveRoadGeometryTest, Cancelled) {
+  auto cancellation_token = std::make_shared<CancellationToken>();
+  cancellation_token->Cancel();
+  BuildControl build_control;
+  build_control.cancellation_token = cancellation_token;
+  const ProgressiveBuildSeed seed{{xodr::RoadHeader::Id("0")}, std::nullopt};
+
+  ProgressiveRoadGeometry dut(road_geometry_configuration_, seed, build_control);
+  EXPECT_THROW(dut.WaitUntilDone(), BuildCancelledError);
+  EXPECT_EQ(nullptr, dut.road_geometry());
+  EXPECT_FALSE(dut.IsDone());
+  EXPECT_EQ(std::nullopt, dut.ToRoadPosition({0., 0., 0.}));
+}
+
+TEST_F(ProgressiveRoadGeometryTest, DestroyedWhileBuilding) {
+  const ProgressiveBuildSeed seed{{xodr::RoadHeader::Id("0")}, std::nullopt};
+  // The destructor cancels the ongoing stage, which is not reported as an error.
+  EXPECT_NO_THROW({ ProgressiveRoadGeometry dut(road_geometry_configuration_, seed); });
+}
+
+GTEST_TEST(CancellationTokenTest, FollowsParent) {
+  auto parent = std::make_shared<CancellationToken>();
+  CancellationToken dut(parent);
+  EXPECT_FALSE(dut.IsCancelled());
+  parent->Cancel();
+  EXPECT_TRUE(dut.IsCancelled());
+
+  auto other_parent = std::make_shared<CancellationToken>();
+  CancellationToken other_dut(other_parent);
+  other_dut.Cancel();
+  EXPECT_TRUE(other_dut.IsCancelled());
+  EXPECT_FALSE(other_parent->IsCancelled());
+
+  EXPECT_FALSE(CancellationToken(nullptr).IsCancelled());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace builder
+}  // namespace malidrive
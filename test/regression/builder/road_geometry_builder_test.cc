@@ -30,7 +30,14 @@
 #include "maliput_malidrive/builder/road_geometry_builder.h"
 
 #include <algorithm>
+#include <fstream>
+#include <future>
 #include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <maliput/api/compare.h>
@@ -39,6 +46,7 @@
 
 #include "assert_compare.h"
 #include "maliput_malidrive/base/lane.h"
+#include "maliput_malidrive/base/road_geometry.h"
 #include "maliput_malidrive/builder/id_providers.h"
 #include "maliput_malidrive/constants.h"
 #include "maliput_malidrive/test_utilities/road_geometry_configuration_for_xodrs.h"
@@ -104,6 +112,24 @@ TEST_F(BuilderTestSingleLane, RoadGeometryBuilderConstructor) {
   EXPECT_EQ(dut->id(), road_geometry_configuration_.id);
 }
 
+TEST_F(BuilderTestSingleLane, LanesHoldXodrLanes) {
+  std::unique_ptr<const maliput::api::RoadGeometry> dut =
+      builder::RoadGeometryBuilder(std::move(manager_), road_geometry_configuration_)();
+  const auto* rg = dynamic_cast<const malidrive::RoadGeometry*>(dut.get());
+  ASSERT_NE(rg, nullptr);
+  const auto& road_headers = rg->get_manager()->GetRoadHeaders();
+  for (const auto& id_lane : dut->ById().GetLanes()) {
+    const auto* lane = dynamic_cast<const malidrive::Lane*>(id_lane.second);
+    ASSERT_NE(lane, nullptr);
+    const xodr::RoadHeader::Id road_id{std::to_string(lane->get_track())};
+    ASSERT_NE(road_headers.find(road_id), road_headers.end());
+    // The pointers refer to the XODR Roads held by the RoadGeometry's DBManager.
+    EXPECT_EQ(lane->get_xodr_road_header(), &road_headers.at(road_id));
+    ASSERT_NE(lane->get_xodr_lane(), nullptr);
+    EXPECT_EQ(lane->get_xodr_lane()->id.string(), std::to_string(lane->get_lane_id()));
+  }
+}
+
 TEST_F(BuilderTestSingleLane, RoadGeometryBuilderConstructorBadUsed) {
   {
     RoadGeometryConfiguration bad_config = road_geometry_configuration_;
@@ -1175,6 +1201,33 @@ TEST_P(RoadGeometryOmittingNonDrivableLanesTest, InertialPositionAndRoundTripPos
 INSTANTIATE_TEST_CASE_P(RoadGeometryOmittingNonDrivableLanesTestGroup, RoadGeometryOmittingNonDrivableLanesTest,
                         ::testing::ValuesIn(InstantiateRoadGeometryNonDrivableLanesParameters()));
 
+// Hidden lanes are left out of the arc length integration of their Segment. The visible lanes must not be affected.
+GTEST_TEST(RoadGeometryOmittingNonDrivableLanes, VisibleLanesMatchNonOmittedOnes) {
+  auto build = [](bool omit_nondrivable_lanes) {
+    builder::RoadGeometryConfiguration rg_config{
+        malidrive::test::GetRoadGeometryConfigurationFor("StraightForward.xodr").value()};
+    rg_config.omit_nondrivable_lanes = omit_nondrivable_lanes;
+    return builder::RoadGeometryBuilder(
+        xodr::LoadDataBaseFromFile(utility::FindResourceInPath(rg_config.opendrive_file, kMalidriveResourceFolder),
+                                   {rg_config.tolerances.linear_tolerance.value()}),
+        rg_config)();
+  };
+  const std::unique_ptr<const maliput::api::RoadGeometry> omitted = build(true);
+  const std::unique_ptr<const maliput::api::RoadGeometry> not_omitted = build(false);
+
+  const auto omitted_lanes = omitted->ById().GetLanes();
+  ASSERT_LT(omitted_lanes.size(), not_omitted->ById().GetLanes().size());
+  for (const auto& id_lane : omitted_lanes) {
+    const maliput::api::Lane* expected_lane = not_omitted->ById().GetLane(id_lane.first);
+    ASSERT_NE(expected_lane, nullptr);
+    EXPECT_NEAR(expected_lane->length(), id_lane.second->length(), constants::kLinearTolerance);
+    const maliput::api::LanePosition lane_position{0.5 * expected_lane->length(), 0., 0.};
+    EXPECT_TRUE(AssertCompare(IsInertialPositionClose(expected_lane->ToInertialPosition(lane_position),
+                                                      id_lane.second->ToInertialPosition(lane_position),
+                                                      constants::kLinearTolerance)));
+  }
+}
+
 class RoadGeometryNegativeLaneWidthTest : public ::testing::Test {
  protected:
   void SetUp() override {}
@@ -1325,6 +1378,210 @@ TEST_F(ToleranceSelectionPolicyTest, InvalidLinearToleranceRange) {
       maliput::common::assertion_error);
 }
 
+
+// Verifies that a RoadGeometry built with BuildPolicy::lazy_lane_construction matches the one built eagerly.
+class LazyLaneConstructionTest : public ::testing::Test {
+ protected:
+  const std::string kXodrFile{"TShapeRoad.xodr"};
+
+  std::unique_ptr<const maliput::api::RoadGeometry> Build(bool lazy_lane_construction) const {
+    builder::RoadGeometryConfiguration rg_config{GetRoadGeometryConfigurationFor(kXodrFile).value()};
+    rg_config.build_policy.lazy_lane_construction = lazy_lane_construction;
+    return builder::RoadGeometryBuilder(
+        xodr::LoadDataBaseFromFile(utility::FindResourceInPath(rg_config.opendrive_file, kMalidriveResourceFolder),
+                                   {rg_config.tolerances.linear_tolerance.value()}),
+        rg_config)();
+  }
+
+  const double kTolerance{constants::kLinearTolerance};
+};
+
+TEST_F(LazyLaneConstructionTest, MatchesEagerConstruction) {
+  const std::unique_ptr<const maliput::api::RoadGeometry> eager = Build(false);
+  const std::unique_ptr<const maliput::api::RoadGeometry> lazy = Build(true);
+  ASSERT_NE(eager, nullptr);
+  ASSERT_NE(lazy, nullptr);
+
+  const auto eager_lanes = eager->ById().GetLanes();
+  ASSERT_EQ(eager_lanes.size(), lazy->ById().GetLanes().size());
+  for (const auto& id_lane : eager_lanes) {
+    const maliput::api::Lane* lazy_lane = lazy->ById().GetLane(id_lane.first);
+    ASSERT_NE(lazy_lane, nullptr);
+    EXPECT_NEAR(id_lane.second->length(), lazy_lane->length(), kTolerance);
+    for (const double s_ratio : {0., 0.5, 1.}) {
+      const maliput::api::LanePosition lane_position{s_ratio * id_lane.second->length(), 0., 0.};
+      EXPECT_TRUE(AssertCompare(IsInertialPositionClose(id_lane.second->ToInertialPosition(lane_position),
+                                                        lazy_lane->ToInertialPosition(lane_position), kTolerance)));
+    }
+  }
+
+  const auto* eager_rg = dynamic_cast<const RoadGeometry*>(eager.get());
+  const auto* lazy_rg = dynamic_cast<const RoadGeometry*>(lazy.get());
+  ASSERT_NE(eager_rg, nullptr);
+  ASSERT_NE(lazy_rg, nullptr);
+  EXPECT_EQ(eager_rg->lane_graph().num_lanes(), lazy_rg->lane_graph().num_lanes());
+  EXPECT_EQ(eager_rg->lane_graph().num_edges(), lazy_rg->lane_graph().num_edges());
+  for (int i = 0; i < eager_rg->num_junctions(); ++i) {
+    const maliput::api::JunctionId& junction_id = eager_rg->junction(i)->id();
+    EXPECT_EQ(eager_rg->GetConflictZones(junction_id).size(), lazy_rg->GetConflictZones(junction_id).size());
+  }
+}
+
+// The first geometric queries to the Lanes of the same Segment may come from different threads.
+TEST_F(LazyLaneConstructionTest, ConcurrentFirstQueries) {
+  const std::unique_ptr<const maliput::api::RoadGeometry> eager = Build(false);
+  const std::unique_ptr<const maliput::api::RoadGeometry> lazy = Build(true);
+  ASSERT_NE(lazy, nullptr);
+
+  std::vector<std::future<std::pair<maliput::api::LaneId, double>>> lengths;
+  for (const auto& id_lane : lazy->ById().GetLanes()) {
+    const maliput::api::Lane* lane = id_lane.second;
+    lengths.push_back(std::async(std::launch::async, [lane]() { return std::make_pair(lane->id(), lane->length()); }));
+  }
+  for (auto& length : lengths) {
+    const std::pair<maliput::api::LaneId, double> id_length = length.get();
+    EXPECT_NEAR(eager->ById().GetLane(id_length.first)->length(), id_length.second, kTolerance);
+  }
+}
+
+// Only the XODR Roads within RoadGeometryConfiguration::build_region are built. TShapeRoad holds XODR Roads 0, 1 and
+// 2 connected through XODR Junction 3, which holds XODR Roads 4 to 9.
+GTEST_TEST(RoadGeometryBuilderBuildRegionTest, BuildsSelectedRoadsOnly) {
+  builder::RoadGeometryConfiguration rg_config{GetRoadGeometryConfigurationFor("TShapeRoad.xodr").value()};
+  rg_config.build_region = BuildRegion{std::nullopt, {"0"}, 1 /* topological_radius */};
+  const std::unique_ptr<const maliput::api::RoadGeometry> dut = builder::RoadGeometryBuilder(
+      xodr::LoadDataBaseFromFile(utility::FindResourceInPath(rg_config.opendrive_file, kMalidriveResourceFolder),
+                                 {rg_config.tolerances.linear_tolerance.value()}),
+      rg_config)();
+  ASSERT_NE(dut, nullptr);
+
+  const std::set<int> kExpectedTracks{0, 4, 5, 6, 7, 8, 9};
+  for (const auto& id_lane : dut->ById().GetLanes()) {
+    const int track = dynamic_cast<const Lane*>(id_lane.second)->get_track();
+    EXPECT_NE(kExpectedTracks.find(track), kExpectedTracks.end()) << id_lane.first.string();
+  }
+  EXPECT_EQ(nullptr, dut->ById().GetLane(LaneId("1_0_-1")));
+
+  // Lane 5_0_-1 goes from Road 0, which is built, to Road 1, which is not.
+  const maliput::api::Lane* lane = dut->ById().GetLane(LaneId("5_0_-1"));
+  ASSERT_NE(lane, nullptr);
+  EXPECT_EQ(1, lane->GetOngoingBranches(LaneEnd::kStart)->size());
+  EXPECT_EQ(0, lane->GetOngoingBranches(LaneEnd::kFinish)->size());
+}
+
+// Verifies that a RoadGeometry rebuilt out of a previous one reuses the geometry of the unchanged XODR Roads.
+// TShapeRoad holds XODR Roads 0, 1 and 2 connected through XODR Junction 3, which holds XODR Roads 4 to 9.
+class IncrementalRebuildTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    rg_config_ = GetRoadGeometryConfigurationFor("TShapeRoad.xodr").value();
+    rg_config_.opendrive_file = utility::FindResourceInPath(rg_config_.opendrive_file, kMalidriveResourceFolder);
+    previous_ = Build(LoadManager(), rg_config_, nullptr /* previous_road_geometry */);
+    ASSERT_NE(previous_, nullptr);
+    for (const auto& id_lane : previous_->ById().GetLanes()) {
+      previous_lengths_[id_lane.first] = id_lane.second->length();
+    }
+  }
+
+  std::unique_ptr<xodr::DBManager> LoadManager() const {
+    return xodr::LoadDataBaseFromFile(rg_config_.opendrive_file, {rg_config_.tolerances.linear_tolerance.value()});
+  }
+
+  // Loads TShapeRoad with XODR Road 2 renamed.
+  std::unique_ptr<xodr::DBManager> LoadEditedManager() const {
+    std::ifstream file(rg_config_.opendrive_file);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string xodr_description = buffer.str();
+    const std::string kFrom{"name=\"Road 2\""};
+    const std::size_t position = xodr_description.find(kFrom);
+    EXPECT_NE(std::string::npos, position);
+    xodr_description.replace(position, kFrom.size(), "name=\"Road 2 edited\"");
+    return xodr::LoadDataBaseFromStr(xodr_description, {rg_config_.tolerances.linear_tolerance.value()});
+  }
+
+  static std::unique_ptr<const maliput::api::RoadGeometry> Build(std::unique_ptr<xodr::DBManager> manager,
+                                                                 const builder::RoadGeometryConfiguration& rg_config,
+                                                                 const maliput::api::RoadGeometry* previous) {
+    return builder::RoadGeometryBuilder(std::move(manager), rg_config, {} /* build_control */,
+                                        std::nullopt /* road_ids */, dynamic_cast<const RoadGeometry*>(previous))();
+  }
+
+  // Expects the Lanes of `dut` to match the ones of the previous RoadGeometry.
+  void ExpectSameLanes(const maliput::api::RoadGeometry& dut) const {
+    ASSERT_EQ(previous_lengths_.size(), dut.ById().GetLanes().size());
+    for (const auto& id_length : previous_lengths_) {
+      const maliput::api::Lane* lane = dut.ById().GetLane(id_length.first);
+      ASSERT_NE(lane, nullptr);
+      EXPECT_NEAR(id_length.second, lane->length(), kTolerance);
+    }
+  }
+
+  // Returns the XODR Roads whose RoadCurve is shared by `dut` and the previous RoadGeometry.
+  std::set<std::string> GetSharedRoadCurves(const maliput::api::RoadGeometry& dut) const {
+    const auto* previous_rg = dynamic_cast<const RoadGeometry*>(previous_.get());
+    const auto* rg = dynamic_cast<const RoadGeometry*>(&dut);
+    std::set<std::string> shared_road_curves;
+    for (const std::string road_id : {"0", "1", "2", "4", "5", "6", "7", "8", "9"}) {
+      if (previous_rg->GetRoadCurve(xodr::RoadHeader::Id(road_id)) == rg->GetRoadCurve(xodr::RoadHeader::Id(road_id))) {
+        shared_road_curves.insert(road_id);
+      }
+    }
+    return shared_road_curves;
+  }
+
+  const double kTolerance{constants::kLinearTolerance};
+  builder::RoadGeometryConfiguration rg_config_;
+  std::unique_ptr<const maliput::api::RoadGeometry> previous_;
+  std::map<LaneId, double> previous_lengths_;
+};
+
+TEST_F(IncrementalRebuildTest, ReusesUnchangedRoads) {
+  const std::unique_ptr<const maliput::api::RoadGeometry> dut = Build(LoadManager(), rg_config_, previous_.get());
+  ASSERT_NE(dut, nullptr);
+  EXPECT_EQ((std::set<std::string>{"0", "1", "2", "4", "5", "6", "7", "8", "9"}), GetSharedRoadCurves(*dut));
+  EXPECT_EQ(previous_->num_branch_points(), dut->num_branch_points());
+  ExpectSameLanes(*dut);
+
+  // The rebuilt RoadGeometry does not depend on the previous one.
+  const maliput::api::Lane* lane = dut->ById().GetLane(LaneId("0_0_-1"));
+  ASSERT_NE(lane, nullptr);
+  const maliput::api::LanePosition lane_position{0.5 * lane->length(), 0., 0.};
+  const maliput::api::InertialPosition expected_inertial_position = lane->ToInertialPosition(lane_position);
+  previous_.reset();
+  EXPECT_TRUE(AssertCompare(
+      IsInertialPositionClose(expected_inertial_position, lane->ToInertialPosition(lane_position), kTolerance)));
+  ExpectSameLanes(*dut);
+}
+
+TEST_F(IncrementalRebuildTest, RebuildsChangedRoads) {
+  const std::unique_ptr<const maliput::api::RoadGeometry> dut =
+      Build(LoadEditedManager(), rg_config_, previous_.get());
+  ASSERT_NE(dut, nullptr);
+  EXPECT_EQ((std::set<std::string>{"0", "1", "4", "5", "6", "7", "8", "9"}), GetSharedRoadCurves(*dut));
+  EXPECT_EQ(previous_->num_branch_points(), dut->num_branch_points());
+  ExpectSameLanes(*dut);
+}
+
+TEST_F(IncrementalRebuildTest, DifferentToleranceRebuildsEverything) {
+  builder::RoadGeometryConfiguration rg_config{rg_config_};
+  rg_config.tolerances.linear_tolerance = 2. * rg_config_.tolerances.linear_tolerance.value();
+  const std::unique_ptr<const maliput::api::RoadGeometry> dut = Build(LoadManager(), rg_config, previous_.get());
+  ASSERT_NE(dut, nullptr);
+  EXPECT_TRUE(GetSharedRoadCurves(*dut).empty());
+}
+
+TEST_F(IncrementalRebuildTest, DifferentSimplificationPolicyRebuildsEverything) {
+  ASSERT_EQ(rg_config_.simplification_policy, builder::RoadGeometryConfiguration::SimplificationPolicy::kNone);
+  builder::RoadGeometryConfiguration rg_config{rg_config_};
+  rg_config.simplification_policy =
+      builder::RoadGeometryConfiguration::SimplificationPolicy::kSimplifyWithinToleranceAndKeepGeometryModel;
+  const std::unique_ptr<const maliput::api::RoadGeometry> dut = Build(LoadManager(), rg_config, previous_.get());
+  ASSERT_NE(dut, nullptr);
+  EXPECT_TRUE(GetSharedRoadCurves(*dut).empty());
+  EXPECT_TRUE(dynamic_cast<const RoadGeometry*>(dut.get())->simplified_geometries());
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace builder
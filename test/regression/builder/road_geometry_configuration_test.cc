@@ -29,6 +29,10 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/builder/road_geometry_configuration.h"
 
+#include <algorithm>
+#include <optional>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "maliput_malidrive/builder/params.h"
@@ -41,7 +45,7 @@ namespace {
 class RoadGeometryConfigurationTest : public ::testing::Test {
  protected:
   const maliput::math::Vector3 kRandomVector{1., 2., 3.};
-  const BuildPolicy kBuildPolicy{BuildPolicy::Type::kParallel, 4};
+  const BuildPolicy kBuildPolicy{BuildPolicy::Type::kParallel, 4, true /* lazy_lane_construction */};
   const RoadGeometryConfiguration::SimplificationPolicy kSimplificationPolicy{
       RoadGeometryConfiguration::SimplificationPolicy::kSimplifyWithinToleranceAndKeepGeometryModel};
   const RoadGeometryConfiguration::StandardStrictnessPolicy kStandardStrictnessPolicy{
@@ -53,6 +57,7 @@ class RoadGeometryConfigurationTest : public ::testing::Test {
   const double kMaxLinearTolerance{1e-4};
   const double kAngularTolerance{5e-5};
   const double kScaleLength{2.};
+  const BuildRegion kBuildRegion{BuildRegion::BoundingBox{{-1., -2.}, {3., 4.}}, {"1", "7"}, 2 /* radius */};
 
   void ExpectEqual(const RoadGeometryConfiguration& lhs, const RoadGeometryConfiguration& rhs) {
     EXPECT_EQ(lhs.id, rhs.id);
@@ -64,9 +69,20 @@ class RoadGeometryConfigurationTest : public ::testing::Test {
     EXPECT_EQ(lhs.inertial_to_backend_frame_translation, rhs.inertial_to_backend_frame_translation);
     EXPECT_EQ(lhs.build_policy.type, rhs.build_policy.type);
     EXPECT_EQ(lhs.build_policy.num_threads, rhs.build_policy.num_threads);
+    EXPECT_EQ(lhs.build_policy.lazy_lane_construction, rhs.build_policy.lazy_lane_construction);
     EXPECT_EQ(lhs.simplification_policy, rhs.simplification_policy);
     EXPECT_EQ(lhs.standard_strictness_policy, rhs.standard_strictness_policy);
     EXPECT_EQ(lhs.omit_nondrivable_lanes, rhs.omit_nondrivable_lanes);
+    ASSERT_EQ(lhs.build_region.has_value(), rhs.build_region.has_value());
+    if (lhs.build_region.has_value()) {
+      ASSERT_EQ(lhs.build_region->bounding_box.has_value(), rhs.build_region->bounding_box.has_value());
+      if (lhs.build_region->bounding_box.has_value()) {
+        EXPECT_EQ(lhs.build_region->bounding_box->min_corner, rhs.build_region->bounding_box->min_corner);
+        EXPECT_EQ(lhs.build_region->bounding_box->max_corner, rhs.build_region->bounding_box->max_corner);
+      }
+      EXPECT_EQ(lhs.build_region->road_ids, rhs.build_region->road_ids);
+      EXPECT_EQ(lhs.build_region->topological_radius, rhs.build_region->topological_radius);
+    }
   }
 };
 
@@ -80,7 +96,8 @@ TEST_F(RoadGeometryConfigurationTest, Constructor) {
       kBuildPolicy,
       kSimplificationPolicy,
       kStandardStrictnessPolicy,
-      kOmitNondrivableLanes};
+      kOmitNondrivableLanes,
+      kBuildRegion};
 
   const std::map<std::string, std::string> rg_config_map{
       {params::kRoadGeometryId, kRgId},
@@ -92,10 +109,14 @@ TEST_F(RoadGeometryConfigurationTest, Constructor) {
       {params::kInertialToBackendFrameTranslation, kRandomVector.to_str()},
       {params::kBuildPolicy, BuildPolicy::FromTypeToStr(kBuildPolicy.type)},
       {params::kNumThreads, std::to_string(kBuildPolicy.num_threads.value())},
+      {params::kLazyLaneConstruction, (kBuildPolicy.lazy_lane_construction ? "true" : "false")},
       {params::kSimplificationPolicy, RoadGeometryConfiguration::FromSimplificationPolicyToStr(kSimplificationPolicy)},
       {params::kStandardStrictnessPolicy,
        RoadGeometryConfiguration::FromStandardStrictnessPolicyToStr(kStandardStrictnessPolicy)},
       {params::kOmitNonDrivableLanes, (kOmitNondrivableLanes ? "true" : "false")},
+      {params::kBuildRegionBoundingBox, "{-1., -2., 3., 4.}"},
+      {params::kBuildRegionRoadIds, "1, 7"},
+      {params::kBuildRegionTopologicalRadius, "2"},
   };
 
   const RoadGeometryConfiguration dut2{RoadGeometryConfiguration::FromMap(rg_config_map)};
@@ -113,7 +134,8 @@ TEST_F(RoadGeometryConfigurationTest, ToStringMapUsingMaxLinearTolerance) {
       kBuildPolicy,
       kSimplificationPolicy,
       kStandardStrictnessPolicy,
-      kOmitNondrivableLanes};
+      kOmitNondrivableLanes,
+      kBuildRegion};
 
   const RoadGeometryConfiguration dut2{RoadGeometryConfiguration::FromMap(dut1.ToStringMap())};
   ExpectEqual(dut1, dut2);
@@ -129,7 +151,8 @@ TEST_F(RoadGeometryConfigurationTest, ToStringMapNotUsingMaxLinearTolerance) {
       kBuildPolicy,
       kSimplificationPolicy,
       kStandardStrictnessPolicy,
-      kOmitNondrivableLanes};
+      kOmitNondrivableLanes,
+      kBuildRegion};
 
   const RoadGeometryConfiguration dut2{RoadGeometryConfiguration::FromMap(dut1.ToStringMap())};
   ExpectEqual(dut1, dut2);
@@ -140,6 +163,15 @@ GTEST_TEST(BuildPolicyType, StringToTypeConversion) {
   EXPECT_EQ(BuildPolicy::Type::kParallel, BuildPolicy::FromStrToType("parallel"));
 }
 
+GTEST_TEST(BuildPolicy, EffectiveNumberOfThreads) {
+  EXPECT_EQ(1u, GetEffectiveNumberOfThreads(BuildPolicy{BuildPolicy::Type::kSequential, 4}));
+  EXPECT_EQ(4u, GetEffectiveNumberOfThreads(BuildPolicy{BuildPolicy::Type::kParallel, 4}));
+  EXPECT_EQ(1u, GetEffectiveNumberOfThreads(BuildPolicy{BuildPolicy::Type::kParallel, 0}));
+  EXPECT_LE(1u, GetEffectiveNumberOfThreads(BuildPolicy{BuildPolicy::Type::kParallel, std::nullopt}));
+  EXPECT_GE(std::max(std::thread::hardware_concurrency(), 1u),
+            GetEffectiveNumberOfThreads(BuildPolicy{BuildPolicy::Type::kParallel, std::nullopt}));
+}
+
 GTEST_TEST(SimplificationPolicy, StringToPolicyConversion) {
   EXPECT_EQ(RoadGeometryConfiguration::SimplificationPolicy::kNone,
             RoadGeometryConfiguration::FromStrToSimplificationPolicy("none"));
@@ -53,6 +53,7 @@
 #include <maliput/base/rule_registry.h>
 #include <maliput/base/traffic_light_book.h>
 
+#include "maliput_malidrive/base/lane.h"
 #include "maliput_malidrive/builder/params.h"
 #include "maliput_malidrive/builder/road_geometry_builder.h"
 #include "maliput_malidrive/builder/road_network_configuration.h"
@@ -1161,6 +1162,43 @@ TEST_P(SpeedLimitRuleBuilderTest, SpeedLimitRulesTest) {
   }
 }
 
+// Verifies that loading a RoadNetwork with lazy lane construction does not integrate the Lanes and that its rules
+// match the ones of an eager load.
+TEST_P(SpeedLimitRuleBuilderTest, SpeedLimitRulesWithLazyLaneConstruction) {
+  const auto eager_rn = loader::Load<builder::RoadNetworkBuilder>(road_geometry_configuration_.ToStringMap());
+  ASSERT_NE(eager_rn.get(), nullptr);
+  road_geometry_configuration_.build_policy.lazy_lane_construction = true;
+  const auto dut = loader::Load<builder::RoadNetworkBuilder>(road_geometry_configuration_.ToStringMap());
+  ASSERT_NE(dut.get(), nullptr);
+
+  for (const auto lane_id_lane : dut->road_geometry()->ById().GetLanes()) {
+    const Lane* lane = dynamic_cast<const Lane*>(lane_id_lane.second);
+    ASSERT_NE(lane, nullptr);
+    EXPECT_FALSE(lane->GetArcLengthFunctions().has_value());
+  }
+
+  const auto expected_rules = eager_rn->rulebook()->Rules();
+  const auto rules = dut->rulebook()->Rules();
+  ASSERT_EQ(expected_rules.range_value_rules.size(), rules.range_value_rules.size());
+  for (const auto& rule_id_rule : expected_rules.range_value_rules) {
+    const RangeValueRule rule = dut->rulebook()->GetRangeValueRule(rule_id_rule.first);
+    const std::vector<LaneSRange>& expected_ranges = rule_id_rule.second.zone().ranges();
+    ASSERT_EQ(expected_ranges.size(), rule.zone().ranges().size());
+    for (size_t i = 0; i < expected_ranges.size(); ++i) {
+      CompareLaneSRange(rule.zone().ranges()[i], expected_ranges[i], kLinearTolerance);
+    }
+  }
+  ASSERT_EQ(expected_rules.discrete_value_rules.size(), rules.discrete_value_rules.size());
+  for (const auto& rule_id_rule : expected_rules.discrete_value_rules) {
+    const DiscreteValueRule rule = dut->rulebook()->GetDiscreteValueRule(rule_id_rule.first);
+    const std::vector<LaneSRange>& expected_ranges = rule_id_rule.second.zone().ranges();
+    ASSERT_EQ(expected_ranges.size(), rule.zone().ranges().size());
+    for (size_t i = 0; i < expected_ranges.size(); ++i) {
+      CompareLaneSRange(rule.zone().ranges()[i], expected_ranges[i], kLinearTolerance);
+    }
+  }
+}
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 // Holds reference values to create Rule::Id and evaluate that
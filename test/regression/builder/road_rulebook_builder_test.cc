@@ -166,6 +166,29 @@ TEST_F(RoadRulebookBuilderTest, Constructor) {
   EXPECT_NO_THROW(RoadRuleBookBuilder(road_geometry_.get(), rule_registry_.get(), std::nullopt)());
   // Correct contruction.
   EXPECT_NO_THROW(RoadRuleBookBuilder(road_geometry_.get(), rule_registry_.get(), road_rulebook_path)());
+  // Throws because the number of threads is zero.
+  EXPECT_THROW(RoadRuleBookBuilder(road_geometry_.get(), rule_registry_.get(), std::nullopt, 0),
+               maliput::common::assertion_error);
+}
+
+// Rules built with multiple threads match the ones built sequentially.
+TEST_F(RoadRulebookBuilderTest, ParallelMatchesSequential) {
+  const auto sequential_rulebook = RoadRuleBookBuilder(road_geometry_.get(), rule_registry_.get(), std::nullopt)();
+  const auto parallel_rulebook = RoadRuleBookBuilder(road_geometry_.get(), rule_registry_.get(), std::nullopt, 4)();
+  const maliput::api::rules::RoadRulebook::QueryResults sequential_rules = sequential_rulebook->Rules();
+  const maliput::api::rules::RoadRulebook::QueryResults parallel_rules = parallel_rulebook->Rules();
+  ASSERT_EQ(sequential_rules.discrete_value_rules.size(), parallel_rules.discrete_value_rules.size());
+  ASSERT_EQ(sequential_rules.range_value_rules.size(), parallel_rules.range_value_rules.size());
+  for (const auto& id_rule : sequential_rules.discrete_value_rules) {
+    const auto it = parallel_rules.discrete_value_rules.find(id_rule.first);
+    ASSERT_NE(it, parallel_rules.discrete_value_rules.end());
+    EXPECT_TRUE(IsEqual<DiscreteValueRule>(id_rule.second, it->second, malidrive::constants::kLinearTolerance));
+  }
+  for (const auto& id_rule : sequential_rules.range_value_rules) {
+    const auto it = parallel_rules.range_value_rules.find(id_rule.first);
+    ASSERT_NE(it, parallel_rules.range_value_rules.end());
+    EXPECT_TRUE(IsEqual<RangeValueRule>(id_rule.second, it->second, malidrive::constants::kLinearTolerance));
+  }
 }
 
 // Evaluate some rules that are loaded out of the information provided by the XODR file.
@@ -0,0 +1,219 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/builder/road_selection.h"
+
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+#include "maliput_malidrive/builder/road_geometry_configuration.h"
+#include "maliput_malidrive/constants.h"
+#include "maliput_malidrive/test_utilities/road_geometry_configuration_for_xodrs.h"
+#include "maliput_malidrive/xodr/db_manager.h"
+#include "utility/resources.h"
+
+namespace malidrive {
+namespace builder {
+namespace test {
+namespace {
+
+using malidrive::test::GetRoadGeometryConfigurationFor;
+
+// Resource folder path defined via compile definition.
+static constexpr char kMalidriveResourceFolder[] = DEF_MALIDRIVE_RESOURCES;
+
+// TShapeRoad holds XODR Roads 0, 1 and 2 connected through XODR Junction 3, which holds XODR Roads 4 to 9.
+class GetRoadsInBuildRegionTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const RoadGeometryConfiguration rg_config{GetRoadGeometryConfigurationFor("TShapeRoad.xodr").value()};
+    manager_ = xodr::LoadDataBaseFromFile(
+        utility::FindResourceInPath(rg_config.opendrive_file, kMalidriveResourceFolder),
+        {rg_config.tolerances.linear_tolerance});
+  }
+
+  static std::set<xodr::RoadHeader::Id> ToIds(const std::set<std::string>& ids) {
+    std::set<xodr::RoadHeader::Id> road_ids;
+    for (const auto& id : ids) {
+      road_ids.insert(xodr::RoadHeader::Id(id));
+    }
+    return road_ids;
+  }
+
+  const maliput::math::Vector3 kZeroTranslation{0., 0., 0.};
+  std::unique_ptr<xodr::DBManager> manager_;
+};
+
+TEST_F(GetRoadsInBuildRegionTest, RoadIds) {
+  const BuildRegion build_region{std::nullopt, {"0", "2", "42" /* Unknown */}, 0 /* topological_radius */};
+  EXPECT_EQ(ToIds({"0", "2"}), GetRoadsInBuildRegion(*manager_, build_region, kZeroTranslation));
+}
+
+TEST_F(GetRoadsInBuildRegionTest, BoundingBox) {
+  // Only Road 0 overlaps the box once the translation is applied.
+  const BuildRegion build_region{BuildRegion::BoundingBox{{9., 9.}, {11., 11.}}, {}, 0 /* topological_radius */};
+  EXPECT_EQ(ToIds({"0"}), GetRoadsInBuildRegion(*manager_, build_region, {10., 10., 0.}));
+}
+
+TEST_F(GetRoadsInBuildRegionTest, BoundingBoxWithoutGeometryStarts) {
+  // The box is crossed by the middle of Road 0's line.
+  BuildRegion build_region{BuildRegion::BoundingBox{{20., -1.}, {25., 1.}}, {}, 0 /* topological_radius */};
+  EXPECT_EQ(ToIds({"0"}), GetRoadsInBuildRegion(*manager_, build_region, kZeroTranslation));
+  // The box holds the middle of the first arc of Roads 6 and 7, which belong to XODR Junction 3.
+  build_region.bounding_box = BuildRegion::BoundingBox{{52.2, -0.5}, {52.7, -0.1}};
+  EXPECT_EQ(ToIds({"4", "5", "6", "7", "8", "9"}), GetRoadsInBuildRegion(*manager_, build_region, kZeroTranslation));
+  // No geometry gets close to the box.
+  build_region.bounding_box = BuildRegion::BoundingBox{{10., 10.}, {20., 20.}};
+  EXPECT_TRUE(GetRoadsInBuildRegion(*manager_, build_region, kZeroTranslation).empty());
+}
+
+TEST_F(GetRoadsInBuildRegionTest, JunctionClosure) {
+  const BuildRegion build_region{std::nullopt, {"4"}, 0 /* topological_radius */};
+  EXPECT_EQ(ToIds({"4", "5", "6", "7", "8", "9"}), GetRoadsInBuildRegion(*manager_, build_region, kZeroTranslation));
+}
+
+TEST_F(GetRoadsInBuildRegionTest, TopologicalRadius) {
+  BuildRegion build_region{std::nullopt, {"0"}, 1 /* topological_radius */};
+  EXPECT_EQ(ToIds({"0", "4", "5", "6", "7", "8", "9"}),
+            GetRoadsInBuildRegion(*manager_, build_region, kZeroTranslation));
+  build_region.topological_radius = 2;
+  EXPECT_EQ(ToIds({"0", "1", "2", "4", "5", "6", "7", "8", "9"}),
+            GetRoadsInBuildRegion(*manager_, build_region, kZeroTranslation));
+  build_region.topological_radius = -1;
+  EXPECT_THROW(GetRoadsInBuildRegion(*manager_, build_region, kZeroTranslation), maliput::common::assertion_error);
+}
+
+// @returns A XODR Road whose plan view holds `geometry` only.
+xodr::RoadHeader MakeRoadHeaderWith(const xodr::Geometry& geometry) {
+  xodr::RoadHeader road_header;
+  road_header.reference_geometry.plan_view.geometries.push_back(geometry);
+  return road_header;
+}
+
+GTEST_TEST(IsRoadInRegionTest, Line) {
+  const xodr::RoadHeader road_header = MakeRoadHeaderWith(
+      {0. /* s_0 */, {1., 2.} /* start_point */, M_PI / 4. /* orientation */, 10. /* length */,
+       xodr::Geometry::Type::kLine, xodr::Geometry::Line{}});
+  const maliput::math::Vector3 kTranslation{1., -1., 0.};
+
+  // The end of the line is at {1. + 5. * sqrt(2.), 2. + 5. * sqrt(2.)} in the XODR frame.
+  EXPECT_TRUE(IsRoadInRegion(road_header, {8., 8.}, {9., 9.}, {0., 0., 0.}));
+  EXPECT_TRUE(IsRoadInRegion(road_header, {9., 7.}, {10., 8.}, kTranslation));
+  EXPECT_FALSE(IsRoadInRegion(road_header, {9., 9.}, {10., 10.}, kTranslation));
+  EXPECT_FALSE(IsRoadInRegion(road_header, {-5., -5.}, {0., 0.}, {0., 0., 0.}));
+}
+
+GTEST_TEST(IsRoadInRegionTest, Arc) {
+  // Half a circle of radius 10 turning left, from {0., 0.} to {0., 20.}. It is furthest from the Y axis at
+  // {10., 10.}.
+  const xodr::RoadHeader road_header = MakeRoadHeaderWith(
+      {0. /* s_0 */, {0., 0.} /* start_point */, 0. /* orientation */, 10. * M_PI /* length */,
+       xodr::Geometry::Type::kArc, xodr::Geometry::Arc{0.1}});
+
+  EXPECT_TRUE(IsRoadInRegion(road_header, {9.5, 9.}, {11., 11.}, {0., 0., 0.}));
+  EXPECT_FALSE(IsRoadInRegion(road_header, {10.5, 9.}, {11., 11.}, {0., 0., 0.}));
+  EXPECT_FALSE(IsRoadInRegion(road_header, {-5., 5.}, {-1., 15.}, {0., 0., 0.}));
+
+  // The same arc turning right, mirrored about the X axis.
+  const xodr::RoadHeader mirrored_road_header = MakeRoadHeaderWith(
+      {0. /* s_0 */, {0., 0.} /* start_point */, 0. /* orientation */, 10. * M_PI /* length */,
+       xodr::Geometry::Type::kArc, xodr::Geometry::Arc{-0.1}});
+  EXPECT_TRUE(IsRoadInRegion(mirrored_road_header, {9.5, -11.}, {11., -9.}, {0., 0., 0.}));
+  EXPECT_FALSE(IsRoadInRegion(mirrored_road_header, {9.5, 9.}, {11., 11.}, {0., 0., 0.}));
+}
+
+GTEST_TEST(IsRoadInRegionTest, Spiral) {
+  // Its heading is 0.005 * s^2, so it is close to {9.75, 1.64} at s = 10 and heads back along -X at s = 25.
+  const xodr::RoadHeader road_header = MakeRoadHeaderWith(
+      {0. /* s_0 */, {0., 0.} /* start_point */, 0. /* orientation */, 25. /* length */,
+       xodr::Geometry::Type::kSpiral, xodr::Geometry::Spiral{0., 0.25}});
+
+  EXPECT_TRUE(IsRoadInRegion(road_header, {9., 1.}, {11., 2.5}, {0., 0., 0.}));
+  EXPECT_FALSE(IsRoadInRegion(road_header, {30., 30.}, {40., 40.}, {0., 0., 0.}));
+  EXPECT_FALSE(IsRoadInRegion(road_header, {-20., -20.}, {-10., -10.}, {0., 0., 0.}));
+}
+
+// Returns the XODR description in `xodr_file` with the first occurrence of `from` replaced by `to`.
+std::string ReadAndEditXodrFile(const std::string& xodr_file, const std::string& from, const std::string& to) {
+  std::ifstream file(utility::FindResourceInPath(xodr_file, kMalidriveResourceFolder));
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  std::string xodr_description = buffer.str();
+  const std::size_t position = xodr_description.find(from);
+  EXPECT_NE(std::string::npos, position);
+  return xodr_description.replace(position, from.size(), to);
+}
+
+class DiffRoadsTest : public GetRoadsInBuildRegionTest {
+ protected:
+  std::unique_ptr<xodr::DBManager> LoadManager(const std::string& xodr_file) const {
+    return xodr::LoadDataBaseFromFile(utility::FindResourceInPath(xodr_file, kMalidriveResourceFolder),
+                                      {constants::kLinearTolerance});
+  }
+};
+
+TEST_F(DiffRoadsTest, SameDescription) {
+  const RoadDiff dut = DiffRoads(*manager_, *LoadManager("TShapeRoad.xodr"));
+  EXPECT_TRUE(dut.added.empty());
+  EXPECT_TRUE(dut.removed.empty());
+  EXPECT_TRUE(dut.changed.empty());
+  EXPECT_EQ(ToIds({"0", "1", "2", "4", "5", "6", "7", "8", "9"}), dut.unchanged);
+}
+
+TEST_F(DiffRoadsTest, EditedRoad) {
+  const auto edited_manager = xodr::LoadDataBaseFromStr(
+      ReadAndEditXodrFile("TShapeRoad.xodr", "name=\"Road 2\"", "name=\"Road 2 edited\""),
+      {constants::kLinearTolerance});
+  const RoadDiff dut = DiffRoads(*manager_, *edited_manager);
+  EXPECT_TRUE(dut.added.empty());
+  EXPECT_TRUE(dut.removed.empty());
+  EXPECT_EQ(ToIds({"2"}), dut.changed);
+  EXPECT_EQ(ToIds({"0", "1", "4", "5", "6", "7", "8", "9"}), dut.unchanged);
+}
+
+TEST_F(DiffRoadsTest, DifferentDescriptions) {
+  // LShapeRoad holds XODR Roads 1, 2 and 3, which are described differently than TShapeRoad's.
+  const RoadDiff dut = DiffRoads(*manager_, *LoadManager("LShapeRoad.xodr"));
+  EXPECT_EQ(ToIds({"3"}), dut.added);
+  EXPECT_EQ(ToIds({"0", "4", "5", "6", "7", "8", "9"}), dut.removed);
+  EXPECT_EQ(ToIds({"1", "2"}), dut.changed);
+  EXPECT_TRUE(dut.unchanged.empty());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace builder
+}  // namespace malidrive
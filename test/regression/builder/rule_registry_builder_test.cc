@@ -31,11 +31,13 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <variant>
 
 #include <gtest/gtest.h>
 #include <maliput/api/rules/rule_registry.h>
 #include <maliput/base/rule_registry.h>
+#include <maliput/common/assertion_error.h>
 
 #include "maliput_malidrive/builder/params.h"
 #include "maliput_malidrive/builder/road_geometry_builder.h"
@@ -284,6 +286,24 @@ TEST_F(RuleRegistryBuilderTest, WithRuleRegistryFile) {
   TestViaYamlAddedMaximumWeightRuleType();
 }
 
+// The yaml file is loaded apart from the RoadGeometry and then completed.
+TEST_F(RuleRegistryBuilderTest, WithPreloadedRuleRegistry) {
+  auto loaded_rule_registry = RuleRegistryBuilder::LoadRuleRegistry(rule_registry_path);
+  ASSERT_NE(loaded_rule_registry, nullptr);
+  // The path provided at construction is ignored.
+  rule_registry_ = RuleRegistryBuilder(road_geometry_.get(), std::nullopt)(std::move(loaded_rule_registry));
+  TestProgramaticallyAddedVehicleExclusiveRuleType();
+  TestProgramaticallyAddedVehicleUsageRuleType();
+  TestProgramaticallyAddedDirectionUsageRuleType();
+  TestProgramaticallyAddedSpeedLimitRuleType();
+
+  TestViaYamlAddedRightOfWayRuleType();
+  TestViaYamlAddedVehicleStopInZoneBehaviorRuleType();
+  TestViaYamlAddedMaximumWeightRuleType();
+
+  EXPECT_THROW(RuleRegistryBuilder(road_geometry_.get(), std::nullopt)(nullptr), maliput::common::assertion_error);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace builder
@@ -29,11 +29,14 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/loader/loader.h"
 
+#include <future>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "maliput_malidrive/builder/build_control.h"
 #include "maliput_malidrive/builder/params.h"
 #include "maliput_malidrive/builder/road_geometry_configuration.h"
 #include "maliput_malidrive/builder/road_network_builder.h"
@@ -76,6 +79,62 @@ TEST_F(LoaderTestSingleLane, LoadARoadNetwork) {
   EXPECT_NE(lane_id_lane.at(kLaneId2), nullptr);
 }
 
+TEST_F(LoaderTestSingleLane, ReloadARoadNetwork) {
+  std::unique_ptr<maliput::api::RoadNetwork> previous_road_network =
+      loader::Load<builder::RoadNetworkBuilder>(road_geometry_configuration_);
+  const double previous_length = previous_road_network->road_geometry()->ById().GetLane(kLaneId1)->length();
+
+  const std::unique_ptr<maliput::api::RoadNetwork> dut =
+      loader::Reload<builder::RoadNetworkBuilder>(road_geometry_configuration_, *previous_road_network);
+  // The reloaded RoadNetwork does not depend on the previous one.
+  previous_road_network.reset();
+  const auto rg = dut->road_geometry();
+  EXPECT_EQ(road_geometry_configuration_.at(builder::params::kRoadGeometryId), rg->id().string());
+  const auto lane_id_lane = rg->ById().GetLanes();
+  EXPECT_EQ(kNumLanes, lane_id_lane.size());
+  ASSERT_NE(lane_id_lane.at(kLaneId1), nullptr);
+  EXPECT_DOUBLE_EQ(previous_length, lane_id_lane.at(kLaneId1)->length());
+}
+
+TEST_F(LoaderTestSingleLane, LoadAsyncARoadNetwork) {
+  std::future<std::unique_ptr<maliput::api::RoadNetwork>> future =
+      loader::LoadAsync<builder::RoadNetworkBuilder>(road_geometry_configuration_);
+  const std::unique_ptr<maliput::api::RoadNetwork> dut = future.get();
+  ASSERT_NE(dut, nullptr);
+  const auto rg = dut->road_geometry();
+  EXPECT_EQ(road_geometry_configuration_.at(builder::params::kRoadGeometryId), rg->id().string());
+  EXPECT_EQ(kNumLanes, rg->ById().GetLanes().size());
+}
+
+TEST_F(LoaderTestSingleLane, LoadAsyncReportsProgress) {
+  std::vector<builder::BuildProgress> progress;
+  builder::BuildControl build_control;
+  build_control.progress_callback = [&progress](const builder::BuildProgress& p) { progress.push_back(p); };
+
+  const std::unique_ptr<maliput::api::RoadNetwork> dut =
+      loader::LoadAsync<builder::RoadNetworkBuilder>(road_geometry_configuration_, build_control).get();
+  ASSERT_NE(dut, nullptr);
+
+  ASSERT_FALSE(progress.empty());
+  EXPECT_EQ(builder::BuildPhase::kParsing, progress.front().phase);
+  EXPECT_EQ(builder::BuildPhase::kDone, progress.back().phase);
+  for (std::size_t i = 1; i < progress.size(); ++i) {
+    EXPECT_LE(static_cast<int>(progress[i - 1].phase), static_cast<int>(progress[i].phase));
+    EXPECT_LE(progress[i].completed, progress[i].total);
+  }
+}
+
+TEST_F(LoaderTestSingleLane, LoadAsyncCancelled) {
+  auto cancellation_token = std::make_shared<builder::CancellationToken>();
+  cancellation_token->Cancel();
+  builder::BuildControl build_control;
+  build_control.cancellation_token = cancellation_token;
+
+  std::future<std::unique_ptr<maliput::api::RoadNetwork>> future =
+      loader::LoadAsync<builder::RoadNetworkBuilder>(road_geometry_configuration_, build_control);
+  EXPECT_THROW(future.get(), builder::BuildCancelledError);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace loader
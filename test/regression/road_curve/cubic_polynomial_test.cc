@@ -29,6 +29,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/road_curve/cubic_polynomial.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <maliput/common/assertion_error.h>
 
@@ -113,6 +115,27 @@ GTEST_TEST(CubicPolynomial, Range) {
   EXPECT_THROW(dut.f_dot_dot(kP1 + 1.), maliput::common::assertion_error);
 }
 
+GTEST_TEST(CubicPolynomial, Batch) {
+  const CubicPolynomial dut(kA, kB, kC, kD, kP0, kP1, kTolerance);
+  const std::vector<double> kPs{0.5, 20.5, 50.};
+  std::vector<double> f;
+  std::vector<double> f_dot;
+  dut.f(kPs, &f);
+  dut.f_dot(kPs, &f_dot);
+  ASSERT_EQ(kPs.size(), f.size());
+  ASSERT_EQ(kPs.size(), f_dot.size());
+  EXPECT_NEAR(f[0], 6.125, kTolerance);
+  EXPECT_NEAR(f_dot[0], 5.75, kTolerance);
+  EXPECT_NEAR(f[1], 9521.125, kTolerance);
+  EXPECT_NEAR(f_dot[1], 1345.75, kTolerance);
+  EXPECT_NEAR(f[2], 130154, kTolerance);
+  EXPECT_NEAR(f_dot[2], 7703., kTolerance);
+
+  EXPECT_THROW(dut.f({kP1 + 1.}, &f), maliput::common::assertion_error);
+  EXPECT_THROW(dut.f_dot({kP1 + 1.}, &f_dot), maliput::common::assertion_error);
+  EXPECT_THROW(dut.f(kPs, nullptr), maliput::common::assertion_error);
+}
+
 GTEST_TEST(CubicPolynomial, IsG1Contiguous) {
   EXPECT_TRUE(CubicPolynomial(kA, kB, kC, kD, kP0, kP1, kTolerance).IsG1Contiguous());
 }
@@ -0,0 +1,288 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2020-2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_malidrive/road_curve/joint_road_curve_offset.h"
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_malidrive/road_curve/arc_ground_curve.h"
+#include "maliput_malidrive/road_curve/cubic_polynomial.h"
+#include "maliput_malidrive/road_curve/function.h"
+#include "maliput_malidrive/road_curve/line_ground_curve.h"
+#include "maliput_malidrive/road_curve/piecewise_ground_curve.h"
+#include "maliput_malidrive/road_curve/road_curve_offset.h"
+
+namespace malidrive {
+namespace road_curve {
+namespace test {
+namespace {
+
+using maliput::math::Vector2;
+
+std::unique_ptr<road_curve::Function> MakeConstantCubicPolynomial(double d, double p0, double p1,
+                                                                  double linear_tolerance) {
+  return std::make_unique<road_curve::CubicPolynomial>(0., 0., 0., d, p0, p1, linear_tolerance);
+}
+
+class JointRoadCurveOffsetTest : public ::testing::Test {
+ public:
+  const double kLinearTolerance{1e-12};
+  // Interpolated values are compared with a looser tolerance.
+  const double kTolerance{1e-9};
+  const double kScaleLength{1.};
+  const double kP0{10.};
+  const double kP1{20.};
+  const double kDeltaP{kP1 - kP0};
+  const Vector2 kXy0{1., 2.};
+  const double kZero{0.};
+  const double kR0{0.};
+  const double kRLeft{4.};
+  const double kRRight{-2.5};
+  const bool kAssertContiguity{true};
+
+  const std::array<double, 5> kPs{kP0, kP0 + kDeltaP * 0.25, kP0 + kDeltaP * 0.5, kP0 + kDeltaP * 0.75, kP1};
+  const std::unique_ptr<Function> lane_offset_0 = MakeConstantCubicPolynomial(kR0, kP0, kP1, kLinearTolerance);
+  const std::unique_ptr<Function> lane_offset_left = MakeConstantCubicPolynomial(kRLeft, kP0, kP1, kLinearTolerance);
+  const std::unique_ptr<Function> lane_offset_right = MakeConstantCubicPolynomial(kRRight, kP0, kP1, kLinearTolerance);
+  const std::vector<const Function*> kLaneOffsets{lane_offset_0.get(), lane_offset_left.get(),
+                                                  lane_offset_right.get()};
+
+  std::unique_ptr<RoadCurve> road_curve_{};
+};
+
+// Flat, non-elevated and non-superelevated line road curve.
+class FlatLineJointRoadCurveOffsetTest : public JointRoadCurveOffsetTest {
+ protected:
+  void SetUp() override {
+    auto ground_curve = std::make_unique<LineGroundCurve>(kLinearTolerance, kXy0, kDXy, kP0, kP1);
+    auto elevation = std::make_unique<CubicPolynomial>(kZero, kZero, kZero, kZero, kP0, kP1, kLinearTolerance);
+    auto superelevation = std::make_unique<CubicPolynomial>(kZero, kZero, kZero, kZero, kP0, kP1, kLinearTolerance);
+    road_curve_ = std::make_unique<RoadCurve>(kLinearTolerance, kScaleLength, std::move(ground_curve),
+                                              std::move(elevation), std::move(superelevation), kAssertContiguity);
+  }
+
+  const Vector2 kDXy{3., 4.};
+  const double kArcLength{kDXy.norm()};
+  const std::array<double, 5> kSs{0., 0.25 * kArcLength, 0.5 * kArcLength, 0.75 * kArcLength, kArcLength};
+};
+
+TEST_F(FlatLineJointRoadCurveOffsetTest, ConstructorAssertions) {
+  EXPECT_THROW(JointRoadCurveOffset(nullptr, kLaneOffsets, kP0, kP1), maliput::common::assertion_error);
+  EXPECT_THROW(JointRoadCurveOffset(road_curve_.get(), {lane_offset_0.get(), nullptr}, kP0, kP1),
+               maliput::common::assertion_error);
+  const double kWrongP0{5.};
+  const double kWrongP1{3.};
+  EXPECT_THROW(JointRoadCurveOffset(road_curve_.get(), kLaneOffsets, kWrongP0, kWrongP1),
+               maliput::common::assertion_error);
+  const std::size_t kWrongNumThreads{0};
+  EXPECT_THROW(JointRoadCurveOffset(road_curve_.get(), kLaneOffsets, kP0, kP1, kWrongNumThreads),
+               maliput::common::assertion_error);
+}
+
+TEST_F(FlatLineJointRoadCurveOffsetTest, Accessors) {
+  const JointRoadCurveOffset dut(road_curve_.get(), kLaneOffsets, kP0, kP1);
+
+  EXPECT_EQ(road_curve_.get(), dut.road_curve());
+  EXPECT_EQ(3, dut.num_offsets());
+  EXPECT_EQ(kP0, dut.p0());
+  EXPECT_EQ(kP1, dut.p1());
+  EXPECT_EQ(1, dut.num_chunks());
+  EXPECT_DOUBLE_EQ(/* Minimum allowed value */ 1e-8, dut.relative_tolerance());
+  EXPECT_THROW(dut.SFromP(-1), maliput::common::assertion_error);
+  EXPECT_THROW(dut.PFromS(3), maliput::common::assertion_error);
+}
+
+TEST_F(FlatLineJointRoadCurveOffsetTest, SFromPAndPFromS) {
+  const JointRoadCurveOffset dut(road_curve_.get(), kLaneOffsets, kP0, kP1);
+
+  for (int j = 0; j < dut.num_offsets(); ++j) {
+    const auto s_from_p = dut.SFromP(j);
+    const auto p_from_s = dut.PFromS(j);
+    for (std::size_t i = 0; i < kPs.size(); ++i) {
+      EXPECT_NEAR(kSs[i], s_from_p(kPs[i]), kTolerance);
+      EXPECT_NEAR(kPs[i], p_from_s(kSs[i]), kTolerance);
+    }
+  }
+}
+
+// The RoadCurve is evaluated at the same nodes regardless of the number of
+// offsets being integrated.
+TEST_F(FlatLineJointRoadCurveOffsetTest, SharedEvaluations) {
+  const JointRoadCurveOffset single_offset_dut(road_curve_.get(), {lane_offset_0.get()}, kP0, kP1);
+  const JointRoadCurveOffset dut(road_curve_.get(), kLaneOffsets, kP0, kP1);
+
+  EXPECT_EQ(single_offset_dut.num_evaluations(), dut.num_evaluations());
+}
+
+// Flat, non-elevated and non-superelevated arc road curve.
+class FlatArcJointRoadCurveOffsetTest : public JointRoadCurveOffsetTest {
+ protected:
+  void SetUp() override {
+    auto ground_curve =
+        std::make_unique<ArcGroundCurve>(kLinearTolerance, kXy0, kStartHeading, kCurvature, kArcLength, kP0, kP1);
+    auto elevation = std::make_unique<CubicPolynomial>(kZero, kZero, kZero, kZero, kP0, kP1, kLinearTolerance);
+    auto superelevation = std::make_unique<CubicPolynomial>(kZero, kZero, kZero, kZero, kP0, kP1, kLinearTolerance);
+    road_curve_ = std::make_unique<RoadCurve>(kLinearTolerance, kScaleLength, std::move(ground_curve),
+                                              std::move(elevation), std::move(superelevation), kAssertContiguity);
+  }
+
+  const double kStartHeading{M_PI / 3.};
+  const double kCurvature{-0.025};  // Equivalent radius = 40m.
+  const double kRadiusR0{std::abs(1. / kCurvature)};
+  const double kArcLength{100.};
+  const double kDTheta{kArcLength / kRadiusR0};
+  const std::array<double, 3> kRadii{kRadiusR0, kRadiusR0 + kRLeft, kRadiusR0 + kRRight};
+};
+
+TEST_F(FlatArcJointRoadCurveOffsetTest, SFromPAndPFromS) {
+  const JointRoadCurveOffset dut(road_curve_.get(), kLaneOffsets, kP0, kP1);
+
+  for (int j = 0; j < dut.num_offsets(); ++j) {
+    const auto s_from_p = dut.SFromP(j);
+    const auto p_from_s = dut.PFromS(j);
+    for (std::size_t i = 0; i < kPs.size(); ++i) {
+      const double expected_s = (kPs[i] - kP0) / kDeltaP * kDTheta * kRadii[j];
+      EXPECT_NEAR(expected_s, s_from_p(kPs[i]), kTolerance);
+      EXPECT_NEAR(kPs[i], p_from_s(expected_s), kTolerance);
+    }
+  }
+}
+
+// The batched mapping matches the single s one, for unsorted and out of range s values.
+TEST_F(FlatArcJointRoadCurveOffsetTest, PFromSBatch) {
+  const JointRoadCurveOffset dut(road_curve_.get(), kLaneOffsets, kP0, kP1);
+
+  for (int j = 0; j < dut.num_offsets(); ++j) {
+    const double arc_length = kDTheta * kRadii[j];
+    const std::vector<double> kS{0.5 * arc_length, 0., arc_length, 0.25 * arc_length, 0.3 * arc_length,
+                                 0.9 * arc_length, arc_length + 1., -1.};
+    const auto p_from_s = dut.PFromS(j);
+    const auto p_from_s_batch = dut.PFromSBatch(j);
+    std::vector<double> p;
+    p_from_s_batch(kS, &p);
+    ASSERT_EQ(kS.size(), p.size());
+    for (std::size_t i = 0; i < kS.size(); ++i) {
+      EXPECT_NEAR(p_from_s(kS[i]), p[i], kTolerance);
+    }
+    EXPECT_THROW(p_from_s_batch(kS, nullptr), maliput::common::assertion_error);
+  }
+  EXPECT_THROW(dut.PFromSBatch(3), maliput::common::assertion_error);
+}
+
+// Compares a non constant offset against RoadCurveOffset.
+TEST_F(FlatArcJointRoadCurveOffsetTest, MatchesRoadCurveOffset) {
+  const double kMatchTolerance{1e-5};
+  const std::unique_ptr<Function> cubic_lane_offset =
+      std::make_unique<CubicPolynomial>(1e-3, -2e-2, 0.1, 1., kP0, kP1, kLinearTolerance);
+  const JointRoadCurveOffset dut(road_curve_.get(), {lane_offset_left.get(), cubic_lane_offset.get()}, kP0, kP1);
+  const RoadCurveOffset expected(road_curve_.get(), cubic_lane_offset.get(), kP0, kP1);
+
+  const auto s_from_p = dut.SFromP(1);
+  const auto p_from_s = dut.PFromS(1);
+  const auto expected_s_from_p = expected.SFromP();
+  const auto expected_p_from_s = expected.PFromS();
+  for (const double p : kPs) {
+    const double s = expected_s_from_p(p);
+    EXPECT_NEAR(s, s_from_p(p), kMatchTolerance);
+    EXPECT_NEAR(expected_p_from_s(s), p_from_s(s), kMatchTolerance);
+  }
+}
+
+// Flat, non-elevated and non-superelevated road curve made of a line followed
+// by an arc and another line.
+class FlatPiecewiseJointRoadCurveOffsetTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::vector<std::unique_ptr<GroundCurve>> ground_curves;
+    ground_curves.push_back(std::make_unique<LineGroundCurve>(kLinearTolerance, Vector2{0., 0.},
+                                                              Vector2{kLineLength, 0.}, 0., kLineLength));
+    ground_curves.push_back(std::make_unique<ArcGroundCurve>(kLinearTolerance, Vector2{kLineLength, 0.}, 0.,
+                                                             kCurvature, kArcLength, 0., kArcLength));
+    ground_curves.push_back(std::make_unique<LineGroundCurve>(kLinearTolerance, Vector2{kLineLength + kRadius, kRadius},
+                                                              Vector2{0., kLineLength}, 0., kLineLength));
+    auto ground_curve =
+        std::make_unique<PiecewiseGroundCurve>(std::move(ground_curves), kLinearTolerance, kAngularTolerance);
+    const double p1 = ground_curve->p1();
+    auto elevation = std::make_unique<CubicPolynomial>(0., 0., 0., 0., 0., p1, kLinearTolerance);
+    auto superelevation = std::make_unique<CubicPolynomial>(0., 0., 0., 0., 0., p1, kLinearTolerance);
+    road_curve_ = std::make_unique<RoadCurve>(kLinearTolerance, kScaleLength, std::move(ground_curve),
+                                              std::move(elevation), std::move(superelevation), kAssertContiguity);
+    lane_offset_ = std::make_unique<CubicPolynomial>(0., 0., 0., kR, 0., p1, kLinearTolerance);
+  }
+
+  const double kLinearTolerance{1e-12};
+  const double kAngularTolerance{1e-12};
+  const double kTolerance{1e-9};
+  const double kScaleLength{1.};
+  const bool kAssertContiguity{true};
+  const double kLineLength{100.};
+  const double kRadius{50.};
+  const double kCurvature{1. / kRadius};
+  const double kArcLength{M_PI / 2. * kRadius};
+  const double kR{2.};
+  std::unique_ptr<RoadCurve> road_curve_{};
+  std::unique_ptr<Function> lane_offset_{};
+};
+
+TEST_F(FlatPiecewiseJointRoadCurveOffsetTest, ChunksAreStitched) {
+  const double p0 = road_curve_->p0();
+  const double p1 = road_curve_->p1();
+  const std::size_t kNumThreads{3};
+  const JointRoadCurveOffset sequential_dut(road_curve_.get(), {lane_offset_.get()}, p0, p1);
+  const JointRoadCurveOffset parallel_dut(road_curve_.get(), {lane_offset_.get()}, p0, p1, kNumThreads);
+
+  EXPECT_EQ(3, sequential_dut.num_chunks());
+  EXPECT_EQ(3, parallel_dut.num_chunks());
+  EXPECT_EQ(sequential_dut.num_evaluations(), parallel_dut.num_evaluations());
+
+  // The lane is on the inner side of the arc.
+  const double kArcLengthAtR{M_PI / 2. * (kRadius - kR)};
+  const std::array<double, 4> kPs{0., kLineLength, kLineLength + kArcLength, p1};
+  const std::array<double, 4> kSs{0., kLineLength, kLineLength + kArcLengthAtR, 2. * kLineLength + kArcLengthAtR};
+  for (const JointRoadCurveOffset* dut : {&sequential_dut, &parallel_dut}) {
+    const auto s_from_p = dut->SFromP(0);
+    const auto p_from_s = dut->PFromS(0);
+    for (std::size_t i = 0; i < kPs.size(); ++i) {
+      EXPECT_NEAR(kSs[i], s_from_p(kPs[i]), kTolerance);
+      EXPECT_NEAR(kPs[i], p_from_s(kSs[i]), kTolerance);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace road_curve
+}  // namespace malidrive
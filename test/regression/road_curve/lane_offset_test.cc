@@ -29,13 +29,16 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/road_curve/lane_offset.h"
 
+#include <cstddef>
 #include <optional>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <maliput/common/assertion_error.h>
 
 #include "maliput_malidrive/common/macros.h"
 #include "maliput_malidrive/road_curve/cubic_polynomial.h"
+#include "maliput_malidrive/test_utilities/function_stub.h"
 
 namespace malidrive {
 namespace road_curve {
@@ -316,6 +319,90 @@ TEST_F(LaneOffsetTest, IsG1Contiguous) {
   EXPECT_TRUE(dut.IsG1Contiguous());
 }
 
+TEST_F(LaneOffsetTest, BatchedFunctionApi) {
+  const std::vector<double> kP{0.5, 50., 20.5, kP0};
+  // The batched path adds the same terms in the same order as the scalar one.
+  const auto expect_batch_matches_scalar = [&kP](const LaneOffset& dut) {
+    std::vector<double> images;
+    dut.f(kP, &images);
+    ASSERT_EQ(kP.size(), images.size());
+    for (std::size_t i = 0; i < kP.size(); ++i) {
+      EXPECT_DOUBLE_EQ(dut.f(kP[i]), images[i]);
+    }
+    dut.f_dot(kP, &images);
+    for (std::size_t i = 0; i < kP.size(); ++i) {
+      EXPECT_DOUBLE_EQ(dut.f_dot(kP[i]), images[i]);
+    }
+    dut.f_dot_dot(kP, &images);
+    for (std::size_t i = 0; i < kP.size(); ++i) {
+      EXPECT_DOUBLE_EQ(dut.f_dot_dot(kP[i]), images[i]);
+    }
+    EXPECT_THROW(dut.f({kP.front(), 51.}, &images), maliput::common::assertion_error);
+  };
+  // At left with inner lanes.
+  {
+    const LaneOffset dut{{{&kPreviousLaneOffsetAtLeft, &kPreviousLaneWidth}},
+                         &kLaneWidth,
+                         &kReferenceLineOffset,
+                         LaneOffset::kAtLeftFromCenterLane,
+                         kP0,
+                         kP1,
+                         kTolerance};
+    expect_batch_matches_scalar(dut);
+  }
+  // At right with inner lanes.
+  {
+    const LaneOffset dut{{{&kPreviousLaneOffsetAtRight, &kPreviousLaneWidth}},
+                         &kLaneWidth,
+                         &kReferenceLineOffset,
+                         LaneOffset::kAtRightFromCenterLane,
+                         kP0,
+                         kP1,
+                         kTolerance};
+    expect_batch_matches_scalar(dut);
+  }
+  // At left without inner lanes.
+  {
+    const LaneOffset dut{
+        kNoAdjacentLane, &kLaneWidth, &kReferenceLineOffset, LaneOffset::kAtLeftFromCenterLane, kP0, kP1, kTolerance};
+    expect_batch_matches_scalar(dut);
+  }
+  // At right without inner lanes.
+  {
+    const LaneOffset dut{
+        kNoAdjacentLane, &kLaneWidth, &kReferenceLineOffset, LaneOffset::kAtRightFromCenterLane, kP0, kP1, kTolerance};
+    expect_batch_matches_scalar(dut);
+  }
+}
+
+// Each function composing the LaneOffset is evaluated with a single batched call.
+TEST_F(LaneOffsetTest, BatchedFunctionApiIsBatchedPerFunction) {
+  constexpr bool kIsG1Contiguous{true};
+  const FunctionStub adjacent_lane_offset{1., 2., 3., kP0, kP1, kIsG1Contiguous};
+  const FunctionStub adjacent_lane_width{4., 5., 6., kP0, kP1, kIsG1Contiguous};
+  const FunctionStub lane_width{7., 8., 9., kP0, kP1, kIsG1Contiguous};
+  const FunctionStub reference_line_offset{10., 11., 12., kP0, kP1, kIsG1Contiguous};
+  const LaneOffset dut{{{&adjacent_lane_offset, &adjacent_lane_width}},
+                       &lane_width,
+                       &reference_line_offset,
+                       LaneOffset::kAtLeftFromCenterLane,
+                       kP0,
+                       kP1,
+                       kTolerance};
+
+  std::vector<double> images;
+  dut.f({kP0, 20.5, kP1}, &images);
+  EXPECT_EQ(std::vector<double>(3, 1. + 4. / 2. + 7. / 2.), images);
+
+  for (const FunctionStub* stub : {&adjacent_lane_offset, &adjacent_lane_width, &lane_width}) {
+    EXPECT_EQ(1, stub->num_batch_evaluations());
+    EXPECT_EQ(0, stub->num_evaluations());
+  }
+  // The reference line offset is not needed when there is an adjacent lane.
+  EXPECT_EQ(0, reference_line_offset.num_batch_evaluations());
+  EXPECT_EQ(0, reference_line_offset.num_evaluations());
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace road_curve
@@ -29,6 +29,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/road_curve/line_ground_curve.h"
 
+#include <cstddef>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <maliput/common/assertion_error.h>
 #include <maliput/math/compare.h>
@@ -308,6 +311,32 @@ TEST_F(LineGroundCurveTest, GInverse) {
   EXPECT_NEAR(kP1, quadrant3_dut_->GInverse({4.0, 4.0}), kTolerance);
 }
 
+TEST_F(LineGroundCurveTest, Batch) {
+  const std::vector<double> kPs{kP0, 0.75 * kP0 + 0.25 * kP1, 0.5 * (kP0 + kP1), kP1};
+  for (const GroundCurve* dut : {trivial_dut_.get(), quadrant1_dut_.get(), quadrant3_dut_.get()}) {
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> x_dot;
+    std::vector<double> y_dot;
+    std::vector<double> headings;
+    dut->G(kPs, &x, &y);
+    dut->GDot(kPs, &x_dot, &y_dot);
+    dut->Heading(kPs, &headings);
+    ASSERT_EQ(kPs.size(), x.size());
+    ASSERT_EQ(kPs.size(), x_dot.size());
+    ASSERT_EQ(kPs.size(), headings.size());
+    for (std::size_t i = 0; i < kPs.size(); ++i) {
+      EXPECT_TRUE(AssertCompare(CompareVectors(dut->G(kPs[i]), Vector2{x[i], y[i]}, kTolerance)));
+      EXPECT_TRUE(AssertCompare(CompareVectors(dut->GDot(kPs[i]), Vector2{x_dot[i], y_dot[i]}, kTolerance)));
+      EXPECT_NEAR(dut->Heading(kPs[i]), headings[i], kTolerance);
+    }
+  }
+  std::vector<double> x;
+  std::vector<double> y;
+  EXPECT_THROW(trivial_dut_->G({kP1 + 1.}, &x, &y), maliput::common::assertion_error);
+  EXPECT_THROW(trivial_dut_->G(kPs, nullptr, &y), maliput::common::assertion_error);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace road_curve
@@ -174,6 +174,49 @@ TEST_F(PiecewiseFunctionTest, FunctionApi) {
   EXPECT_DOUBLE_EQ(kFDotDotC, dut.f_dot_dot(kP1A + kP1B - kP0B + kP1C - kP0C));
 }
 
+// The batch is split by piece and each piece is evaluated with a single batched call.
+TEST_F(PiecewiseFunctionTest, BatchedFunctionApi) {
+  const double kEpsilon = 1e-10;
+
+  std::vector<std::unique_ptr<Function>> functions;
+  functions.push_back(std::make_unique<FunctionStub>(kFA, kFDotA, kFDotDotA, kP0A, kP1A, kIsG1Contiguous));
+  functions.push_back(std::make_unique<FunctionStub>(kFB, kFDotB, kFDotDotB, kP0B, kP1B, kIsG1Contiguous));
+  functions.push_back(std::make_unique<FunctionStub>(kFC, kFDotC, kFDotDotC, kP0C, kP1C, kIsG1Contiguous));
+  std::vector<const FunctionStub*> stubs;
+  for (const auto& function : functions) {
+    stubs.push_back(static_cast<const FunctionStub*>(function.get()));
+  }
+
+  const PiecewiseFunction dut(std::move(functions), kTolerance);
+
+  // Elements of different pieces are interleaved on purpose.
+  const std::vector<double> kP{kP1A + kP1B - kP0B,
+                               (kP1A + kP0A) / 2.,
+                               kP1A,
+                               kP1A - kEpsilon,
+                               kP1A + (kP1B - kP0B) / 2.,
+                               kP0A + kP1A - kP0A + kP1B - kP0B + kP1C - kP0C};
+  const std::vector<double> kExpectedF{kFC, kFA, kFB, kFA, kFB, kFC};
+  const std::vector<double> kExpectedFDot{kFDotC, kFDotA, kFDotB, kFDotA, kFDotB, kFDotC};
+  const std::vector<double> kExpectedFDotDot{kFDotDotC, kFDotDotA, kFDotDotB, kFDotDotA, kFDotDotB, kFDotDotC};
+
+  std::vector<double> images;
+  dut.f(kP, &images);
+  EXPECT_EQ(kExpectedF, images);
+  dut.f_dot(kP, &images);
+  EXPECT_EQ(kExpectedFDot, images);
+  dut.f_dot_dot(kP, &images);
+  EXPECT_EQ(kExpectedFDotDot, images);
+
+  for (const FunctionStub* stub : stubs) {
+    EXPECT_EQ(3, stub->num_batch_evaluations());
+    EXPECT_EQ(0, stub->num_evaluations());
+  }
+
+  EXPECT_THROW(dut.f({kP0A - 1.}, &images), maliput::common::assertion_error);
+  EXPECT_THROW(dut.f(kP, nullptr), maliput::common::assertion_error);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace road_curve
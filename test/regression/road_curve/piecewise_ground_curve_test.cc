@@ -29,6 +29,10 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/road_curve/piecewise_ground_curve.h"
 
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <maliput/common/assertion_error.h>
 #include <maliput/math/compare.h>
@@ -216,6 +220,107 @@ TEST_F(PiecewiseGroundCurveTest, ArcLength) {
 
 TEST_F(PiecewiseGroundCurveTest, IsGContiguous) { EXPECT_TRUE(piecewise_ground_curve_->IsG1Contiguous()); }
 
+TEST_F(PiecewiseGroundCurveTest, Breakpoints) {
+  const std::vector<double> kExpectedBreakpoints{kPLineXToArcRight, kPLineXToArcRight + kPArcToLineYRight};
+  const std::vector<double> breakpoints = piecewise_ground_curve_->Breakpoints();
+  ASSERT_EQ(kExpectedBreakpoints.size(), breakpoints.size());
+  for (size_t i = 0; i < kExpectedBreakpoints.size(); ++i) {
+    EXPECT_NEAR(kExpectedBreakpoints[i], breakpoints[i], kLinearTolerance);
+  }
+  // Single geometry curves have no breakpoints.
+  EXPECT_TRUE(kExpectedArc->Breakpoints().empty());
+}
+
+// The batch is split by GroundCurve and the results match the single p evaluations.
+TEST_F(PiecewiseGroundCurveTest, BatchedEvaluation) {
+  // Elements of different GroundCurves are interleaved on purpose.
+  const std::vector<double> kP{kP1,
+                               kP0,
+                               kPLineXToArcRight + kPArcToLineYRight / 2,
+                               kPLineXToArcLeft,
+                               kPLineXToArcRight + kPArcToLineYRight + kPLineYToEndRight / 2,
+                               kPLineXToArcRight};
+  std::vector<double> x;
+  std::vector<double> y;
+  piecewise_ground_curve_->G(kP, &x, &y);
+  ASSERT_EQ(kP.size(), x.size());
+  ASSERT_EQ(kP.size(), y.size());
+  for (std::size_t i = 0; i < kP.size(); ++i) {
+    EXPECT_TRUE(
+        AssertCompare(CompareVectors(piecewise_ground_curve_->G(kP[i]), Vector2(x[i], y[i]), kLinearTolerance)));
+  }
+  piecewise_ground_curve_->GDot(kP, &x, &y);
+  for (std::size_t i = 0; i < kP.size(); ++i) {
+    EXPECT_TRUE(
+        AssertCompare(CompareVectors(piecewise_ground_curve_->GDot(kP[i]), Vector2(x[i], y[i]), kLinearTolerance)));
+  }
+  std::vector<double> values;
+  piecewise_ground_curve_->Heading(kP, &values);
+  ASSERT_EQ(kP.size(), values.size());
+  for (std::size_t i = 0; i < kP.size(); ++i) {
+    EXPECT_NEAR(piecewise_ground_curve_->Heading(kP[i]), values[i], kLinearTolerance);
+  }
+  piecewise_ground_curve_->HeadingDot(kP, &values);
+  for (std::size_t i = 0; i < kP.size(); ++i) {
+    EXPECT_NEAR(piecewise_ground_curve_->HeadingDot(kP[i]), values[i], kLinearTolerance);
+  }
+  EXPECT_THROW(piecewise_ground_curve_->Heading({kP1 + 1.}, &values), maliput::common::assertion_error);
+}
+
+// LineGroundCurve mock that counts the single p and batched evaluations of G().
+class MockCountingLineGroundCurve : public LineGroundCurve {
+ public:
+  // Constructs a MockCountingLineGroundCurve.
+  // For parameter information @see LineGroundCurve.
+  MockCountingLineGroundCurve(const double linear_tolerance, const maliput::math::Vector2& xy0,
+                              const maliput::math::Vector2& dxy, double p0, double p1)
+      : LineGroundCurve(linear_tolerance, xy0, dxy, p0, p1), line_(linear_tolerance, xy0, dxy, p0, p1) {}
+
+  int num_g_evaluations() const { return num_g_evaluations_; }
+  int num_g_batch_evaluations() const { return num_g_batch_evaluations_; }
+
+ private:
+  maliput::math::Vector2 DoG(double p) const override {
+    ++num_g_evaluations_;
+    return line_.G(p);
+  }
+  void DoGBatch(const std::vector<double>& p, std::vector<double>* x, std::vector<double>* y) const override {
+    ++num_g_batch_evaluations_;
+    line_.G(p, x, y);
+  }
+
+  const LineGroundCurve line_;
+  mutable int num_g_evaluations_{0};
+  mutable int num_g_batch_evaluations_{0};
+};
+
+TEST_F(PiecewiseGroundCurveConstructorTest, BatchedEvaluationIsBatchedPerGroundCurve) {
+  auto line_x = std::make_unique<MockCountingLineGroundCurve>(kLinearTolerance, kXY0LineX, kDxyLineX, kP0LineX,
+                                                              kP1LineX);
+  auto line_y = std::make_unique<MockCountingLineGroundCurve>(kLinearTolerance, kXY0LineY, kDxyLineY, kP0LineY,
+                                                              kP1LineY);
+  const MockCountingLineGroundCurve* line_x_ptr = line_x.get();
+  const MockCountingLineGroundCurve* line_y_ptr = line_y.get();
+  std::vector<std::unique_ptr<GroundCurve>> ground_curves;
+  ground_curves.push_back(std::move(line_x));
+  ground_curves.push_back(std::make_unique<ArcGroundCurve>(kLinearTolerance, kXY0Arc, kStartHeading, kCurvature,
+                                                           kArcLength90DegLeft, kP0Arc, kP1Arc));
+  ground_curves.push_back(std::move(line_y));
+  const PiecewiseGroundCurve dut(std::move(ground_curves), kLinearTolerance, kAngularTolerance);
+  // The constructor checks the contiguity with single p evaluations.
+  const int num_line_x_g_evaluations = line_x_ptr->num_g_evaluations();
+  const int num_line_y_g_evaluations = line_y_ptr->num_g_evaluations();
+
+  std::vector<double> x;
+  std::vector<double> y;
+  dut.G({kP0, kP1, kPLineXToArcRight / 2, kPLineXToArcRight + kPArcToLineYRight / 2, kPLineXToArcLeft}, &x, &y);
+
+  EXPECT_EQ(1, line_x_ptr->num_g_batch_evaluations());
+  EXPECT_EQ(1, line_y_ptr->num_g_batch_evaluations());
+  EXPECT_EQ(num_line_x_g_evaluations, line_x_ptr->num_g_evaluations());
+  EXPECT_EQ(num_line_y_g_evaluations, line_y_ptr->num_g_evaluations());
+}
+
 TEST_F(PiecewiseGroundCurveTest, G) {
   // First geometry.
   EXPECT_TRUE(AssertCompare(
@@ -30,6 +30,7 @@
 #include "maliput_malidrive/road_curve/road_curve.h"
 
 #include <array>
+#include <cstddef>
 #include <memory>
 #include <utility>
 
@@ -43,6 +44,7 @@
 #include "maliput_malidrive/road_curve/arc_ground_curve.h"
 #include "maliput_malidrive/road_curve/cubic_polynomial.h"
 #include "maliput_malidrive/road_curve/line_ground_curve.h"
+#include "maliput_malidrive/road_curve/vector3_batch.h"
 #include "maliput_malidrive/test_utilities/function_stub.h"
 #include "maliput_malidrive/test_utilities/ground_curve_stub.h"
 
@@ -395,6 +397,18 @@ TEST_F(MalidriveRoadCurveStubWTest, WithAVerticalOffset) {
                                            kLinearTolerance)));
 }
 
+class MalidriveRoadCurveStubEvalFrameTest : public MalidriveRoadCurveStubTest {};
+
+// The Frame must reproduce W(p, r, h) for any (r, h) pair.
+TEST_F(MalidriveRoadCurveStubEvalFrameTest, MatchesW) {
+  for (const RoadCurve* dut : {flat_dut_.get(), elevated_dut_.get(), superelevated_dut_.get(), pitched_dut_.get()}) {
+    const RoadCurve::Frame frame = dut->EvalFrame(kP);
+    EXPECT_TRUE(AssertCompare(CompareVectors(dut->W({kP, kZero, kZero}), frame.origin, kLinearTolerance)));
+    EXPECT_TRUE(AssertCompare(
+        CompareVectors(dut->W({kP, kR, kH}), frame.origin + frame.rotation * Vector3(kZero, kR, kH), kLinearTolerance)));
+  }
+}
+
 class MalidriveRoadCurveStubOrientationOfPTest : public MalidriveRoadCurveStubTest {};
 
 TEST_F(MalidriveRoadCurveStubOrientationOfPTest, OrientatationOfP) {
@@ -886,6 +900,30 @@ TEST_F(MalidriveRoadCurveLineWTest, WithVariableOffset) {
   EXPECT_TRUE(AssertCompare(CompareVectors(kExpectedW, flat_dut_->W(kPRH), kLinearTolerance)));
 }
 
+TEST_F(MalidriveRoadCurveLineWTest, Batch) {
+  // Batched kernels round differently than scalar ones.
+  const double kBatchTolerance{1e-12};
+  const Vector3Batch kPRHs = [this]() {
+    Vector3Batch prhs;
+    for (double p = kP0; p <= kP1; p += 12.5) {
+      prhs.x.push_back(p);
+      prhs.y.push_back(kR);
+      prhs.z.push_back(kH);
+    }
+    return prhs;
+  }();
+  for (const RoadCurve* dut : {flat_dut_.get(), elevated_dut_.get(), pitched_dut_.get(), crest_dut_.get()}) {
+    Vector3Batch xyzs;
+    dut->W(kPRHs, &xyzs);
+    ASSERT_EQ(kPRHs.size(), xyzs.size());
+    for (std::size_t i = 0; i < kPRHs.size(); ++i) {
+      const Vector3 kExpectedW = dut->W({kPRHs.x[i], kPRHs.y[i], kPRHs.z[i]});
+      EXPECT_TRUE(
+          AssertCompare(CompareVectors(kExpectedW, Vector3{xyzs.x[i], xyzs.y[i], xyzs.z[i]}, kBatchTolerance)));
+    }
+  }
+}
+
 class MalidriveRoadCurveLineWInverseTest : public MalidriveRoadCurveLineTest {};
 
 TEST_F(MalidriveRoadCurveLineWInverseTest, AtTheCenterline) {
@@ -1297,6 +1335,43 @@ TEST_F(MalidriveRoadCurveArcWInverseTest, WithAVerticalOffset) {
                      kLinearTolerance)));
 }
 
+class MalidriveRoadCurveArcWBatchTest : public MalidriveRoadCurveArcTest {};
+
+TEST_F(MalidriveRoadCurveArcWBatchTest, MatchesW) {
+  // Batched kernels round differently than scalar ones.
+  const double kBatchTolerance{1e-12};
+  const Vector3Batch kPRHs = [this]() {
+    Vector3Batch prhs;
+    for (double p = kP0; p <= kP1; p += 12.5) {
+      prhs.x.push_back(p);
+      prhs.y.push_back(kR);
+      prhs.z.push_back(kH);
+    }
+    return prhs;
+  }();
+  for (const RoadCurve* dut : {flat_dut_.get(), elevated_dut_.get(), pitched_dut_.get(), superelevated_dut_.get()}) {
+    Vector3Batch xyzs;
+    dut->W(kPRHs, &xyzs);
+    ASSERT_EQ(kPRHs.size(), xyzs.size());
+    for (std::size_t i = 0; i < kPRHs.size(); ++i) {
+      const Vector3 kExpectedW = dut->W({kPRHs.x[i], kPRHs.y[i], kPRHs.z[i]});
+      EXPECT_TRUE(
+          AssertCompare(CompareVectors(kExpectedW, Vector3{xyzs.x[i], xyzs.y[i], xyzs.z[i]}, kBatchTolerance)));
+    }
+  }
+}
+
+TEST_F(MalidriveRoadCurveArcWBatchTest, Throws) {
+  Vector3Batch prhs(2);
+  prhs.z.pop_back();
+  Vector3Batch xyzs;
+  EXPECT_THROW(flat_dut_->W(prhs, &xyzs), maliput::common::assertion_error);
+  EXPECT_THROW(flat_dut_->W(Vector3Batch(2), nullptr), maliput::common::assertion_error);
+  Vector3Batch out_of_range_prhs(1);
+  out_of_range_prhs.x[0] = kP1 + 1.;
+  EXPECT_THROW(flat_dut_->W(out_of_range_prhs, &xyzs), maliput::common::assertion_error);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace road_curve
@@ -29,7 +29,10 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_malidrive/road_curve/scaled_domain_function.h"
 
+#include <cstddef>
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <maliput/common/assertion_error.h>
@@ -37,6 +40,7 @@
 #include "maliput_malidrive/common/macros.h"
 #include "maliput_malidrive/road_curve/cubic_polynomial.h"
 #include "maliput_malidrive/road_curve/function.h"
+#include "maliput_malidrive/test_utilities/function_stub.h"
 
 namespace malidrive {
 namespace road_curve {
@@ -88,6 +92,45 @@ GTEST_TEST(ScaledDomainFunction, ScaledDomain) {
               kTolerance);
 }
 
+GTEST_TEST(ScaledDomainFunction, BatchedScaledDomain) {
+  const ScaledDomainFunction scaled_dut(std::make_unique<CubicPolynomial>(kA, kB, kC, kD, kP0, kP1, kTolerance),
+                                        kScaledP0, kScaledP1, kTolerance);
+  const std::vector<double> kP{kScaledP1, kScaledP0, (kScaledP0 + kScaledP1) / 2.};
+
+  std::vector<double> images;
+  scaled_dut.f(kP, &images);
+  ASSERT_EQ(kP.size(), images.size());
+  for (std::size_t i = 0; i < kP.size(); ++i) {
+    EXPECT_NEAR(scaled_dut.f(kP[i]), images[i], kTolerance);
+  }
+  scaled_dut.f_dot(kP, &images);
+  for (std::size_t i = 0; i < kP.size(); ++i) {
+    EXPECT_NEAR(scaled_dut.f_dot(kP[i]), images[i], kTolerance);
+  }
+  scaled_dut.f_dot_dot(kP, &images);
+  for (std::size_t i = 0; i < kP.size(); ++i) {
+    EXPECT_NEAR(scaled_dut.f_dot_dot(kP[i]), images[i], kTolerance);
+  }
+  EXPECT_THROW(scaled_dut.f({kScaledP1 + 1.}, &images), maliput::common::assertion_error);
+}
+
+// The scaled function is evaluated with a single batched call.
+GTEST_TEST(ScaledDomainFunction, BatchedScaledDomainIsBatched) {
+  constexpr bool kIsG1Contiguous{true};
+  auto function_stub = std::make_unique<FunctionStub>(1., 2., 3., kP0, kP1, kIsG1Contiguous);
+  const FunctionStub* function_stub_ptr = function_stub.get();
+  const ScaledDomainFunction scaled_dut(std::move(function_stub), kScaledP0, kScaledP1, kTolerance);
+  const double kExpectedScale = (kP1 - kP0) / (kScaledP1 - kScaledP0);
+
+  std::vector<double> images;
+  scaled_dut.f_dot({kScaledP0, kScaledP1}, &images);
+  ASSERT_EQ(2u, images.size());
+  EXPECT_NEAR(2. * kExpectedScale, images[0], kTolerance);
+  EXPECT_NEAR(2. * kExpectedScale, images[1], kTolerance);
+  EXPECT_EQ(1, function_stub_ptr->num_batch_evaluations());
+  EXPECT_EQ(0, function_stub_ptr->num_evaluations());
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace road_curve